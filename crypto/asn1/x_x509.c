@@ -101,6 +101,7 @@ static int x509_cb(int operation, ASN1_VALUE **pval, const ASN1_ITEM *it,
 #endif
 		ret->aux = NULL;
 		ret->crldp = NULL;
+		ret->ex_cached = 0;
 		CRYPTO_new_ex_data(CRYPTO_EX_INDEX_X509, ret, &ret->ex_data);
 		break;
 
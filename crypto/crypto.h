@@ -237,7 +237,17 @@ typedef struct openssl_item_st
 #define CRYPTO_LOCK_COMP		38
 #define CRYPTO_LOCK_FIPS		39
 #define CRYPTO_LOCK_FIPS2		40
-#define CRYPTO_NUM_LOCKS		41
+/* CRYPTO_NUM_SSL_SESS_SHARDS consecutive locks, one per shard of a
+ * sharded SSL session cache (see SSL_SESS_CACHE_SHARDED) */
+#define CRYPTO_LOCK_SSL_SESS_SHARD	41
+#define CRYPTO_NUM_SSL_SESS_SHARDS	16
+#define CRYPTO_LOCK_SSL_TICKET_KEYS	57
+/* CRYPTO_NUM_SSL_BUF_POOL_SHARDS consecutive locks, one per shard of the
+ * record buffer pools of SSL_CTXs */
+#define CRYPTO_LOCK_SSL_BUF_POOL	58
+#define CRYPTO_NUM_SSL_BUF_POOL_SHARDS	8
+#define CRYPTO_LOCK_SSL_CIPHER_LIST	66
+#define CRYPTO_NUM_LOCKS		67
 
 #define CRYPTO_LOCK		1
 #define CRYPTO_UNLOCK		2
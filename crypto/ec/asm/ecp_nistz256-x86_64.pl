@@ -0,0 +1,499 @@
+#!/usr/bin/env perl
+#
+# ====================================================================
+# Written for the OpenSSL project. The module is dual licensed under
+# OpenSSL and CRYPTOGAMS licenses depending on where you obtain it.
+# ====================================================================
+#
+# Arithmetic modulo the P-256 prime
+#
+#	p = 2^256 - 2^224 + 2^192 + 2^96 - 1
+#
+# in the Montgomery domain with R = 2^256, on four 64-bit limbs, for
+# ecp_nistz256.c. All functions take and return fully reduced values,
+# and none of them branch on, or index memory with, their operands.
+#
+# Montgomery multiplication interleaves the four rows of the schoolbook
+# product with the reductions: as p = -1 mod 2^64, the factor of each
+# reduction is the least significant limb of the accumulator itself,
+# and as the third limb of p is zero, a reduction takes two multiplies.
+#
+# void ecp_nistz256_mul_mont(BN_ULONG res[4], const BN_ULONG a[4],
+#				const BN_ULONG b[4]);	# a*b/R mod p
+# void ecp_nistz256_sqr_mont(BN_ULONG res[4], const BN_ULONG a[4]);
+# void ecp_nistz256_from_mont(BN_ULONG res[4], const BN_ULONG a[4]);
+# void ecp_nistz256_add(BN_ULONG res[4], const BN_ULONG a[4],
+#				const BN_ULONG b[4]);
+# void ecp_nistz256_sub(BN_ULONG res[4], const BN_ULONG a[4],
+#				const BN_ULONG b[4]);
+# void ecp_nistz256_div_by_2(BN_ULONG res[4], const BN_ULONG a[4]);
+
+$flavour = shift;
+$output  = shift;
+if ($flavour =~ /\./) { $output = $flavour; undef $flavour; }
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+open OUT,"| \"$^X\" $xlate $flavour $output";
+*STDOUT=*OUT;
+
+my ($r_ptr,$a_ptr,$b_ptr)=("%rdi","%rsi","%rbx");
+my @acc=map("%r$_",(8..13));
+my ($poly1,$poly3)=("%r14","%r15");
+
+$code.=<<___;
+.text
+
+.align	64
+.Lpoly:
+.quad	0xffffffffffffffff, 0x00000000ffffffff, 0x0000000000000000, 0xffffffff00000001
+.Lone:
+.quad	1,0,0,0
+
+################################################################################
+# void ecp_nistz256_mul_mont(BN_ULONG res[4], const BN_ULONG a[4],
+#				const BN_ULONG b[4]);
+.globl	ecp_nistz256_mul_mont
+.type	ecp_nistz256_mul_mont,\@function,3
+.align	32
+ecp_nistz256_mul_mont:
+	push	%rbp
+	push	%rbx
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+.Lmul_body:
+	mov	%rdx,$b_ptr
+	call	__ecp_nistz256_mul_montq
+	mov	0(%rsp),%r15
+	mov	8(%rsp),%r14
+	mov	16(%rsp),%r13
+	mov	24(%rsp),%r12
+	mov	32(%rsp),%rbx
+	mov	40(%rsp),%rbp
+	lea	48(%rsp),%rsp
+.Lmul_epilogue:
+	ret
+.size	ecp_nistz256_mul_mont,.-ecp_nistz256_mul_mont
+
+################################################################################
+# void ecp_nistz256_sqr_mont(BN_ULONG res[4], const BN_ULONG a[4]);
+.globl	ecp_nistz256_sqr_mont
+.type	ecp_nistz256_sqr_mont,\@function,2
+.align	32
+ecp_nistz256_sqr_mont:
+	push	%rbp
+	push	%rbx
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+.Lsqr_body:
+	mov	$a_ptr,$b_ptr
+	call	__ecp_nistz256_mul_montq
+	mov	0(%rsp),%r15
+	mov	8(%rsp),%r14
+	mov	16(%rsp),%r13
+	mov	24(%rsp),%r12
+	mov	32(%rsp),%rbx
+	mov	40(%rsp),%rbp
+	lea	48(%rsp),%rsp
+.Lsqr_epilogue:
+	ret
+.size	ecp_nistz256_sqr_mont,.-ecp_nistz256_sqr_mont
+
+################################################################################
+# void ecp_nistz256_from_mont(BN_ULONG res[4], const BN_ULONG a[4]);
+.globl	ecp_nistz256_from_mont
+.type	ecp_nistz256_from_mont,\@function,2
+.align	32
+ecp_nistz256_from_mont:
+	push	%rbp
+	push	%rbx
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+.Lfrom_body:
+	lea	.Lone(%rip),$b_ptr
+	call	__ecp_nistz256_mul_montq
+	mov	0(%rsp),%r15
+	mov	8(%rsp),%r14
+	mov	16(%rsp),%r13
+	mov	24(%rsp),%r12
+	mov	32(%rsp),%rbx
+	mov	40(%rsp),%rbp
+	lea	48(%rsp),%rsp
+.Lfrom_epilogue:
+	ret
+.size	ecp_nistz256_from_mont,.-ecp_nistz256_from_mont
+
+################################################################################
+# res = a*b/R mod p for \$r_ptr, \$a_ptr and \$b_ptr; clobbers %rax, %rcx,
+# %rdx, %rbp and %r8-%r15
+.type	__ecp_nistz256_mul_montq,\@abi-omnipotent
+.align	32
+__ecp_nistz256_mul_montq:
+	mov	.Lpoly+8(%rip),$poly1
+	mov	.Lpoly+24(%rip),$poly3
+	xor	$acc[0],$acc[0]
+	xor	$acc[1],$acc[1]
+	xor	$acc[2],$acc[2]
+	xor	$acc[3],$acc[3]
+	xor	$acc[4],$acc[4]
+	xor	$acc[5],$acc[5]
+___
+for (my $i=0; $i<4; $i++) {
+my ($acc0,$acc1,$acc2,$acc3,$acc4,$acc5)=@acc;
+$code.=<<___;
+
+	################################# acc += a*b[$i]
+	mov	8*$i($b_ptr),%rcx
+	mov	8*0($a_ptr),%rax
+	mul	%rcx
+	add	%rax,$acc0
+	adc	\$0,%rdx
+	mov	%rdx,%rbp
+
+	mov	8*1($a_ptr),%rax
+	mul	%rcx
+	add	%rbp,$acc1
+	adc	\$0,%rdx
+	add	%rax,$acc1
+	adc	\$0,%rdx
+	mov	%rdx,%rbp
+
+	mov	8*2($a_ptr),%rax
+	mul	%rcx
+	add	%rbp,$acc2
+	adc	\$0,%rdx
+	add	%rax,$acc2
+	adc	\$0,%rdx
+	mov	%rdx,%rbp
+
+	mov	8*3($a_ptr),%rax
+	mul	%rcx
+	add	%rbp,$acc3
+	adc	\$0,%rdx
+	add	%rax,$acc3
+	adc	\$0,%rdx
+	add	%rdx,$acc4
+	adc	\$0,$acc5
+
+	################################# acc += acc[0]*p, acc >>= 64
+	# acc[0]*p[0] = acc[0]*2^64 - acc[0] clears the first limb and
+	# carries acc[0] into the second
+	mov	$acc0,%rcx
+	mov	$poly1,%rax
+	mul	%rcx
+	add	%rcx,$acc1
+	adc	\$0,%rdx
+	add	%rax,$acc1
+	adc	\$0,%rdx
+	mov	%rdx,%rbp
+
+	add	%rbp,$acc2
+	mov	\$0,%rbp
+	adc	\$0,%rbp
+
+	mov	$poly3,%rax
+	mul	%rcx
+	add	%rbp,$acc3
+	adc	\$0,%rdx
+	add	%rax,$acc3
+	adc	\$0,%rdx
+	add	%rdx,$acc4
+	adc	\$0,$acc5
+	xor	$acc0,$acc0
+___
+push(@acc,shift(@acc));
+}
+{
+my ($acc0,$acc1,$acc2,$acc3,$acc4)=@acc;
+$code.=<<___;
+
+	################################# res = acc - p if that does not borrow
+	mov	$acc0,%rax
+	mov	$acc1,%rdx
+	mov	$acc2,%rcx
+	mov	$acc3,%rbp
+	sub	\$-1,$acc0
+	sbb	$poly1,$acc1
+	sbb	\$0,$acc2
+	sbb	$poly3,$acc3
+	sbb	\$0,$acc4
+	cmovc	%rax,$acc0
+	cmovc	%rdx,$acc1
+	cmovc	%rcx,$acc2
+	cmovc	%rbp,$acc3
+	mov	$acc0,8*0($r_ptr)
+	mov	$acc1,8*1($r_ptr)
+	mov	$acc2,8*2($r_ptr)
+	mov	$acc3,8*3($r_ptr)
+	ret
+.size	__ecp_nistz256_mul_montq,.-__ecp_nistz256_mul_montq
+___
+}
+{
+my ($acc0,$acc1,$acc2,$acc3)=map("%r$_",(8..11));
+my ($t0,$t1,$t2,$t3)=("%rax","%rcx","%rdx","%rsi");
+$code.=<<___;
+
+################################################################################
+# void ecp_nistz256_add(BN_ULONG res[4], const BN_ULONG a[4],
+#				const BN_ULONG b[4]);
+.globl	ecp_nistz256_add
+.type	ecp_nistz256_add,\@function,3
+.align	32
+ecp_nistz256_add:
+	mov	8*0($a_ptr),$acc0
+	mov	8*1($a_ptr),$acc1
+	mov	8*2($a_ptr),$acc2
+	mov	8*3($a_ptr),$acc3
+	add	8*0(%rdx),$acc0
+	adc	8*1(%rdx),$acc1
+	adc	8*2(%rdx),$acc2
+	adc	8*3(%rdx),$acc3
+	mov	\$0,%edx		# leaves the carry
+	adc	\$0,%rdx
+
+	# store the sum, then the sum less p unless that borrows: this
+	# needs no register that would have to be saved
+	mov	$acc0,8*0($r_ptr)
+	mov	$acc1,8*1($r_ptr)
+	mov	$acc2,8*2($r_ptr)
+	mov	$acc3,8*3($r_ptr)
+	sub	\$-1,$acc0
+	sbb	.Lpoly+8(%rip),$acc1
+	sbb	\$0,$acc2
+	sbb	.Lpoly+24(%rip),$acc3
+	sbb	\$0,%rdx
+	cmovc	8*0($r_ptr),$acc0
+	cmovc	8*1($r_ptr),$acc1
+	cmovc	8*2($r_ptr),$acc2
+	cmovc	8*3($r_ptr),$acc3
+
+	mov	$acc0,8*0($r_ptr)
+	mov	$acc1,8*1($r_ptr)
+	mov	$acc2,8*2($r_ptr)
+	mov	$acc3,8*3($r_ptr)
+	ret
+.size	ecp_nistz256_add,.-ecp_nistz256_add
+
+################################################################################
+# void ecp_nistz256_sub(BN_ULONG res[4], const BN_ULONG a[4],
+#				const BN_ULONG b[4]);
+.globl	ecp_nistz256_sub
+.type	ecp_nistz256_sub,\@function,3
+.align	32
+ecp_nistz256_sub:
+	mov	8*0($a_ptr),$acc0
+	mov	8*1($a_ptr),$acc1
+	mov	8*2($a_ptr),$acc2
+	mov	8*3($a_ptr),$acc3
+	sub	8*0(%rdx),$acc0
+	sbb	8*1(%rdx),$acc1
+	sbb	8*2(%rdx),$acc2
+	sbb	8*3(%rdx),$acc3
+	sbb	$t0,$t0			# all ones if a < b
+
+	# add p back if it borrowed
+	mov	$t0,$t1
+	mov	.Lpoly+8(%rip),$t2
+	mov	.Lpoly+24(%rip),$t3
+	and	$t0,$t2
+	and	$t0,$t3
+	add	$t1,$acc0
+	adc	$t2,$acc1
+	adc	\$0,$acc2
+	adc	$t3,$acc3
+
+	mov	$acc0,8*0($r_ptr)
+	mov	$acc1,8*1($r_ptr)
+	mov	$acc2,8*2($r_ptr)
+	mov	$acc3,8*3($r_ptr)
+	ret
+.size	ecp_nistz256_sub,.-ecp_nistz256_sub
+
+################################################################################
+# void ecp_nistz256_div_by_2(BN_ULONG res[4], const BN_ULONG a[4]);
+.globl	ecp_nistz256_div_by_2
+.type	ecp_nistz256_div_by_2,\@function,2
+.align	32
+ecp_nistz256_div_by_2:
+	mov	8*0($a_ptr),$acc0
+	mov	8*1($a_ptr),$acc1
+	mov	8*2($a_ptr),$acc2
+	mov	8*3($a_ptr),$acc3
+
+	# add p if a is odd, then shift the 257-bit sum
+	mov	$acc0,$t0
+	and	\$1,$t0
+	neg	$t0			# all ones if a is odd
+	mov	$t0,$t1
+	mov	.Lpoly+8(%rip),$t2
+	mov	.Lpoly+24(%rip),$t3
+	and	$t0,$t2
+	and	$t0,$t3
+	add	$t1,$acc0
+	adc	$t2,$acc1
+	adc	\$0,$acc2
+	adc	$t3,$acc3
+	mov	\$0,$t0
+	adc	\$0,$t0
+
+	shrd	\$1,$acc1,$acc0
+	shrd	\$1,$acc2,$acc1
+	shrd	\$1,$acc3,$acc2
+	shrd	\$1,$t0,$acc3
+
+	mov	$acc0,8*0($r_ptr)
+	mov	$acc1,8*1($r_ptr)
+	mov	$acc2,8*2($r_ptr)
+	mov	$acc3,8*3($r_ptr)
+	ret
+.size	ecp_nistz256_div_by_2,.-ecp_nistz256_div_by_2
+___
+}
+
+# EXCEPTION_DISPOSITION handler (EXCEPTION_RECORD *rec,ULONG64 frame,
+#		CONTEXT *context,DISPATCHER_CONTEXT *disp)
+#
+# For the functions that save %rbp, %rbx and %r12-%r15 around
+# __ecp_nistz256_mul_montq; the others use no register that Win64 has
+# the callee save but %rsi and %rdi, which the prologue keeps.
+if ($win64) {
+$rec="%rcx";
+$frame="%rdx";
+$context="%r8";
+$disp="%r9";
+
+$code.=<<___;
+.extern	__imp_RtlVirtualUnwind
+.type	se_handler,\@abi-omnipotent
+.align	16
+se_handler:
+	push	%rsi
+	push	%rdi
+	push	%rbx
+	push	%rbp
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+	pushfq
+	sub	\$64,%rsp
+
+	mov	120($context),%rax	# pull context->Rax
+	mov	248($context),%rbx	# pull context->Rip
+
+	mov	8($disp),%rsi		# disp->ImageBase
+	mov	56($disp),%r11		# disp->HandlerData
+
+	mov	0(%r11),%r10d		# HandlerData[0]
+	lea	(%rsi,%r10),%r10	# end of prologue label
+	cmp	%r10,%rbx		# context->Rip<end of prologue label
+	jb	.Lcommon_seh_tail
+
+	mov	152($context),%rax	# pull context->Rsp
+
+	mov	4(%r11),%r10d		# HandlerData[1]
+	lea	(%rsi,%r10),%r10	# epilogue label
+	cmp	%r10,%rbx		# context->Rip>=epilogue label
+	jae	.Lcommon_seh_tail
+
+	lea	48(%rax),%rax
+
+	mov	-8(%rax),%rbp
+	mov	-16(%rax),%rbx
+	mov	-24(%rax),%r12
+	mov	-32(%rax),%r13
+	mov	-40(%rax),%r14
+	mov	-48(%rax),%r15
+	mov	%rbx,144($context)	# restore context->Rbx
+	mov	%rbp,160($context)	# restore context->Rbp
+	mov	%r12,216($context)	# restore context->R12
+	mov	%r13,224($context)	# restore context->R13
+	mov	%r14,232($context)	# restore context->R14
+	mov	%r15,240($context)	# restore context->R15
+
+.Lcommon_seh_tail:
+	mov	8(%rax),%rdi
+	mov	16(%rax),%rsi
+	mov	%rax,152($context)	# restore context->Rsp
+	mov	%rsi,168($context)	# restore context->Rsi
+	mov	%rdi,176($context)	# restore context->Rdi
+
+	mov	40($disp),%rdi		# disp->ContextRecord
+	mov	$context,%rsi		# context
+	mov	\$154,%ecx		# sizeof(CONTEXT)
+	.long	0xa548f3fc		# cld; rep movsq
+
+	mov	$disp,%rsi
+	xor	%rcx,%rcx		# arg1, UNW_FLAG_NHANDLER
+	mov	8(%rsi),%rdx		# arg2, disp->ImageBase
+	mov	0(%rsi),%r8		# arg3, disp->ControlPc
+	mov	16(%rsi),%r9		# arg4, disp->FunctionEntry
+	mov	40(%rsi),%r10		# disp->ContextRecord
+	lea	56(%rsi),%r11		# &disp->HandlerData
+	lea	24(%rsi),%r12		# &disp->EstablisherFrame
+	mov	%r10,32(%rsp)		# arg5
+	mov	%r11,40(%rsp)		# arg6
+	mov	%r12,48(%rsp)		# arg7
+	mov	%rcx,56(%rsp)		# arg8, (NULL)
+	call	*__imp_RtlVirtualUnwind(%rip)
+
+	mov	\$1,%eax		# ExceptionContinueSearch
+	add	\$64,%rsp
+	popfq
+	pop	%r15
+	pop	%r14
+	pop	%r13
+	pop	%r12
+	pop	%rbp
+	pop	%rbx
+	pop	%rdi
+	pop	%rsi
+	ret
+.size	se_handler,.-se_handler
+
+.section	.pdata
+.align	4
+	.rva	.LSEH_begin_ecp_nistz256_mul_mont
+	.rva	.LSEH_end_ecp_nistz256_mul_mont
+	.rva	.LSEH_info_ecp_nistz256_mul_mont
+
+	.rva	.LSEH_begin_ecp_nistz256_sqr_mont
+	.rva	.LSEH_end_ecp_nistz256_sqr_mont
+	.rva	.LSEH_info_ecp_nistz256_sqr_mont
+
+	.rva	.LSEH_begin_ecp_nistz256_from_mont
+	.rva	.LSEH_end_ecp_nistz256_from_mont
+	.rva	.LSEH_info_ecp_nistz256_from_mont
+
+.section	.xdata
+.align	8
+.LSEH_info_ecp_nistz256_mul_mont:
+	.byte	9,0,0,0
+	.rva	se_handler
+	.rva	.Lmul_body,.Lmul_epilogue		# HandlerData[]
+.LSEH_info_ecp_nistz256_sqr_mont:
+	.byte	9,0,0,0
+	.rva	se_handler
+	.rva	.Lsqr_body,.Lsqr_epilogue		# HandlerData[]
+.LSEH_info_ecp_nistz256_from_mont:
+	.byte	9,0,0,0
+	.rva	se_handler
+	.rva	.Lfrom_body,.Lfrom_epilogue		# HandlerData[]
+___
+}
+
+$code =~ s/\`([^\`]*)\`/eval $1/gem;
+print $code;
+close STDOUT;
@@ -1065,6 +1065,8 @@ void ERR_load_EC_strings(void);
 #define EC_F_ECPARAMETERS_PRINT_FP			 148
 #define EC_F_ECPKPARAMETERS_PRINT			 149
 #define EC_F_ECPKPARAMETERS_PRINT_FP			 150
+#define EC_F_ECP_NISTZ256_GET_AFFINE			 242
+#define EC_F_ECP_NISTZ256_POINTS_MUL			 241
 #define EC_F_ECP_NIST_MOD_192				 203
 #define EC_F_ECP_NIST_MOD_224				 204
 #define EC_F_ECP_NIST_MOD_256				 205
@@ -1075,6 +1077,7 @@ void ERR_load_EC_strings(void);
 #define EC_F_EC_ASN1_GROUP2PKPARAMETERS			 156
 #define EC_F_EC_ASN1_PARAMETERS2GROUP			 157
 #define EC_F_EC_ASN1_PKPARAMETERS2GROUP			 158
+#define EC_F_EC_COMB_NEW				 240
 #define EC_F_EC_EX_DATA_SET_DATA			 211
 #define EC_F_EC_GF2M_MONTGOMERY_POINT_MULTIPLY		 208
 #define EC_F_EC_GF2M_SIMPLE_GROUP_CHECK_DISCRIMINANT	 159
@@ -1143,6 +1146,7 @@ void ERR_load_EC_strings(void);
 #define EC_F_EC_KEY_PRINT				 180
 #define EC_F_EC_KEY_PRINT_FP				 181
 #define EC_F_EC_KEY_SET_PUBLIC_KEY_AFFINE_COORDINATES	 229
+#define EC_F_EC_PIPPENGER_MUL				 243
 #define EC_F_EC_POINTS_MAKE_AFFINE			 136
 #define EC_F_EC_POINT_ADD				 112
 #define EC_F_EC_POINT_CMP				 113
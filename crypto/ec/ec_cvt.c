@@ -75,12 +75,37 @@
 #include "ec_lcl.h"
 
 
+#ifdef ECP_NISTZ256_ASM
+/* 1 if p and a are those of P-256, whose named group has a method of its
+ * own; groups with the same parameters get it too, or their points would
+ * not compare with the points of the named group */
+static int ec_is_nist_p256(const BIGNUM *p, const BIGNUM *a)
+	{
+	BIGNUM *t;
+	int ret;
+
+	if (BN_cmp(p, BN_get0_nist_prime_256()) != 0)
+		return 0;
+	if ((t = BN_dup(a)) == NULL)
+		return 0;
+	/* a = -3, as p - 3 or -3 */
+	ret = BN_add_word(t, 3) && (BN_cmp(t, p) == 0 || BN_is_zero(t));
+	BN_free(t);
+	return ret;
+	}
+#endif
+
 EC_GROUP *EC_GROUP_new_curve_GFp(const BIGNUM *p, const BIGNUM *a, const BIGNUM *b, BN_CTX *ctx)
 	{
 	const EC_METHOD *meth;
 	EC_GROUP *ret;
 
-#if defined(OPENSSL_BN_ASM_MONT)
+#if defined(ECP_NISTZ256_ASM)
+	if (ec_is_nist_p256(p, a))
+		meth = EC_GFp_nistz256_method();
+	else
+		meth = EC_GFp_mont_method();
+#elif defined(OPENSSL_BN_ASM_MONT)
 	/*
 	 * This might appear controversial, but the fact is that generic
 	 * prime method was observed to deliver better performance even
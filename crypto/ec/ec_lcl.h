@@ -186,6 +186,8 @@ typedef struct ec_extra_data_st {
 	void (*clear_free_func)(void *);
 } EC_EXTRA_DATA; /* used in EC_GROUP */
 
+typedef struct ec_comb_st EC_COMB; /* comb table of a generator: see ec_mult.c */
+
 struct ec_group_st {
 	const EC_METHOD *meth;
 
@@ -201,6 +203,10 @@ struct ec_group_st {
 
 	EC_EXTRA_DATA *extra_data; /* linked list */
 
+	EC_COMB *comb; /* lazily built comb of the generator of a named curve,
+	                * shared by copies of the group */
+	int comb_uses; /* multiplications of the generator without a comb */
+
 	/* The following members are handled by the method functions,
 	 * even if they appear generic */
 	
@@ -293,6 +299,8 @@ int ec_wNAF_mul(const EC_GROUP *group, EC_POINT *r, const BIGNUM *scalar,
 	size_t num, const EC_POINT *points[], const BIGNUM *scalars[], BN_CTX *);
 int ec_wNAF_precompute_mult(EC_GROUP *group, BN_CTX *);
 int ec_wNAF_have_precompute_mult(const EC_GROUP *group);
+void ec_group_copy_comb(EC_GROUP *dest, const EC_GROUP *src);
+void ec_group_free_comb(EC_GROUP *group);
 
 
 /* method functions in ecp_smpl.c */
@@ -444,3 +452,11 @@ void ec_GFp_nistp_points_make_affine_internal(size_t num, void *point_array,
 	void (*felem_contract)(void *out, const void *in));
 void ec_GFp_nistp_recode_scalar_bits(unsigned char *sign, unsigned char *digit, unsigned char in);
 #endif
+
+#ifdef ECP_NISTZ256_ASM
+/** Returns the constant-time P-256 method of ecp_nistz256.c, with the
+ *  field arithmetic in assembler
+ *  \return  EC_METHOD object
+ */
+const EC_METHOD *EC_GFp_nistz256_method(void);
+#endif
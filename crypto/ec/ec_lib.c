@@ -101,6 +101,8 @@ EC_GROUP *EC_GROUP_new(const EC_METHOD *meth)
 	ret->meth = meth;
 
 	ret->extra_data = NULL;
+	ret->comb = NULL;
+	ret->comb_uses = 0;
 
 	ret->generator = NULL;
 	BN_init(&ret->order);
@@ -131,6 +133,7 @@ void EC_GROUP_free(EC_GROUP *group)
 		group->meth->group_finish(group);
 
 	EC_EX_DATA_free_all_data(&group->extra_data);
+	ec_group_free_comb(group);
 
 	if (group->generator != NULL)
 		EC_POINT_free(group->generator);
@@ -154,6 +157,7 @@ void EC_GROUP_clear_free(EC_GROUP *group)
 		group->meth->group_finish(group);
 
 	EC_EX_DATA_clear_free_all_data(&group->extra_data);
+	ec_group_free_comb(group);
 
 	if (group->generator != NULL)
 		EC_POINT_clear_free(group->generator);
@@ -199,6 +203,7 @@ int EC_GROUP_copy(EC_GROUP *dest, const EC_GROUP *src)
 		if (!EC_EX_DATA_set_data(&dest->extra_data, t, d->dup_func, d->free_func, d->clear_free_func))
 			return 0;
 		}
+	ec_group_copy_comb(dest, src);
 
 	if (src->generator != NULL)
 		{
@@ -298,6 +303,7 @@ int EC_GROUP_set_generator(EC_GROUP *group, const EC_POINT *generator, const BIG
 		if (group->generator == NULL) return 0;
 		}
 	if (!EC_POINT_copy(group->generator, generator)) return 0;
+	ec_group_free_comb(group);
 
 	if (order != NULL)
 		{ if (!BN_copy(&group->order, order)) return 0; }	
@@ -414,6 +420,8 @@ int EC_GROUP_set_curve_GFp(EC_GROUP *group, const BIGNUM *p, const BIGNUM *a, co
 		ECerr(EC_F_EC_GROUP_SET_CURVE_GFP, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED);
 		return 0;
 		}
+	/* the comb holds multiples of the generator on the old curve */
+	ec_group_free_comb(group);
 	return group->meth->group_set_curve(group, p, a, b, ctx);
 	}
 
@@ -436,6 +444,8 @@ int EC_GROUP_set_curve_GF2m(EC_GROUP *group, const BIGNUM *p, const BIGNUM *a, c
 		ECerr(EC_F_EC_GROUP_SET_CURVE_GF2M, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED);
 		return 0;
 		}
+	/* the comb holds multiples of the generator on the old curve */
+	ec_group_free_comb(group);
 	return group->meth->group_set_curve(group, p, a, b, ctx);
 	}
 
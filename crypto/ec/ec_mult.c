@@ -184,6 +184,415 @@ static void ec_pre_comp_clear_free(void *pre_)
 
 
 
+/* Fixed-base comb (Lim-Lee) for multiples of the generator alone, as in
+ * ECDSA signing and key generation.
+ *
+ * A scalar of up to  teeth * spacing  bits is split into  teeth  rows of
+ * 'spacing' bits, and each row into  combs  blocks of 'columns' bits.
+ * Comb s picks bit  s * columns + i  of every row; entry  j  of its table
+ * is the sum of  2^(k * spacing + s * columns) * generator  over the bits
+ * k set in j. Then
+ *     scalar * generator
+ * takes 'columns' doublings and  combs * columns  additions of affine
+ * points.
+ *
+ * As the scalar is usually secret, every block reads the whole table of
+ * its comb and adds what it picked, even a block of zeros, whose sum is
+ * dropped. The sum starts from an offset, a multiple of the generator out
+ * of reach of the table, rather than from the point at infinity, and the
+ * offset is taken off at the end: no addition on the way meets the point
+ * at infinity or turns into a doubling.
+ *
+ * With 7 teeth and 2 combs, the 254 points of the comb take about the
+ * time of the wNAF splitting of ec_wNAF_precompute_mult(), whose table
+ * grows with the order.
+ *
+ * The comb of a named curve is built the second time its EC_GROUP
+ * multiplies the generator alone, as it costs about two multiplications,
+ * unless the group has a precomputation of its own, and is shared
+ * read-only by threads and by copies of the group. */
+
+#define EC_COMB_TEETH		7
+#define EC_COMB_COMBS		2
+#define EC_COMB_MIN_USES	2
+
+struct ec_comb_st {
+	size_t teeth;      /* rows of the scalar */
+	size_t combs;      /* number of combs */
+	size_t spacing;    /* bits per row */
+	size_t columns;    /* bits per block: doublings per multiplication */
+	EC_POINT **points; /* combs * (2^teeth - 1) affine points, the offset,
+	                    * minus the offset doubled  columns - 1  times,
+	                    * and a NULL: entry j of comb s is
+	                    * points[s * (2^teeth - 1) + j - 1] */
+	int words;         /* words of a coordinate in 'coords' */
+	BN_ULONG *coords;  /* X and Y of each entry of the combs, in the order
+	                    * of 'points' */
+	int references;
+} /* EC_COMB */;
+
+static void ec_comb_free(EC_COMB *comb)
+	{
+	EC_POINT **p;
+
+	if (!comb)
+		return;
+
+	if (CRYPTO_add(&comb->references, -1, CRYPTO_LOCK_EC_PRE_COMP) > 0)
+		return;
+
+	if (comb->points)
+		{
+		for (p = comb->points; *p != NULL; p++)
+			EC_POINT_free(*p);
+		OPENSSL_free(comb->points);
+		}
+	if (comb->coords)
+		OPENSSL_free(comb->coords);
+	OPENSSL_free(comb);
+	}
+
+/* Copies 'a' to the 'words' words at 'out', zeroing those over its top */
+static void ec_comb_put(BN_ULONG *out, const BIGNUM *a, int words)
+	{
+	int i;
+
+	for (i = 0; i < words; i++)
+		out[i] = i < a->top ? a->d[i] : 0;
+	}
+
+static EC_COMB *ec_comb_new(const EC_GROUP *group, BN_CTX *ctx)
+	{
+	const EC_POINT *generator;
+	EC_POINT *base = NULL, **points;
+	EC_COMB *comb;
+	size_t bits, per_comb, num, pos, exp, i, j, k, s;
+
+	generator = EC_GROUP_get0_generator(group);
+	if (generator == NULL)
+		{
+		ECerr(EC_F_EC_COMB_NEW, EC_R_UNDEFINED_GENERATOR);
+		return NULL;
+		}
+	if (BN_is_zero(&group->order))
+		{
+		ECerr(EC_F_EC_COMB_NEW, EC_R_UNKNOWN_ORDER);
+		return NULL;
+		}
+
+	comb = OPENSSL_malloc(sizeof *comb);
+	if (!comb)
+		{
+		ECerr(EC_F_EC_COMB_NEW, ERR_R_MALLOC_FAILURE);
+		return NULL;
+		}
+	/* one bit over the order, for the  k + order  of ECDSA signing */
+	bits = BN_num_bits(&group->order) + 1;
+	comb->teeth = EC_COMB_TEETH;
+	comb->combs = EC_COMB_COMBS;
+	comb->spacing = (bits + comb->teeth - 1) / comb->teeth;
+	comb->columns = (comb->spacing + comb->combs - 1) / comb->combs;
+	comb->points = NULL;
+	comb->words = 0;
+	comb->coords = NULL;
+	comb->references = 1;
+
+	per_comb = ((size_t)1 << comb->teeth) - 1;
+	num = comb->combs * per_comb;
+
+	/* the bases of the combs must come in the order of the rows */
+	if ((comb->combs - 1) * comb->columns >= comb->spacing)
+		{
+		ECerr(EC_F_EC_COMB_NEW, ERR_R_INTERNAL_ERROR);
+		goto err;
+		}
+
+	points = OPENSSL_malloc((num + 3) * sizeof points[0]);
+	if (!points)
+		{
+		ECerr(EC_F_EC_COMB_NEW, ERR_R_MALLOC_FAILURE);
+		goto err;
+		}
+	for (i = 0; i <= num + 2; i++)
+		points[i] = NULL;
+	comb->points = points;
+	for (i = 0; i < num + 2; i++)
+		{
+		if ((points[i] = EC_POINT_new(group)) == NULL)
+			goto err;
+		}
+	if ((base = EC_POINT_new(group)) == NULL
+		|| !EC_POINT_copy(base, generator))
+		goto err;
+
+	/* entries with a single bit set: 2^(k * spacing + s * columns) * G */
+	pos = 0;
+	for (k = 0; k < comb->teeth; k++)
+		{
+		for (s = 0; s < comb->combs; s++)
+			{
+			exp = k * comb->spacing + s * comb->columns;
+			for (; pos < exp; pos++)
+				{
+				if (!EC_POINT_dbl(group, base, base, ctx))
+					goto err;
+				}
+			if (!EC_POINT_copy(points[s * per_comb + ((size_t)1 << k) - 1], base))
+				goto err;
+			}
+		}
+
+	/* the others are sums of their lowest bit and the rest */
+	for (s = 0; s < comb->combs; s++)
+		{
+		EC_POINT **t = points + s * per_comb;
+
+		for (j = 1; j <= per_comb; j++)
+			{
+			size_t low = j & (~j + 1);
+
+			if (j == low)
+				continue;
+			if (!EC_POINT_add(group, t[j - 1], t[j - low - 1], t[low - 1], ctx))
+				goto err;
+			}
+		}
+
+	/* the offset, 2^(teeth * spacing) * G, and minus its multiple by
+	 * 2^(columns - 1) */
+	for (; pos < comb->teeth * comb->spacing + comb->columns - 1; pos++)
+		{
+		if (pos == comb->teeth * comb->spacing
+			&& !EC_POINT_copy(points[num], base))
+			goto err;
+		if (!EC_POINT_dbl(group, base, base, ctx))
+			goto err;
+		}
+	if (comb->columns == 1 && !EC_POINT_copy(points[num], base))
+		goto err;
+	if (!EC_POINT_invert(group, base, ctx)
+		|| !EC_POINT_copy(points[num + 1], base))
+		goto err;
+
+	if (!EC_POINTs_make_affine(group, num + 2, points, ctx))
+		goto err;
+
+	/* ec_comb_lookup() reads the whole table of a comb: lay it out in a
+	 * block, with all the words a coordinate may take */
+	comb->words = group->field.top;
+	comb->coords = OPENSSL_malloc(num * 2 * comb->words * sizeof comb->coords[0]);
+	if (!comb->coords)
+		{
+		ECerr(EC_F_EC_COMB_NEW, ERR_R_MALLOC_FAILURE);
+		goto err;
+		}
+	for (i = 0; i < num; i++)
+		{
+		ec_comb_put(comb->coords + 2 * i * comb->words, &points[i]->X, comb->words);
+		ec_comb_put(comb->coords + (2 * i + 1) * comb->words, &points[i]->Y, comb->words);
+		}
+
+	EC_POINT_free(base);
+	return comb;
+
+ err:
+	if (base)
+		EC_POINT_free(base);
+	ec_comb_free(comb);
+	return NULL;
+	}
+
+/* Returns the comb of 'group', building it if it is time to, or NULL */
+static const EC_COMB *ec_comb_get(const EC_GROUP *group, BN_CTX *ctx)
+	{
+	/* the comb is a cache of the generator, not part of the group */
+	EC_GROUP *g = (EC_GROUP *)group;
+	EC_COMB *comb, *ret;
+	int build;
+
+	CRYPTO_r_lock(CRYPTO_LOCK_EC_PRE_COMP);
+	ret = g->comb;
+	CRYPTO_r_unlock(CRYPTO_LOCK_EC_PRE_COMP);
+	if (ret != NULL)
+		return ret;
+
+	/* groups that multiply the generator once, such as those of
+	 * ephemeral keys, are not worth a comb */
+	CRYPTO_w_lock(CRYPTO_LOCK_EC_PRE_COMP);
+	build = ++g->comb_uses >= EC_COMB_MIN_USES;
+	CRYPTO_w_unlock(CRYPTO_LOCK_EC_PRE_COMP);
+	if (!build)
+		return NULL;
+
+	/* build it unlocked: threads that race here build one each, and all
+	 * but the first are freed */
+	if ((comb = ec_comb_new(group, ctx)) == NULL)
+		return NULL;
+	CRYPTO_w_lock(CRYPTO_LOCK_EC_PRE_COMP);
+	if (g->comb == NULL)
+		{
+		g->comb = comb;
+		comb = NULL;
+		}
+	ret = g->comb;
+	CRYPTO_w_unlock(CRYPTO_LOCK_EC_PRE_COMP);
+	if (comb != NULL)
+		ec_comb_free(comb);
+	return ret;
+	}
+
+/* Sets  r := a  if 'pick' is 1 and leaves it if 'pick' is 0, going
+ * through the same 'words' words of both either way; 'r' must have room
+ * for them */
+static void ec_comb_pick(BIGNUM *r, const BIGNUM *a, BN_ULONG pick, int words)
+	{
+	BN_ULONG mask = (BN_ULONG)0 - pick, v, w;
+	int i;
+
+	for (i = 0; i < words; i++)
+		{
+		v = i < r->top ? r->d[i] : 0;
+		w = i < a->top ? a->d[i] : 0;
+		r->d[i] = (v & ~mask) | (w & mask);
+		}
+	r->top = words;
+	bn_correct_top(r);
+	}
+
+/* 1 if 'a' is 0, else 0, without a branch */
+#define EC_COMB_IS_ZERO(a) \
+	((((a) | ((BN_ULONG)0 - (a))) >> (BN_BITS2 - 1)) ^ 1)
+
+/* Sets the X and Y of 'entry' to those of entry 'j' of the table of comb
+ * 's', reading every entry */
+static void ec_comb_lookup(const EC_COMB *comb, EC_POINT *entry, size_t s,
+	BN_ULONG j)
+	{
+	size_t per_comb = ((size_t)1 << comb->teeth) - 1, e;
+	int i, words = comb->words;
+	BN_ULONG *x = entry->X.d, *y = entry->Y.d, mask;
+	const BN_ULONG *t = comb->coords + s * per_comb * 2 * words;
+
+	for (i = 0; i < words; i++)
+		x[i] = y[i] = 0;
+	for (e = 1; e <= per_comb; e++, t += 2 * words)
+		{
+		mask = (BN_ULONG)0 - EC_COMB_IS_ZERO((BN_ULONG)e ^ j);
+		for (i = 0; i < words; i++)
+			{
+			x[i] |= t[i] & mask;
+			y[i] |= t[words + i] & mask;
+			}
+		}
+	entry->X.top = words;
+	bn_correct_top(&entry->X);
+	entry->Y.top = words;
+	bn_correct_top(&entry->Y);
+	}
+
+/* Computes  r := scalar * generator  with the comb of the generator,
+ * for  0 <= scalar < 2^(teeth * spacing) */
+static int ec_comb_mul(const EC_GROUP *group, const EC_COMB *comb,
+	EC_POINT *r, const BIGNUM *scalar, BN_CTX *ctx)
+	{
+	size_t per_comb = ((size_t)1 << comb->teeth) - 1;
+	size_t num = comb->combs * per_comb;
+	size_t i, k, s, bit;
+	BN_ULONG j, zero;
+	EC_POINT *acc = NULL, *entry = NULL, *sum = NULL;
+	int words = comb->words, ret = 0;
+
+	if ((acc = EC_POINT_new(group)) == NULL
+		|| (entry = EC_POINT_new(group)) == NULL
+		|| (sum = EC_POINT_new(group)) == NULL)
+		goto err;
+	/* the entries are affine: only their X and Y are picked */
+	if (!EC_POINT_copy(acc, comb->points[num])
+		|| !EC_POINT_copy(entry, comb->points[0]))
+		goto err;
+	if (bn_wexpand(&acc->X, words) == NULL
+		|| bn_wexpand(&acc->Y, words) == NULL
+		|| bn_wexpand(&acc->Z, words) == NULL
+		|| bn_wexpand(&entry->X, words) == NULL
+		|| bn_wexpand(&entry->Y, words) == NULL)
+		goto err;
+
+	for (i = comb->columns; i-- > 0; )
+		{
+		if (i + 1 < comb->columns)
+			{
+			if (!EC_POINT_dbl(group, acc, acc, ctx)) goto err;
+			}
+
+		for (s = 0; s < comb->combs; s++)
+			{
+			bit = s * comb->columns + i;
+			if (bit >= comb->spacing)
+				continue;
+
+			j = 0;
+			for (k = comb->teeth; k-- > 0; )
+				j = (j << 1) | BN_is_bit_set(scalar, (int)(k * comb->spacing + bit));
+			/* a block of zeros adds entry 1 and drops the sum */
+			zero = EC_COMB_IS_ZERO(j);
+			j |= zero;
+
+			ec_comb_lookup(comb, entry, s, j);
+
+			if (!EC_POINT_add(group, sum, acc, entry, ctx)) goto err;
+			if (bn_wexpand(&sum->X, words) == NULL
+				|| bn_wexpand(&sum->Y, words) == NULL
+				|| bn_wexpand(&sum->Z, words) == NULL)
+				goto err;
+			ec_comb_pick(&acc->X, &sum->X, zero ^ 1, words);
+			ec_comb_pick(&acc->Y, &sum->Y, zero ^ 1, words);
+			ec_comb_pick(&acc->Z, &sum->Z, zero ^ 1, words);
+			/* kept sum or not, the next operation takes the same
+			 * path */
+			acc->Z_is_one = 0;
+			}
+		}
+
+	/* take the offset off */
+	ret = EC_POINT_add(group, r, acc, comb->points[num + 1], ctx);
+
+ err:
+	if (acc)
+		EC_POINT_clear_free(acc);
+	if (entry)
+		EC_POINT_clear_free(entry);
+	if (sum)
+		EC_POINT_clear_free(sum);
+	return ret;
+	}
+
+void ec_group_copy_comb(EC_GROUP *dest, const EC_GROUP *src)
+	{
+	EC_COMB *comb;
+
+	ec_group_free_comb(dest);
+
+	CRYPTO_r_lock(CRYPTO_LOCK_EC_PRE_COMP);
+	comb = src->comb;
+	CRYPTO_r_unlock(CRYPTO_LOCK_EC_PRE_COMP);
+	if (comb == NULL)
+		return;
+
+	/* no need to actually copy, combs never change */
+	CRYPTO_add(&comb->references, 1, CRYPTO_LOCK_EC_PRE_COMP);
+	dest->comb = comb;
+	}
+
+void ec_group_free_comb(EC_GROUP *group)
+	{
+	ec_comb_free(group->comb);
+	group->comb = NULL;
+	group->comb_uses = 0;
+	}
+
+
+
+
 /* Determine the modified width-(w+1) Non-Adjacent Form (wNAF) of 'scalar'.
  * This is an array  r[]  of values that are either zero or odd with an
  * absolute value less than  2^w  satisfying
@@ -339,11 +748,202 @@ static signed char *compute_wNAF(const BIGNUM *scalar, int w, size_t *ret_len)
 		  (b) >=   20 ? 2 : \
 		  1))
 
+/* Pippenger's bucket method, for sums of many multiples: with windows of
+ * c bits, each window drops every point into one of 2^(c-1) buckets by
+ * its signed digit and sums the buckets with 2^c additions.  A point thus
+ * costs about one addition per window and no precomputation, where the
+ * interleaved wNAF of ec_wNAF_mul() costs one per w+1 bits plus 2^(w-1)
+ * precomputed multiples, so buckets win once the 2^c additions of a
+ * window are shared by enough points.
+ *
+ * Only methods without a 'mul' of their own get here: P-256 with
+ * EC_GFp_nistz256_method() always takes ecp_nistz256_points_mul(). */
+#define EC_PIPPENGER_MIN_POINTS	128
+
+/* the window size with the fewest additions for 'num' points of 'bits' */
+static size_t ec_pippenger_window_bits(size_t num, size_t bits)
+	{
+	size_t c, best = 1, cost, best_cost = 0;
+
+	for (c = 1; c <= 16; c++)
+		{
+		cost = (bits / c + 1) * (num + ((size_t)1 << c));
+		if (c == 1 || cost < best_cost)
+			{
+			best = c;
+			best_cost = cost;
+			}
+		}
+	return best;
+	}
+
+/* Computes  r := \sum scalars[i]*points[i] + scalar*generator  with
+ * buckets, for any number of points; 'ctx' must not be NULL.
+ *
+ * The digits live in a BIGNUM from 'ctx', so a caller passing the same
+ * BN_CTX reuses their storage, and all the points used (affine copies of
+ * the inputs, the buckets and two sums) are set up in place in a single
+ * block, so the scratch takes two allocations however many points. */
+static int ec_pippenger_mul(const EC_GROUP *group, EC_POINT *r,
+	const BIGNUM *scalar, size_t num, const EC_POINT *points[],
+	const BIGNUM *scalars[], BN_CTX *ctx)
+	{
+	const EC_POINT *generator = NULL;
+	const BIGNUM *k;
+	BIGNUM *scratch;
+	EC_POINT *pool = NULL; /* the affine points, the buckets, sum and acc */
+	EC_POINT **val = NULL, *bucket, *sum, *acc;
+	int *digits = NULL, d, carry;
+	size_t n, c, half, numwin, bits = 0, i, j, w, b, npool = 0, words = 0;
+	int ret = 0;
+
+	n = num + (scalar != NULL);
+	if (scalar != NULL)
+		{
+		generator = EC_GROUP_get0_generator(group);
+		if (generator == NULL)
+			{
+			ECerr(EC_F_EC_PIPPENGER_MUL, EC_R_UNDEFINED_GENERATOR);
+			return 0;
+			}
+		}
+
+	for (i = 0; i < n; i++)
+		{
+		k = i < num ? scalars[i] : scalar;
+		if ((size_t)BN_num_bits(k) > bits)
+			bits = BN_num_bits(k);
+		}
+	c = ec_pippenger_window_bits(n, bits);
+	half = (size_t)1 << (c - 1);
+	/* the last window takes the carry out of the top one */
+	numwin = bits / c + 1;
+
+	BN_CTX_start(ctx);
+	words = (n * numwin * sizeof digits[0] + sizeof(BN_ULONG) - 1) / sizeof(BN_ULONG);
+	if ((scratch = BN_CTX_get(ctx)) == NULL || bn_wexpand(scratch, (int)words) == NULL)
+		{
+		words = 0;
+		goto err;
+		}
+	/* Signed digits: window w of point i is digits[i * numwin + w], in
+	 * [-(2^(c-1) - 1), 2^(c-1)], and the windows add up to the scalar. */
+	digits = (int *)scratch->d;
+
+	pool = OPENSSL_malloc((n + half + 2) * sizeof pool[0]);
+	val = OPENSSL_malloc(n * sizeof val[0]);
+	if (pool == NULL || val == NULL)
+		{
+		ECerr(EC_F_EC_PIPPENGER_MUL, ERR_R_MALLOC_FAILURE);
+		goto err;
+		}
+	for (npool = 0; npool < n + half + 2; npool++)
+		{
+		pool[npool].meth = group->meth;
+		if (!group->meth->point_init(&pool[npool]))
+			goto err;
+		}
+	for (i = 0; i < n; i++)
+		val[i] = &pool[i];
+	bucket = pool + n;
+	sum = bucket + half;
+	acc = sum + 1;
+
+	for (i = 0; i < n; i++)
+		{
+		k = i < num ? scalars[i] : scalar;
+		carry = 0;
+		for (w = 0; w < numwin; w++)
+			{
+			d = carry;
+			for (j = c; j-- > 0; )
+				d += BN_is_bit_set(k, (int)(w * c + j)) << j;
+			carry = d > (int)half;
+			if (carry)
+				d -= 1 << c;
+			digits[i * numwin + w] = BN_is_negative(k) ? -d : d;
+			}
+		}
+
+	for (i = 0; i < n; i++)
+		{
+		if (!EC_POINT_copy(val[i], i < num ? points[i] : generator)) goto err;
+		}
+	if (!EC_POINTs_make_affine(group, n, val, ctx))
+		goto err;
+
+	if (!EC_POINT_set_to_infinity(group, r)) goto err;
+
+	for (w = numwin; w-- > 0; )
+		{
+		if (w != numwin - 1)
+			{
+			for (j = 0; j < c; j++)
+				{
+				if (!EC_POINT_dbl(group, r, r, ctx)) goto err;
+				}
+			}
+
+		for (b = 0; b < half; b++)
+			{
+			if (!EC_POINT_set_to_infinity(group, &bucket[b])) goto err;
+			}
+		for (i = 0; i < n; i++)
+			{
+			d = digits[i * numwin + w];
+			if (d > 0)
+				{
+				if (!EC_POINT_add(group, &bucket[d - 1], &bucket[d - 1], val[i], ctx)) goto err;
+				}
+			else if (d < 0)
+				{
+				/* bucket - P = -(-bucket + P), which saves keeping -P */
+				if (!EC_POINT_invert(group, &bucket[-d - 1], ctx)) goto err;
+				if (!EC_POINT_add(group, &bucket[-d - 1], &bucket[-d - 1], val[i], ctx)) goto err;
+				if (!EC_POINT_invert(group, &bucket[-d - 1], ctx)) goto err;
+				}
+			}
+
+		/* acc := \sum (b + 1) * bucket[b], as a sum of running sums */
+		if (!EC_POINT_set_to_infinity(group, sum)) goto err;
+		if (!EC_POINT_set_to_infinity(group, acc)) goto err;
+		for (b = half; b-- > 0; )
+			{
+			if (!EC_POINT_add(group, sum, sum, &bucket[b], ctx)) goto err;
+			if (!EC_POINT_add(group, acc, acc, sum, ctx)) goto err;
+			}
+		if (!EC_POINT_add(group, r, r, acc, ctx)) goto err;
+		}
+
+	ret = 1;
+
+ err:
+	if (pool != NULL)
+		{
+		for (i = 0; i < npool; i++)
+			{
+			if (group->meth->point_clear_finish != 0)
+				group->meth->point_clear_finish(&pool[i]);
+			else if (group->meth->point_finish != 0)
+				group->meth->point_finish(&pool[i]);
+			}
+		OPENSSL_cleanse(pool, (n + half + 2) * sizeof pool[0]);
+		OPENSSL_free(pool);
+		}
+	if (val != NULL)
+		OPENSSL_free(val);
+	if (words != 0)
+		OPENSSL_cleanse(scratch->d, words * sizeof(BN_ULONG));
+	BN_CTX_end(ctx);
+	return ret;
+	}
+
 /* Compute
  *      \sum scalars[i]*points[i],
  * also including
  *      scalar*generator
- * in the addition if scalar != NULL
+ * in the addition if scalar != NULL: with the interleaved wNAFs of all
+ * the scalars (Straus), or with ec_pippenger_mul() for many points
  */
 int ec_wNAF_mul(const EC_GROUP *group, EC_POINT *r, const BIGNUM *scalar,
 	size_t num, const EC_POINT *points[], const BIGNUM *scalars[], BN_CTX *ctx)
@@ -398,6 +998,29 @@ int ec_wNAF_mul(const EC_GROUP *group, EC_POINT *r, const BIGNUM *scalar,
 			goto err;
 		}
 
+	if ((scalar != NULL) && (num == 0) && (group->curve_name != 0)
+		&& !BN_is_negative(scalar))
+		{
+		/* the generator of a named curve alone: use its comb, unless
+		 * the application precomputed multiples for wNAF splitting */
+		const EC_COMB *comb = NULL;
+
+		if (!ec_wNAF_have_precompute_mult(group))
+			comb = ec_comb_get(group, ctx);
+
+		if (comb && ((size_t)BN_num_bits(scalar) <= comb->teeth * comb->spacing))
+			{
+			ret = ec_comb_mul(group, comb, r, scalar, ctx);
+			goto err;
+			}
+		}
+
+	if (num + (scalar != NULL) >= EC_PIPPENGER_MIN_POINTS)
+		{
+		ret = ec_pippenger_mul(group, r, scalar, num, points, scalars, ctx);
+		goto err;
+		}
+
 	if (scalar != NULL)
 		{
 		generator = EC_GROUP_get0_generator(group);
@@ -443,16 +1066,17 @@ int ec_wNAF_mul(const EC_GROUP *group, EC_POINT *r, const BIGNUM *scalar,
 	
 	totalnum = num + numblocks;
 
-	wsize    = OPENSSL_malloc(totalnum * sizeof wsize[0]);
-	wNAF_len = OPENSSL_malloc(totalnum * sizeof wNAF_len[0]);
-	wNAF     = OPENSSL_malloc((totalnum + 1) * sizeof wNAF[0]); /* includes space for pivot */
-	val_sub  = OPENSSL_malloc(totalnum * sizeof val_sub[0]);
-		 
-	if (!wsize || !wNAF_len || !wNAF || !val_sub)
+	/* one allocation for the four per-scalar tables */
+	wsize = OPENSSL_malloc(totalnum * (sizeof wsize[0] + sizeof wNAF_len[0] + sizeof val_sub[0])
+		+ (totalnum + 1) * sizeof wNAF[0]);
+	if (!wsize)
 		{
 		ECerr(EC_F_EC_WNAF_MUL, ERR_R_MALLOC_FAILURE);
 		goto err;
 		}
+	wNAF_len = wsize + totalnum;
+	val_sub  = (EC_POINT ***)(wNAF_len + totalnum);
+	wNAF     = (signed char **)(val_sub + totalnum); /* includes space for pivot */
 
 	wNAF[0] = NULL;	/* preliminary pivot */
 
@@ -717,19 +1341,15 @@ int ec_wNAF_mul(const EC_GROUP *group, EC_POINT *r, const BIGNUM *scalar,
 		BN_CTX_free(new_ctx);
 	if (tmp != NULL)
 		EC_POINT_free(tmp);
-	if (wsize != NULL)
-		OPENSSL_free(wsize);
-	if (wNAF_len != NULL)
-		OPENSSL_free(wNAF_len);
 	if (wNAF != NULL)
 		{
 		signed char **w;
 		
 		for (w = wNAF; *w != NULL; w++)
 			OPENSSL_free(*w);
-		
-		OPENSSL_free(wNAF);
 		}
+	if (wsize != NULL)
+		OPENSSL_free(wsize);
 	if (val != NULL)
 		{
 		for (v = val; *v != NULL; v++)
@@ -737,10 +1357,6 @@ int ec_wNAF_mul(const EC_GROUP *group, EC_POINT *r, const BIGNUM *scalar,
 
 		OPENSSL_free(val);
 		}
-	if (val_sub != NULL)
-		{
-		OPENSSL_free(val_sub);
-		}
 	return ret;
 	}
 
@@ -0,0 +1,931 @@
+/* crypto/ec/ecp_nistz256.c */
+/* ====================================================================
+ * Copyright (c) 2014 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ */
+
+/* A constant-time implementation of NIST P-256 for 64-bit processors
+ * with an assembler module for the field arithmetic.
+ *
+ * The field elements are four 64-bit limbs in the Montgomery domain with
+ * R = 2^256, which is where the EC_GFp_mont_method() keeps the coordinates
+ * of points, so the points of a group go in and out of here without a
+ * conversion. The arithmetic modulo p is in asm/ecp_nistz256-x86_64.pl,
+ * the point arithmetic on Jacobian coordinates is here.
+ *
+ * Scalars are recoded in signed windows (Booth encoding), and the table
+ * entry of each window is gathered by reading the whole table and keeping
+ * one entry by masking, so neither branches nor memory accesses depend on
+ * the scalar. Multiples of arbitrary points use 5-bit windows over a table
+ * of 16 points each; multiples of the generator use 7-bit windows over
+ * a static table of 37 x 64 affine points (ecp_nistz256_table.c), which
+ * needs additions only. */
+
+#include <string.h>
+
+#include <openssl/err.h>
+#include "ec_lcl.h"
+
+#ifdef ECP_NISTZ256_ASM
+
+#if BN_BITS2 != 64
+# error "ecp_nistz256.c needs 64-bit limbs"
+#endif
+
+#define TOBN(hi,lo)	((BN_ULONG)hi<<32|lo)
+
+#define P256_LIMBS	(256/BN_BITS2)
+
+typedef struct {
+	BN_ULONG X[P256_LIMBS];
+	BN_ULONG Y[P256_LIMBS];
+	BN_ULONG Z[P256_LIMBS];
+} P256_POINT;
+
+typedef struct {
+	BN_ULONG X[P256_LIMBS];
+	BN_ULONG Y[P256_LIMBS];
+} P256_POINT_AFFINE;
+
+#include "ecp_nistz256_table.c"
+
+/* R mod p, i.e. one in the Montgomery domain */
+static const BN_ULONG ONE[P256_LIMBS] = {
+	TOBN(0x00000000, 0x00000001), TOBN(0xffffffff, 0x00000000),
+	TOBN(0xffffffff, 0xffffffff), TOBN(0x00000000, 0xfffffffe) };
+
+/* Functions implemented in assembly; all of them take and return values
+ * reduced modulo p and allow the result to alias an input. */
+/* res = a * b / R mod p */
+void ecp_nistz256_mul_mont(BN_ULONG res[P256_LIMBS],
+	const BN_ULONG a[P256_LIMBS], const BN_ULONG b[P256_LIMBS]);
+/* res = a * a / R mod p */
+void ecp_nistz256_sqr_mont(BN_ULONG res[P256_LIMBS],
+	const BN_ULONG a[P256_LIMBS]);
+/* res = a / R mod p */
+void ecp_nistz256_from_mont(BN_ULONG res[P256_LIMBS],
+	const BN_ULONG a[P256_LIMBS]);
+/* res = a + b mod p */
+void ecp_nistz256_add(BN_ULONG res[P256_LIMBS],
+	const BN_ULONG a[P256_LIMBS], const BN_ULONG b[P256_LIMBS]);
+/* res = a - b mod p */
+void ecp_nistz256_sub(BN_ULONG res[P256_LIMBS],
+	const BN_ULONG a[P256_LIMBS], const BN_ULONG b[P256_LIMBS]);
+/* res = a / 2 mod p */
+void ecp_nistz256_div_by_2(BN_ULONG res[P256_LIMBS],
+	const BN_ULONG a[P256_LIMBS]);
+
+static void ecp_nistz256_neg(BN_ULONG res[P256_LIMBS],
+	const BN_ULONG a[P256_LIMBS])
+	{
+	static const BN_ULONG zero[P256_LIMBS] = { 0 };
+
+	ecp_nistz256_sub(res, zero, a);
+	}
+
+static void ecp_nistz256_mul_by_2(BN_ULONG res[P256_LIMBS],
+	const BN_ULONG a[P256_LIMBS])
+	{
+	ecp_nistz256_add(res, a, a);
+	}
+
+static void ecp_nistz256_mul_by_3(BN_ULONG res[P256_LIMBS],
+	const BN_ULONG a[P256_LIMBS])
+	{
+	BN_ULONG t[P256_LIMBS];
+
+	ecp_nistz256_add(t, a, a);
+	ecp_nistz256_add(res, t, a);
+	}
+
+/* 1 if a is zero, else 0 */
+static BN_ULONG is_zero(const BN_ULONG a[P256_LIMBS])
+	{
+	BN_ULONG res;
+
+	res = a[0] | a[1] | a[2] | a[3];
+	/* the top bit of ~res & (res - 1) is set only if res is zero */
+	return (~res & (res - 1)) >> (BN_BITS2 - 1);
+	}
+
+/* 1 if a == b, else 0 */
+static BN_ULONG is_equal(const BN_ULONG a[P256_LIMBS],
+	const BN_ULONG b[P256_LIMBS])
+	{
+	BN_ULONG res[P256_LIMBS];
+
+	res[0] = a[0] ^ b[0];
+	res[1] = a[1] ^ b[1];
+	res[2] = a[2] ^ b[2];
+	res[3] = a[3] ^ b[3];
+	return is_zero(res);
+	}
+
+/* dst = src if move is 1, dst unchanged if move is 0 */
+static void copy_conditional(BN_ULONG dst[P256_LIMBS],
+	const BN_ULONG src[P256_LIMBS], BN_ULONG move)
+	{
+	BN_ULONG mask1 = 0 - move;
+	BN_ULONG mask2 = ~mask1;
+	int i;
+
+	for (i = 0; i < P256_LIMBS; i++)
+		dst[i] = (src[i] & mask1) ^ (dst[i] & mask2);
+	}
+
+/* All ones if a == b, else zero */
+static BN_ULONG mask_equal(BN_ULONG a, BN_ULONG b)
+	{
+	BN_ULONG res = a ^ b;
+
+	return 0 - ((~res & (res - 1)) >> (BN_BITS2 - 1));
+	}
+
+/* res = a^(2^n) / R^(2^n - 1) mod p, i.e. n squarings */
+static void ecp_nistz256_sqr_n(BN_ULONG res[P256_LIMBS],
+	const BN_ULONG a[P256_LIMBS], int n)
+	{
+	ecp_nistz256_sqr_mont(res, a);
+	while (--n > 0)
+		ecp_nistz256_sqr_mont(res, res);
+	}
+
+/* res = 1/a in the Montgomery domain, as a^(p-2) with a fixed chain:
+ * p - 2 = ffffffff00000001 0000000000000000 00000000ffffffff
+ *	fffffffffffffffd */
+static void ecp_nistz256_mod_inverse(BN_ULONG res[P256_LIMBS],
+	const BN_ULONG a[P256_LIMBS])
+	{
+	BN_ULONG p2[P256_LIMBS], p4[P256_LIMBS], p8[P256_LIMBS];
+	BN_ULONG p16[P256_LIMBS], p32[P256_LIMBS], t[P256_LIMBS];
+
+	/* pN = a^(2^N - 1) */
+	ecp_nistz256_sqr_mont(t, a);
+	ecp_nistz256_mul_mont(p2, t, a);
+	ecp_nistz256_sqr_n(t, p2, 2);
+	ecp_nistz256_mul_mont(p4, t, p2);
+	ecp_nistz256_sqr_n(t, p4, 4);
+	ecp_nistz256_mul_mont(p8, t, p4);
+	ecp_nistz256_sqr_n(t, p8, 8);
+	ecp_nistz256_mul_mont(p16, t, p8);
+	ecp_nistz256_sqr_n(t, p16, 16);
+	ecp_nistz256_mul_mont(p32, t, p16);
+
+	ecp_nistz256_sqr_n(t, p32, 32);
+	ecp_nistz256_mul_mont(t, t, a);		/* ffffffff00000001 */
+	ecp_nistz256_sqr_n(t, t, 128);
+	ecp_nistz256_mul_mont(t, t, p32);	/* ... 00000000ffffffff */
+	ecp_nistz256_sqr_n(t, t, 32);
+	ecp_nistz256_mul_mont(t, t, p32);	/* ... ffffffff */
+	ecp_nistz256_sqr_n(t, t, 16);
+	ecp_nistz256_mul_mont(t, t, p16);	/* ... ffffffffffff */
+	ecp_nistz256_sqr_n(t, t, 8);
+	ecp_nistz256_mul_mont(t, t, p8);	/* ... ffffffffffffff */
+	ecp_nistz256_sqr_n(t, t, 4);
+	ecp_nistz256_mul_mont(t, t, p4);	/* ... fffffffffffffff */
+	ecp_nistz256_sqr_n(t, t, 2);
+	ecp_nistz256_mul_mont(t, t, p2);	/* ... fffffffffffffff(11) */
+	ecp_nistz256_sqr_n(t, t, 2);
+	ecp_nistz256_mul_mont(res, t, a);	/* ... fffffffffffffffd */
+	}
+
+/* Point arithmetic on Jacobian coordinates (X/Z^2, Y/Z^3) for a = -3.
+ * The point at infinity has Z == 0, and an affine point is at infinity
+ * if its X and Y are both zero. */
+
+/* r = 2*a; r may be a */
+static void ecp_nistz256_point_double(P256_POINT *r, const P256_POINT *a)
+	{
+	BN_ULONG S[P256_LIMBS];
+	BN_ULONG M[P256_LIMBS];
+	BN_ULONG Zsqr[P256_LIMBS];
+	BN_ULONG tmp0[P256_LIMBS];
+
+	/* S = 4*X*Y^2, M = 3*(X - Z^2)*(X + Z^2),
+	 * X' = M^2 - 2*S, Y' = M*(S - X') - 8*Y^4, Z' = 2*Y*Z */
+	ecp_nistz256_mul_by_2(S, a->Y);
+	ecp_nistz256_sqr_mont(Zsqr, a->Z);
+
+	ecp_nistz256_sqr_mont(S, S);
+
+	ecp_nistz256_mul_mont(r->Z, a->Z, a->Y);
+	ecp_nistz256_mul_by_2(r->Z, r->Z);
+
+	ecp_nistz256_add(M, a->X, Zsqr);
+	ecp_nistz256_sub(Zsqr, a->X, Zsqr);
+
+	ecp_nistz256_sqr_mont(r->Y, S);
+	ecp_nistz256_div_by_2(r->Y, r->Y);
+
+	ecp_nistz256_mul_mont(M, M, Zsqr);
+	ecp_nistz256_mul_by_3(M, M);
+
+	ecp_nistz256_mul_mont(S, S, a->X);
+	ecp_nistz256_mul_by_2(tmp0, S);
+
+	ecp_nistz256_sqr_mont(r->X, M);
+	ecp_nistz256_sub(r->X, r->X, tmp0);
+
+	ecp_nistz256_sub(S, S, r->X);
+	ecp_nistz256_mul_mont(S, S, M);
+	ecp_nistz256_sub(r->Y, S, r->Y);
+	}
+
+/* r = a + b; r may be a or b */
+static void ecp_nistz256_point_add(P256_POINT *r,
+	const P256_POINT *a, const P256_POINT *b)
+	{
+	BN_ULONG U2[P256_LIMBS], S2[P256_LIMBS];
+	BN_ULONG U1[P256_LIMBS], S1[P256_LIMBS];
+	BN_ULONG Z1sqr[P256_LIMBS];
+	BN_ULONG Z2sqr[P256_LIMBS];
+	BN_ULONG H[P256_LIMBS], R[P256_LIMBS];
+	BN_ULONG Hsqr[P256_LIMBS];
+	BN_ULONG Rsqr[P256_LIMBS];
+	BN_ULONG Hcub[P256_LIMBS];
+	BN_ULONG res_x[P256_LIMBS];
+	BN_ULONG res_y[P256_LIMBS];
+	BN_ULONG res_z[P256_LIMBS];
+	BN_ULONG in1infty, in2infty;
+
+	in1infty = is_zero(a->Z);
+	in2infty = is_zero(b->Z);
+
+	ecp_nistz256_sqr_mont(Z2sqr, b->Z);
+	ecp_nistz256_sqr_mont(Z1sqr, a->Z);
+
+	ecp_nistz256_mul_mont(S1, Z2sqr, b->Z);
+	ecp_nistz256_mul_mont(S2, Z1sqr, a->Z);
+
+	ecp_nistz256_mul_mont(S1, S1, a->Y);	/* S1 = Y1*Z2^3 */
+	ecp_nistz256_mul_mont(S2, S2, b->Y);	/* S2 = Y2*Z1^3 */
+	ecp_nistz256_sub(R, S2, S1);
+
+	ecp_nistz256_mul_mont(U1, a->X, Z2sqr);	/* U1 = X1*Z2^2 */
+	ecp_nistz256_mul_mont(U2, b->X, Z1sqr);	/* U2 = X2*Z1^2 */
+	ecp_nistz256_sub(H, U2, U1);
+
+	/* The formulas do not work for a == b, nor, harmlessly, for
+	 * a == -b. Neither happens in a multiplication by a scalar below
+	 * the order but by chance, so the branch gives nothing away. */
+	if (is_equal(U1, U2) && !in1infty && !in2infty)
+		{
+		if (is_equal(S1, S2))
+			{
+			ecp_nistz256_point_double(r, a);
+			return;
+			}
+		memset(r, 0, sizeof(*r));
+		return;
+		}
+
+	ecp_nistz256_sqr_mont(Rsqr, R);
+	ecp_nistz256_mul_mont(res_z, H, a->Z);
+	ecp_nistz256_sqr_mont(Hsqr, H);
+	ecp_nistz256_mul_mont(res_z, res_z, b->Z);	/* Z3 = H*Z1*Z2 */
+	ecp_nistz256_mul_mont(Hcub, Hsqr, H);
+
+	ecp_nistz256_mul_mont(U2, U1, Hsqr);
+	ecp_nistz256_mul_by_2(Hsqr, U2);
+
+	ecp_nistz256_sub(res_x, Rsqr, Hsqr);
+	ecp_nistz256_sub(res_x, res_x, Hcub);	/* X3 = R^2 - H^3 - 2*U1*H^2 */
+
+	ecp_nistz256_sub(res_y, U2, res_x);
+
+	ecp_nistz256_mul_mont(S2, S1, Hcub);
+	ecp_nistz256_mul_mont(res_y, R, res_y);
+	ecp_nistz256_sub(res_y, res_y, S2);	/* Y3 = R*(U1*H^2 - X3) - S1*H^3 */
+
+	copy_conditional(res_x, b->X, in1infty);
+	copy_conditional(res_y, b->Y, in1infty);
+	copy_conditional(res_z, b->Z, in1infty);
+
+	copy_conditional(res_x, a->X, in2infty);
+	copy_conditional(res_y, a->Y, in2infty);
+	copy_conditional(res_z, a->Z, in2infty);
+
+	memcpy(r->X, res_x, sizeof(res_x));
+	memcpy(r->Y, res_y, sizeof(res_y));
+	memcpy(r->Z, res_z, sizeof(res_z));
+	}
+
+/* r = a + b for an affine b; r may be a */
+static void ecp_nistz256_point_add_affine(P256_POINT *r,
+	const P256_POINT *a, const P256_POINT_AFFINE *b)
+	{
+	BN_ULONG U2[P256_LIMBS], S2[P256_LIMBS];
+	BN_ULONG Z1sqr[P256_LIMBS];
+	BN_ULONG H[P256_LIMBS], R[P256_LIMBS];
+	BN_ULONG Hsqr[P256_LIMBS];
+	BN_ULONG Rsqr[P256_LIMBS];
+	BN_ULONG Hcub[P256_LIMBS];
+	BN_ULONG res_x[P256_LIMBS];
+	BN_ULONG res_y[P256_LIMBS];
+	BN_ULONG res_z[P256_LIMBS];
+	BN_ULONG in1infty, in2infty;
+
+	in1infty = is_zero(a->Z);
+	in2infty = is_zero(b->X) & is_zero(b->Y);
+
+	ecp_nistz256_sqr_mont(Z1sqr, a->Z);
+
+	ecp_nistz256_mul_mont(U2, b->X, Z1sqr);	/* U2 = X2*Z1^2 */
+	ecp_nistz256_sub(H, U2, a->X);
+
+	ecp_nistz256_mul_mont(S2, Z1sqr, a->Z);
+	ecp_nistz256_mul_mont(S2, S2, b->Y);	/* S2 = Y2*Z1^3 */
+	ecp_nistz256_sub(R, S2, a->Y);
+
+	/* as in ecp_nistz256_point_add() */
+	if (is_zero(H) && !in1infty && !in2infty)
+		{
+		if (is_zero(R))
+			{
+			ecp_nistz256_point_double(r, a);
+			return;
+			}
+		memset(r, 0, sizeof(*r));
+		return;
+		}
+
+	ecp_nistz256_mul_mont(res_z, H, a->Z);	/* Z3 = H*Z1 */
+
+	ecp_nistz256_sqr_mont(Hsqr, H);
+	ecp_nistz256_sqr_mont(Rsqr, R);
+	ecp_nistz256_mul_mont(Hcub, Hsqr, H);
+
+	ecp_nistz256_mul_mont(U2, a->X, Hsqr);
+	ecp_nistz256_mul_by_2(Hsqr, U2);
+
+	ecp_nistz256_sub(res_x, Rsqr, Hsqr);
+	ecp_nistz256_sub(res_x, res_x, Hcub);	/* X3 = R^2 - H^3 - 2*X1*H^2 */
+	ecp_nistz256_sub(H, U2, res_x);
+
+	ecp_nistz256_mul_mont(S2, a->Y, Hcub);
+	ecp_nistz256_mul_mont(H, H, R);
+	ecp_nistz256_sub(res_y, H, S2);		/* Y3 = R*(X1*H^2 - X3) - Y1*H^3 */
+
+	copy_conditional(res_x, b->X, in1infty);
+	copy_conditional(res_y, b->Y, in1infty);
+	copy_conditional(res_z, ONE, in1infty);
+
+	copy_conditional(res_x, a->X, in2infty);
+	copy_conditional(res_y, a->Y, in2infty);
+	copy_conditional(res_z, a->Z, in2infty);
+
+	memcpy(r->X, res_x, sizeof(res_x));
+	memcpy(r->Y, res_y, sizeof(res_y));
+	memcpy(r->Z, res_z, sizeof(res_z));
+	}
+
+/* val = table[index - 1], or the point at infinity if index is 0,
+ * reading every entry of the 16-entry table */
+static void ecp_nistz256_select_w5(P256_POINT *val,
+	const P256_POINT table[16], unsigned int index)
+	{
+	BN_ULONG mask;
+	int i, j;
+
+	memset(val, 0, sizeof(*val));
+	for (i = 0; i < 16; i++)
+		{
+		mask = mask_equal(index, i + 1);
+		for (j = 0; j < P256_LIMBS; j++)
+			{
+			val->X[j] |= table[i].X[j] & mask;
+			val->Y[j] |= table[i].Y[j] & mask;
+			val->Z[j] |= table[i].Z[j] & mask;
+			}
+		}
+	}
+
+/* as ecp_nistz256_select_w5() for a 64-entry table of affine points */
+static void ecp_nistz256_select_w7(P256_POINT_AFFINE *val,
+	const P256_POINT_AFFINE table[64], unsigned int index)
+	{
+	BN_ULONG mask;
+	int i, j;
+
+	memset(val, 0, sizeof(*val));
+	for (i = 0; i < 64; i++)
+		{
+		mask = mask_equal(index, i + 1);
+		for (j = 0; j < P256_LIMBS; j++)
+			{
+			val->X[j] |= table[i].X[j] & mask;
+			val->Y[j] |= table[i].Y[j] & mask;
+			}
+		}
+	}
+
+/* Booth recoding of a window of w bits and the bit below it into a digit
+ * in -2^(w-1)..2^(w-1): returns 2*|digit| + (digit < 0). */
+static unsigned int booth_recode(unsigned int in, int w)
+	{
+	unsigned int s, d;
+
+	s = ~((in >> w) - 1);		/* all ones if the top bit is set */
+	d = (1 << (w + 1)) - in - 1;
+	d = (d & s) | (in & ~s);
+	d = (d >> 1) + (d & 1);
+
+	return (d << 1) + (s & 1);
+	}
+
+/* bits index-1 .. index+w-1 of the little-endian p_str, bit -1 being 0 */
+static unsigned int get_window(const unsigned char *p_str, int index, int w)
+	{
+	unsigned int wvalue;
+	int off;
+
+	if (index == 0)
+		return (p_str[0] << 1) & ((1 << (w + 1)) - 1);
+
+	off = (index - 1) / 8;
+	wvalue = p_str[off] | p_str[off + 1] << 8;
+	return (wvalue >> ((index - 1) % 8)) & ((1 << (w + 1)) - 1);
+	}
+
+/* p_str = the scalar as 33 little-endian bytes, reduced modulo the order
+ * if it is negative or longer than 256 bits */
+static int ecp_nistz256_scalar_bytes(unsigned char p_str[33],
+	const BIGNUM *scalar, const EC_GROUP *group, BN_CTX *ctx)
+	{
+	BIGNUM *mod;
+	int i, j, started = 0, ret = 0;
+
+	if (BN_num_bits(scalar) > 256 || BN_is_negative(scalar))
+		{
+		BN_CTX_start(ctx);
+		started = 1;
+		if ((mod = BN_CTX_get(ctx)) == NULL)
+			goto err;
+		if (!BN_nnmod(mod, scalar, &group->order, ctx))
+			{
+			ECerr(EC_F_ECP_NISTZ256_POINTS_MUL, ERR_R_BN_LIB);
+			goto err;
+			}
+		scalar = mod;
+		}
+
+	memset(p_str, 0, 33);
+	for (i = 0; i < scalar->top; i++)
+		{
+		BN_ULONG d = scalar->d[i];
+
+		for (j = 0; j < BN_BYTES; j++)
+			{
+			p_str[i * BN_BYTES + j] = (unsigned char)d;
+			d >>= 8;
+			}
+		}
+	ret = 1;
+ err:
+	if (started)
+		BN_CTX_end(ctx);
+	return ret;
+	}
+
+/* r = sum of scalars[i]*points[i] in 5-bit windows, sharing the
+ * doublings between the points */
+static int ecp_nistz256_windowed_mul(const EC_GROUP *group, P256_POINT *r,
+	const P256_POINT *points, const BIGNUM **scalars, size_t num,
+	BN_CTX *ctx)
+	{
+	P256_POINT (*table)[16] = NULL;
+	unsigned char (*p_str)[33] = NULL;
+	P256_POINT temp, *row;
+	unsigned int wvalue;
+	size_t i;
+	int index, k, ret = 0;
+
+	table = OPENSSL_malloc(num * sizeof(*table));
+	p_str = OPENSSL_malloc(num * sizeof(*p_str));
+	if (table == NULL || p_str == NULL)
+		{
+		ECerr(EC_F_ECP_NISTZ256_POINTS_MUL, ERR_R_MALLOC_FAILURE);
+		goto err;
+		}
+
+	for (i = 0; i < num; i++)
+		{
+		if (!ecp_nistz256_scalar_bytes(p_str[i], scalars[i], group, ctx))
+			goto err;
+
+		/* row[k] = (k+1)*points[i] */
+		row = table[i];
+		memcpy(&row[0], &points[i], sizeof(P256_POINT));
+		for (k = 1; k < 16; k++)
+			{
+			if (k & 1)
+				ecp_nistz256_point_double(&row[k], &row[k / 2]);
+			else
+				ecp_nistz256_point_add(&row[k], &row[k - 1],
+					&points[i]);
+			}
+		}
+
+	/* the top window holds bits 254 and 255 only, so it is positive */
+	index = 255;
+	for (i = 0; i < num; i++)
+		{
+		wvalue = booth_recode(get_window(p_str[i], index, 5), 5);
+		ecp_nistz256_select_w5(&temp, table[i], wvalue >> 1);
+		if (i == 0)
+			memcpy(r, &temp, sizeof(temp));
+		else
+			ecp_nistz256_point_add(r, r, &temp);
+		}
+
+	while (index > 0)
+		{
+		index -= 5;
+		for (k = 0; k < 5; k++)
+			ecp_nistz256_point_double(r, r);
+
+		for (i = 0; i < num; i++)
+			{
+			BN_ULONG negY[P256_LIMBS];
+
+			wvalue = booth_recode(get_window(p_str[i], index, 5), 5);
+			ecp_nistz256_select_w5(&temp, table[i], wvalue >> 1);
+			ecp_nistz256_neg(negY, temp.Y);
+			copy_conditional(temp.Y, negY, wvalue & 1);
+			ecp_nistz256_point_add(r, r, &temp);
+			}
+		}
+
+	ret = 1;
+ err:
+	if (table != NULL)
+		{
+		OPENSSL_cleanse(table, num * sizeof(*table));
+		OPENSSL_free(table);
+		}
+	if (p_str != NULL)
+		{
+		OPENSSL_cleanse(p_str, num * sizeof(*p_str));
+		OPENSSL_free(p_str);
+		}
+	return ret;
+	}
+
+/* r = scalar*G in 7-bit windows over ecp_nistz256_precomputed */
+static int ecp_nistz256_mul_g(const EC_GROUP *group, P256_POINT *r,
+	const BIGNUM *scalar, BN_CTX *ctx)
+	{
+	const P256_POINT_AFFINE (*table)[64] =
+		(const P256_POINT_AFFINE (*)[64])ecp_nistz256_precomputed;
+	P256_POINT_AFFINE t;
+	BN_ULONG negY[P256_LIMBS];
+	unsigned char p_str[33];
+	unsigned int wvalue;
+	int i;
+
+	if (!ecp_nistz256_scalar_bytes(p_str, scalar, group, ctx))
+		return 0;
+
+	/* window i is digit*2^(7*i)*G, found in table[i] */
+	wvalue = booth_recode(get_window(p_str, 0, 7), 7);
+	ecp_nistz256_select_w7(&t, table[0], wvalue >> 1);
+	ecp_nistz256_neg(negY, t.Y);
+	copy_conditional(t.Y, negY, wvalue & 1);
+	memcpy(r->X, t.X, sizeof(t.X));
+	memcpy(r->Y, t.Y, sizeof(t.Y));
+	memcpy(r->Z, ONE, sizeof(ONE));
+	/* a zero digit gave the affine point at infinity, (0, 0) */
+	copy_conditional(r->Z, t.X, is_zero(t.X) & is_zero(t.Y));
+
+	for (i = 1; i < 37; i++)
+		{
+		wvalue = booth_recode(get_window(p_str, 7 * i, 7), 7);
+		ecp_nistz256_select_w7(&t, table[i], wvalue >> 1);
+		ecp_nistz256_neg(negY, t.Y);
+		copy_conditional(t.Y, negY, wvalue & 1);
+		ecp_nistz256_point_add_affine(r, r, &t);
+		}
+
+	OPENSSL_cleanse(p_str, sizeof(p_str));
+	return 1;
+	}
+
+/* Conversions between BIGNUMs and limbs; coordinates are reduced modulo
+ * p, so they fit. */
+static int bn_get_limbs(const BIGNUM *a, BN_ULONG out[P256_LIMBS])
+	{
+	if (a->top > P256_LIMBS)
+		return 0;
+
+	memset(out, 0, sizeof(BN_ULONG) * P256_LIMBS);
+	memcpy(out, a->d, sizeof(BN_ULONG) * a->top);
+	return 1;
+	}
+
+static int bn_set_limbs(BIGNUM *a, const BN_ULONG in[P256_LIMBS])
+	{
+	if (bn_wexpand(a, P256_LIMBS) == NULL)
+		return 0;
+
+	memcpy(a->d, in, sizeof(BN_ULONG) * P256_LIMBS);
+	a->top = P256_LIMBS;
+	a->neg = 0;
+	bn_correct_top(a);
+	return 1;
+	}
+
+static int ecp_nistz256_get_point(const EC_POINT *p, P256_POINT *out)
+	{
+	return bn_get_limbs(&p->X, out->X) &&
+		bn_get_limbs(&p->Y, out->Y) &&
+		bn_get_limbs(&p->Z, out->Z);
+	}
+
+/* 1 if the generator of group is the one of ecp_nistz256_precomputed */
+static int ecp_nistz256_is_standard_generator(const EC_GROUP *group)
+	{
+	const EC_POINT *generator = group->generator;
+	BN_ULONG x[P256_LIMBS], y[P256_LIMBS];
+
+	if (generator == NULL || !generator->Z_is_one ||
+		!bn_get_limbs(&generator->X, x) ||
+		!bn_get_limbs(&generator->Y, y))
+		return 0;
+
+	return is_equal(x, ecp_nistz256_precomputed[0]) &&
+		is_equal(y, ecp_nistz256_precomputed[0] + P256_LIMBS);
+	}
+
+static int ecp_nistz256_points_mul(const EC_GROUP *group, EC_POINT *r,
+	const BIGNUM *scalar, size_t num, const EC_POINT *points[],
+	const BIGNUM *scalars[], BN_CTX *ctx)
+	{
+	P256_POINT p, *new_points = NULL;
+	const BIGNUM **new_scalars = NULL;
+	BN_CTX *new_ctx = NULL;
+	size_t i, j;
+	int have_g = 0, ret = 0;
+
+	if (group->meth != r->meth)
+		{
+		ECerr(EC_F_ECP_NISTZ256_POINTS_MUL, EC_R_INCOMPATIBLE_OBJECTS);
+		return 0;
+		}
+	if (scalar == NULL && num == 0)
+		return EC_POINT_set_to_infinity(group, r);
+	for (i = 0; i < num; i++)
+		{
+		if (group->meth != points[i]->meth)
+			{
+			ECerr(EC_F_ECP_NISTZ256_POINTS_MUL, EC_R_INCOMPATIBLE_OBJECTS);
+			return 0;
+			}
+		}
+
+	if (ctx == NULL)
+		{
+		ctx = new_ctx = BN_CTX_new();
+		if (ctx == NULL)
+			goto err;
+		}
+
+	memset(&p, 0, sizeof(p));
+	if (scalar != NULL)
+		{
+		if (ecp_nistz256_is_standard_generator(group))
+			{
+			if (!ecp_nistz256_mul_g(group, &p, scalar, ctx))
+				goto err;
+			have_g = 1;
+			}
+		else if (group->generator == NULL)
+			{
+			ECerr(EC_F_ECP_NISTZ256_POINTS_MUL, EC_R_UNDEFINED_GENERATOR);
+			goto err;
+			}
+		}
+
+	/* a generator of its own is multiplied as any other point */
+	j = num + (scalar != NULL && !have_g);
+	if (j > 0)
+		{
+		P256_POINT acc;
+
+		new_points = OPENSSL_malloc(j * sizeof(P256_POINT));
+		new_scalars = OPENSSL_malloc(j * sizeof(BIGNUM *));
+		if (new_points == NULL || new_scalars == NULL)
+			{
+			ECerr(EC_F_ECP_NISTZ256_POINTS_MUL, ERR_R_MALLOC_FAILURE);
+			goto err;
+			}
+		for (i = 0; i < num; i++)
+			{
+			if (!ecp_nistz256_get_point(points[i], &new_points[i]))
+				{
+				ECerr(EC_F_ECP_NISTZ256_POINTS_MUL, EC_R_COORDINATES_OUT_OF_RANGE);
+				goto err;
+				}
+			new_scalars[i] = scalars[i];
+			}
+		if (i < j)
+			{
+			if (!ecp_nistz256_get_point(group->generator, &new_points[i]))
+				{
+				ECerr(EC_F_ECP_NISTZ256_POINTS_MUL, EC_R_COORDINATES_OUT_OF_RANGE);
+				goto err;
+				}
+			new_scalars[i] = scalar;
+			}
+
+		if (!ecp_nistz256_windowed_mul(group, &acc, new_points,
+				new_scalars, j, ctx))
+			goto err;
+
+		if (have_g)
+			ecp_nistz256_point_add(&p, &p, &acc);
+		else
+			memcpy(&p, &acc, sizeof(acc));
+		}
+
+	if (!bn_set_limbs(&r->X, p.X) ||
+		!bn_set_limbs(&r->Y, p.Y) ||
+		!bn_set_limbs(&r->Z, p.Z))
+		{
+		ECerr(EC_F_ECP_NISTZ256_POINTS_MUL, ERR_R_BN_LIB);
+		goto err;
+		}
+	r->Z_is_one = is_equal(p.Z, ONE) & 1;
+
+	ret = 1;
+ err:
+	if (new_points != NULL)
+		OPENSSL_free(new_points);
+	if (new_scalars != NULL)
+		OPENSSL_free(new_scalars);
+	if (new_ctx != NULL)
+		BN_CTX_free(new_ctx);
+	return ret;
+	}
+
+/* The affine coordinates of a point, with a constant-time inversion of Z
+ * where the generic method uses BN_mod_inverse() */
+static int ecp_nistz256_get_affine(const EC_GROUP *group,
+	const EC_POINT *point, BIGNUM *x, BIGNUM *y, BN_CTX *ctx)
+	{
+	BN_ULONG z_inv2[P256_LIMBS];
+	BN_ULONG z_inv3[P256_LIMBS];
+	BN_ULONG x_aff[P256_LIMBS];
+	BN_ULONG y_aff[P256_LIMBS];
+	P256_POINT p;
+
+	if (EC_POINT_is_at_infinity(group, point))
+		{
+		ECerr(EC_F_ECP_NISTZ256_GET_AFFINE, EC_R_POINT_AT_INFINITY);
+		return 0;
+		}
+
+	if (!ecp_nistz256_get_point(point, &p))
+		{
+		ECerr(EC_F_ECP_NISTZ256_GET_AFFINE, EC_R_COORDINATES_OUT_OF_RANGE);
+		return 0;
+		}
+
+	/* Already affine, e.g. after EC_POINTs_make_affine(): no inversion */
+	if (point->Z_is_one)
+		{
+		if (x != NULL)
+			{
+			ecp_nistz256_from_mont(x_aff, p.X);
+			if (!bn_set_limbs(x, x_aff))
+				return 0;
+			}
+		if (y != NULL)
+			{
+			ecp_nistz256_from_mont(y_aff, p.Y);
+			if (!bn_set_limbs(y, y_aff))
+				return 0;
+			}
+		return 1;
+		}
+
+	ecp_nistz256_mod_inverse(z_inv3, p.Z);
+	ecp_nistz256_sqr_mont(z_inv2, z_inv3);
+	ecp_nistz256_mul_mont(x_aff, z_inv2, p.X);
+
+	if (x != NULL)
+		{
+		ecp_nistz256_from_mont(x_aff, x_aff);
+		if (!bn_set_limbs(x, x_aff))
+			return 0;
+		}
+
+	if (y != NULL)
+		{
+		ecp_nistz256_mul_mont(z_inv3, z_inv3, z_inv2);
+		ecp_nistz256_mul_mont(y_aff, z_inv3, p.Y);
+		ecp_nistz256_from_mont(y_aff, y_aff);
+		if (!bn_set_limbs(y, y_aff))
+			return 0;
+		}
+
+	return 1;
+	}
+
+static int ecp_nistz256_have_precompute_mult(const EC_GROUP *group)
+	{
+	return ecp_nistz256_is_standard_generator(group);
+	}
+
+const EC_METHOD *EC_GFp_nistz256_method(void)
+	{
+	static const EC_METHOD ret = {
+		EC_FLAGS_DEFAULT_OCT,
+		NID_X9_62_prime_field,
+		ec_GFp_mont_group_init,
+		ec_GFp_mont_group_finish,
+		ec_GFp_mont_group_clear_finish,
+		ec_GFp_mont_group_copy,
+		ec_GFp_mont_group_set_curve,
+		ec_GFp_simple_group_get_curve,
+		ec_GFp_simple_group_get_degree,
+		ec_GFp_simple_group_check_discriminant,
+		ec_GFp_simple_point_init,
+		ec_GFp_simple_point_finish,
+		ec_GFp_simple_point_clear_finish,
+		ec_GFp_simple_point_copy,
+		ec_GFp_simple_point_set_to_infinity,
+		ec_GFp_simple_set_Jprojective_coordinates_GFp,
+		ec_GFp_simple_get_Jprojective_coordinates_GFp,
+		ec_GFp_simple_point_set_affine_coordinates,
+		ecp_nistz256_get_affine,
+		0 /* point_set_compressed_coordinates */,
+		0 /* point2oct */,
+		0 /* oct2point */,
+		ec_GFp_simple_add,
+		ec_GFp_simple_dbl,
+		ec_GFp_simple_invert,
+		ec_GFp_simple_is_at_infinity,
+		ec_GFp_simple_is_on_curve,
+		ec_GFp_simple_cmp,
+		ec_GFp_simple_make_affine,
+		ec_GFp_simple_points_make_affine,
+		ecp_nistz256_points_mul,
+		0 /* precompute_mult */,
+		ecp_nistz256_have_precompute_mult,
+		ec_GFp_mont_field_mul,
+		ec_GFp_mont_field_sqr,
+		0 /* field_div */,
+		ec_GFp_mont_field_encode,
+		ec_GFp_mont_field_decode,
+		ec_GFp_mont_field_set_to_one };
+
+	return &ret;
+	}
+
+#else
+static void *dummy=&dummy;
+#endif
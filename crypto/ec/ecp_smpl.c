@@ -1172,13 +1172,18 @@ int ec_GFp_simple_make_affine(const EC_GROUP *group, EC_POINT *point, BN_CTX *ct
 	}
 
 
+/* Points are converted in batches of at most this many, each with a
+ * single inversion: the products of the Z's of a batch come from 'ctx'
+ * and are reused by the next batch, so that a caller reusing its BN_CTX
+ * converts any number of points without allocating. */
+#define EC_MAKE_AFFINE_BATCH	512
+
 int ec_GFp_simple_points_make_affine(const EC_GROUP *group, size_t num, EC_POINT *points[], BN_CTX *ctx)
 	{
 	BN_CTX *new_ctx = NULL;
-	BIGNUM *tmp0, *tmp1;
-	size_t pow2 = 0;
-	BIGNUM **heap = NULL;
-	size_t i;
+	BIGNUM *tmp0, *tmp1, *inv;
+	BIGNUM *prod[EC_MAKE_AFFINE_BATCH];
+	size_t batch, start, first, i;
 	int ret = 0;
 
 	if (num == 0)
@@ -1191,153 +1196,122 @@ int ec_GFp_simple_points_make_affine(const EC_GROUP *group, size_t num, EC_POINT
 			return 0;
 		}
 
+	batch = num < EC_MAKE_AFFINE_BATCH ? num : EC_MAKE_AFFINE_BATCH;
+
 	BN_CTX_start(ctx);
 	tmp0 = BN_CTX_get(ctx);
 	tmp1 = BN_CTX_get(ctx);
-	if (tmp0  == NULL || tmp1 == NULL) goto err;
+	inv = BN_CTX_get(ctx);
+	for (i = 0; i < batch; i++)
+		prod[i] = BN_CTX_get(ctx);
+	if (prod[batch - 1] == NULL) goto err;
 
 	/* Before converting the individual points, compute inverses of all Z values.
 	 * Modular inversion is rather slow, but luckily we can do with a single
-	 * explicit inversion, plus about 3 multiplications per input value.
-	 */
-
-	pow2 = 1;
-	while (num > pow2)
-		pow2 <<= 1;
-	/* Now pow2 is the smallest power of 2 satifsying pow2 >= num.
-	 * We need twice that. */
-	pow2 <<= 1;
-
-	heap = OPENSSL_malloc(pow2 * sizeof heap[0]);
-	if (heap == NULL) goto err;
-	
-	/* The array is used as a binary tree, exactly as in heapsort:
+	 * explicit inversion per batch, plus 3 multiplications per input value
+	 * (Montgomery's trick):
 	 *
-	 *                               heap[1]
-	 *                 heap[2]                     heap[3]
-	 *          heap[4]       heap[5]       heap[6]       heap[7]
-	 *   heap[8]heap[9] heap[10]heap[11] heap[12]heap[13] heap[14] heap[15]
+	 *     prod[i] = Z_0 * Z_1 * ... * Z_i,
+	 *     inv = 1/prod[n-1],
+	 *     1/Z_i = inv * prod[i-1],  then  inv := inv * Z_i = 1/prod[i-1]
 	 *
-	 * We put the Z's in the last line;
-	 * then we set each other node to the product of its two child-nodes (where
-	 * empty or 0 entries are treated as ones);
-	 * then we invert heap[1];
-	 * then we invert each other node by replacing it by the product of its
-	 * parent (after inversion) and its sibling (before inversion).
+	 * where the points at infinity (Z = 0) and the affine points are
+	 * skipped: they need no inversion.
 	 */
-	heap[0] = NULL;
-	for (i = pow2/2 - 1; i > 0; i--)
-		heap[i] = NULL;
-	for (i = 0; i < num; i++)
-		heap[pow2/2 + i] = &points[i]->Z;
-	for (i = pow2/2 + num; i < pow2; i++)
-		heap[i] = NULL;
-	
-	/* set each node to the product of its children */
-	for (i = pow2/2 - 1; i > 0; i--)
+	for (start = 0; start < num; start += batch)
 		{
-		heap[i] = BN_new();
-		if (heap[i] == NULL) goto err;
-		
-		if (heap[2*i] != NULL)
+		EC_POINT **p = points + start;
+		size_t n = num - start < batch ? num - start : batch;
+
+		/* set prod[i] to the product of the Z's up to i that matter */
+		first = n;
+		for (i = 0; i < n; i++)
 			{
-			if ((heap[2*i + 1] == NULL) || BN_is_zero(heap[2*i + 1]))
+			if (p[i]->Z_is_one || BN_is_zero(&p[i]->Z))
+				{
+				if (first < n && !BN_copy(prod[i], prod[i - 1])) goto err;
+				}
+			else if (first == n)
 				{
-				if (!BN_copy(heap[i], heap[2*i])) goto err;
+				if (!BN_copy(prod[i], &p[i]->Z)) goto err;
+				first = i;
 				}
 			else
 				{
-				if (BN_is_zero(heap[2*i]))
-					{
-					if (!BN_copy(heap[i], heap[2*i + 1])) goto err;
-					}
-				else
-					{
-					if (!group->meth->field_mul(group, heap[i],
-						heap[2*i], heap[2*i + 1], ctx)) goto err;
-					}
+				if (!group->meth->field_mul(group, prod[i], prod[i - 1], &p[i]->Z, ctx)) goto err;
 				}
 			}
-		}
+		if (first == n)
+			continue;
 
-	/* invert heap[1] */
-	if (!BN_is_zero(heap[1]))
-		{
-		if (!BN_mod_inverse(heap[1], heap[1], &group->field, ctx))
+		if (!BN_mod_inverse(inv, prod[n - 1], &group->field, ctx))
 			{
 			ECerr(EC_F_EC_GFP_SIMPLE_POINTS_MAKE_AFFINE, ERR_R_BN_LIB);
 			goto err;
 			}
-		}
-	if (group->meth->field_encode != 0)
-		{
-		/* in the Montgomery case, we just turned  R*H  (representing H)
-		 * into  1/(R*H),  but we need  R*(1/H)  (representing 1/H);
-		 * i.e. we have need to multiply by the Montgomery factor twice */
-		if (!group->meth->field_encode(group, heap[1], heap[1], ctx)) goto err;
-		if (!group->meth->field_encode(group, heap[1], heap[1], ctx)) goto err;
-		}
-
-	/* set other heap[i]'s to their inverses */
-	for (i = 2; i < pow2/2 + num; i += 2)
-		{
-		/* i is even */
-		if ((heap[i + 1] != NULL) && !BN_is_zero(heap[i + 1]))
+		if (group->meth->field_encode != 0)
 			{
-			if (!group->meth->field_mul(group, tmp0, heap[i/2], heap[i + 1], ctx)) goto err;
-			if (!group->meth->field_mul(group, tmp1, heap[i/2], heap[i], ctx)) goto err;
-			if (!BN_copy(heap[i], tmp0)) goto err;
-			if (!BN_copy(heap[i + 1], tmp1)) goto err;
+			/* in the Montgomery case, we just turned  R*H  (representing H)
+			 * into  1/(R*H),  but we need  R*(1/H)  (representing 1/H);
+			 * i.e. we have need to multiply by the Montgomery factor twice */
+			if (!group->meth->field_encode(group, inv, inv, ctx)) goto err;
+			if (!group->meth->field_encode(group, inv, inv, ctx)) goto err;
 			}
-		else
-			{
-			if (!BN_copy(heap[i], heap[i/2])) goto err;
-			}
-		}
 
-	/* we have replaced all non-zero Z's by their inverses, now fix up all the points */
-	for (i = 0; i < num; i++)
-		{
-		EC_POINT *p = points[i];
-		
-		if (!BN_is_zero(&p->Z))
+		for (i = n; i-- > first; )
 			{
-			/* turn  (X, Y, 1/Z)  into  (X/Z^2, Y/Z^3, 1) */
+			if (p[i]->Z_is_one || BN_is_zero(&p[i]->Z))
+				continue;
 
-			if (!group->meth->field_sqr(group, tmp1, &p->Z, ctx)) goto err;
-			if (!group->meth->field_mul(group, &p->X, &p->X, tmp1, ctx)) goto err;
+			/* tmp0 := 1/Z */
+			if (i > first)
+				{
+				if (!group->meth->field_mul(group, tmp0, inv, prod[i - 1], ctx)) goto err;
+				if (!group->meth->field_mul(group, inv, inv, &p[i]->Z, ctx)) goto err;
+				}
+			else
+				{
+				if (!BN_copy(tmp0, inv)) goto err;
+				}
+
+			/* turn  (X, Y, Z)  into  (X/Z^2, Y/Z^3, 1) */
+
+			if (!group->meth->field_sqr(group, tmp1, tmp0, ctx)) goto err;
+			if (!group->meth->field_mul(group, &p[i]->X, &p[i]->X, tmp1, ctx)) goto err;
+
+			if (!group->meth->field_mul(group, tmp1, tmp1, tmp0, ctx)) goto err;
+			if (!group->meth->field_mul(group, &p[i]->Y, &p[i]->Y, tmp1, ctx)) goto err;
 
-			if (!group->meth->field_mul(group, tmp1, tmp1, &p->Z, ctx)) goto err;
-			if (!group->meth->field_mul(group, &p->Y, &p->Y, tmp1, ctx)) goto err;
-		
 			if (group->meth->field_set_to_one != 0)
 				{
-				if (!group->meth->field_set_to_one(group, &p->Z, ctx)) goto err;
+				if (!group->meth->field_set_to_one(group, &p[i]->Z, ctx)) goto err;
 				}
 			else
 				{
-				if (!BN_one(&p->Z)) goto err;
+				if (!BN_one(&p[i]->Z)) goto err;
 				}
-			p->Z_is_one = 1;
+			p[i]->Z_is_one = 1;
 			}
 		}
 
 	ret = 1;
 		
  err:
+	/* the products of the Z's and their inverses are not left in 'ctx' */
+	if (tmp0 != NULL)
+		BN_clear(tmp0);
+	if (tmp1 != NULL)
+		BN_clear(tmp1);
+	if (inv != NULL)
+		BN_clear(inv);
+	for (i = 0; i < batch; i++)
+		{
+		if (prod[i] != NULL)
+			BN_clear(prod[i]);
+		}
 	BN_CTX_end(ctx);
 	if (new_ctx != NULL)
 		BN_CTX_free(new_ctx);
-	if (heap != NULL)
-		{
-		/* heap[pow2/2] .. heap[pow2-1] have not been allocated locally! */
-		for (i = pow2/2 - 1; i > 0; i--)
-			{
-			if (heap[i] != NULL)
-				BN_clear_free(heap[i]);
-			}
-		OPENSSL_free(heap);
-		}
 	return ret;
 	}
 
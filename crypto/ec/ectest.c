@@ -111,6 +111,7 @@ int main(int argc, char * argv[]) { puts("Elliptic curves are disabled."); retur
 #define TIMING_BASE_PT 0
 #define TIMING_RAND_PT 1
 #define TIMING_SIMUL 2
+#define TIMING_PRECOMP 3
 
 #if 0
 static void timings(EC_GROUP *group, int type, BN_CTX *ctx)
@@ -149,6 +150,11 @@ static void timings(EC_GROUP *group, int type, BN_CTX *ctx)
 		{
 		for (j = 0; j < 10; j++)
 			{
+			if (type == TIMING_PRECOMP)
+				{
+				if (!EC_GROUP_precompute_mult(group, ctx)) ABORT;
+				continue;
+				}
 			if (!EC_POINT_mul(group, P, (type != TIMING_RAND_PT) ? r[i] : NULL, 
 				(type != TIMING_BASE_PT) ? P : NULL, (type != TIMING_BASE_PT) ? r0[i] : NULL, ctx)) ABORT;
 			}
@@ -179,6 +185,9 @@ static void timings(EC_GROUP *group, int type, BN_CTX *ctx)
 	} else if (type == TIMING_SIMUL) {
 		fprintf(stdout, "%i %s in %.2f " UNIT "\n", i*j,
 			"s*P+t*Q operations", (double)clck/CLOCKS_PER_SEC);
+	} else if (type == TIMING_PRECOMP) {
+		fprintf(stdout, "%i %s in %.2f " UNIT "\n", i*j,
+			"generator precomputations", (double)clck/CLOCKS_PER_SEC);
 	}
 	fprintf(stdout, "average: %.4f " UNIT "\n", (double)clck/(CLOCKS_PER_SEC*i*j));
 
@@ -694,21 +703,27 @@ static void prime_field_tests(void)
 	timings(P_160, TIMING_BASE_PT, ctx);
 	timings(P_160, TIMING_RAND_PT, ctx);
 	timings(P_160, TIMING_SIMUL, ctx);
+	timings(P_160, TIMING_PRECOMP, ctx);
 	timings(P_192, TIMING_BASE_PT, ctx);
 	timings(P_192, TIMING_RAND_PT, ctx);
 	timings(P_192, TIMING_SIMUL, ctx);
+	timings(P_192, TIMING_PRECOMP, ctx);
 	timings(P_224, TIMING_BASE_PT, ctx);
 	timings(P_224, TIMING_RAND_PT, ctx);
 	timings(P_224, TIMING_SIMUL, ctx);
+	timings(P_224, TIMING_PRECOMP, ctx);
 	timings(P_256, TIMING_BASE_PT, ctx);
 	timings(P_256, TIMING_RAND_PT, ctx);
 	timings(P_256, TIMING_SIMUL, ctx);
+	timings(P_256, TIMING_PRECOMP, ctx);
 	timings(P_384, TIMING_BASE_PT, ctx);
 	timings(P_384, TIMING_RAND_PT, ctx);
 	timings(P_384, TIMING_SIMUL, ctx);
+	timings(P_384, TIMING_PRECOMP, ctx);
 	timings(P_521, TIMING_BASE_PT, ctx);
 	timings(P_521, TIMING_RAND_PT, ctx);
 	timings(P_521, TIMING_SIMUL, ctx);
+	timings(P_521, TIMING_PRECOMP, ctx);
 #endif
 
 
@@ -1161,33 +1176,43 @@ static void char2_field_tests(void)
 	timings(C2_K163, TIMING_BASE_PT, ctx);
 	timings(C2_K163, TIMING_RAND_PT, ctx);
 	timings(C2_K163, TIMING_SIMUL, ctx);
+	timings(C2_K163, TIMING_PRECOMP, ctx);
 	timings(C2_B163, TIMING_BASE_PT, ctx);
 	timings(C2_B163, TIMING_RAND_PT, ctx);
 	timings(C2_B163, TIMING_SIMUL, ctx);
+	timings(C2_B163, TIMING_PRECOMP, ctx);
 	timings(C2_K233, TIMING_BASE_PT, ctx);
 	timings(C2_K233, TIMING_RAND_PT, ctx);
 	timings(C2_K233, TIMING_SIMUL, ctx);
+	timings(C2_K233, TIMING_PRECOMP, ctx);
 	timings(C2_B233, TIMING_BASE_PT, ctx);
 	timings(C2_B233, TIMING_RAND_PT, ctx);
 	timings(C2_B233, TIMING_SIMUL, ctx);
+	timings(C2_B233, TIMING_PRECOMP, ctx);
 	timings(C2_K283, TIMING_BASE_PT, ctx);
 	timings(C2_K283, TIMING_RAND_PT, ctx);
 	timings(C2_K283, TIMING_SIMUL, ctx);
+	timings(C2_K283, TIMING_PRECOMP, ctx);
 	timings(C2_B283, TIMING_BASE_PT, ctx);
 	timings(C2_B283, TIMING_RAND_PT, ctx);
 	timings(C2_B283, TIMING_SIMUL, ctx);
+	timings(C2_B283, TIMING_PRECOMP, ctx);
 	timings(C2_K409, TIMING_BASE_PT, ctx);
 	timings(C2_K409, TIMING_RAND_PT, ctx);
 	timings(C2_K409, TIMING_SIMUL, ctx);
+	timings(C2_K409, TIMING_PRECOMP, ctx);
 	timings(C2_B409, TIMING_BASE_PT, ctx);
 	timings(C2_B409, TIMING_RAND_PT, ctx);
 	timings(C2_B409, TIMING_SIMUL, ctx);
+	timings(C2_B409, TIMING_PRECOMP, ctx);
 	timings(C2_K571, TIMING_BASE_PT, ctx);
 	timings(C2_K571, TIMING_RAND_PT, ctx);
 	timings(C2_K571, TIMING_SIMUL, ctx);
+	timings(C2_K571, TIMING_PRECOMP, ctx);
 	timings(C2_B571, TIMING_BASE_PT, ctx);
 	timings(C2_B571, TIMING_RAND_PT, ctx);
 	timings(C2_B571, TIMING_SIMUL, ctx);
+	timings(C2_B571, TIMING_PRECOMP, ctx);
 #endif
 
 
@@ -1214,6 +1239,324 @@ static void char2_field_tests(void)
 	}
 #endif
 
+/* Checks multiples of the generator alone, which named curves compute
+ * with a comb once they have multiplied it a few times, against the same
+ * multiples through the interleaved wNAF method */
+static void comb_test(EC_GROUP *group)
+	{
+	BN_CTX *ctx = BN_CTX_new();
+	EC_GROUP *copy = NULL;
+	EC_POINT *P = EC_POINT_new(group), *Q = EC_POINT_new(group);
+	EC_POINT *G2 = EC_POINT_new(group);
+	const EC_POINT *G = EC_GROUP_get0_generator(group);
+	BIGNUM *order = BN_new(), *k = BN_new(), *k2 = BN_new();
+	int i;
+
+	if (ctx == NULL || P == NULL || Q == NULL || G2 == NULL || G == NULL
+		|| order == NULL || k == NULL || k2 == NULL) ABORT;
+	if (!EC_GROUP_get_order(group, order, ctx)) ABORT;
+
+	for (i = 0; i < 16; i++)
+		{
+		switch (i)
+			{
+		case 0: BN_zero(k); break;
+		case 1: if (!BN_one(k)) ABORT; break;
+		case 2: if (!BN_sub(k, order, BN_value_one())) ABORT; break;
+		case 3: if (!BN_copy(k, order)) ABORT; break;
+		case 4: if (!BN_add(k, order, BN_value_one())) ABORT; break;
+		/* the longest the comb takes, as  k + order  in ECDSA */
+		case 5: if (!BN_lshift1(k, order)) ABORT;
+			if (!BN_sub(k, k, BN_value_one())) ABORT;
+			break;
+		/* longer or negative scalars go to the wNAF method */
+		case 6: if (!BN_lshift(k, order, 2)) ABORT; break;
+		case 7: if (!BN_one(k)) ABORT; BN_set_negative(k, 1); break;
+		default: if (!BN_rand_range(k, order)) ABORT; break;
+			}
+		if (!EC_POINT_mul(group, P, k, NULL, NULL, ctx)) ABORT;
+		if (!EC_POINT_mul(group, Q, NULL, G, k, ctx)) ABORT;
+		if (0 != EC_POINT_cmp(group, P, Q, ctx)) ABORT;
+		}
+
+	/* copies share the comb, until they have a new generator */
+	if ((copy = EC_GROUP_dup(group)) == NULL) ABORT;
+	if (!BN_rand_range(k, order)) ABORT;
+	if (!EC_POINT_mul(copy, P, k, NULL, NULL, ctx)) ABORT;
+	if (!EC_POINT_mul(group, Q, NULL, G, k, ctx)) ABORT;
+	if (0 != EC_POINT_cmp(group, P, Q, ctx)) ABORT;
+	if (!EC_POINT_dbl(group, G2, G, ctx)) ABORT;
+	if (!EC_GROUP_get_cofactor(group, k2, ctx)) ABORT;
+	if (!EC_GROUP_set_generator(copy, G2, order, k2)) ABORT;
+	if (!BN_lshift1(k2, k)) ABORT;
+	for (i = 0; i < 3; i++)
+		{
+		if (!EC_POINT_mul(copy, P, k, NULL, NULL, ctx)) ABORT;
+		if (!EC_POINT_mul(group, Q, k2, NULL, NULL, ctx)) ABORT;
+		if (0 != EC_POINT_cmp(group, P, Q, ctx)) ABORT;
+		}
+
+	EC_GROUP_free(copy);
+	EC_POINT_free(P);
+	EC_POINT_free(Q);
+	EC_POINT_free(G2);
+	BN_free(order);
+	BN_free(k);
+	BN_free(k2);
+	BN_CTX_free(ctx);
+	}
+
+/* Checks sums of many multiples, which take the bucket method, against
+ * the same sums computed in small parts with the interleaved wNAFs; the
+ * points include repeats, inverses and the point at infinity, and the
+ * scalars zero, negative ones and ones over the order */
+#define MULTI_MUL_NUM	150
+#define MULTI_MUL_PART	10
+
+static void multi_mul_test(int nid)
+	{
+	BN_CTX *ctx = BN_CTX_new();
+	EC_GROUP *group = EC_GROUP_new_by_curve_name(nid);
+	EC_POINT *P[MULTI_MUL_NUM];
+	BIGNUM *k[MULTI_MUL_NUM];
+	EC_POINT *R = NULL, *S = NULL, *T = NULL;
+	BIGNUM *order = BN_new(), *g = BN_new();
+	size_t i;
+
+	if (ctx == NULL || group == NULL || order == NULL || g == NULL) ABORT;
+	fprintf(stdout, "testing sums of %d multiples on %s: ",
+		MULTI_MUL_NUM, OBJ_nid2sn(nid));
+	fflush(stdout);
+	if (!EC_GROUP_get_order(group, order, ctx)) ABORT;
+	if ((R = EC_POINT_new(group)) == NULL
+		|| (S = EC_POINT_new(group)) == NULL
+		|| (T = EC_POINT_new(group)) == NULL) ABORT;
+
+	for (i = 0; i < MULTI_MUL_NUM; i++)
+		{
+		if ((P[i] = EC_POINT_new(group)) == NULL) ABORT;
+		if ((k[i] = BN_new()) == NULL) ABORT;
+		if (!BN_rand_range(g, order)) ABORT;
+		if (!EC_POINT_mul(group, P[i], g, NULL, NULL, ctx)) ABORT;
+		if (!BN_rand_range(k[i], order)) ABORT;
+		}
+	if (!EC_POINT_copy(P[1], P[0])) ABORT;
+	if (!EC_POINT_copy(P[2], P[0])) ABORT;
+	if (!EC_POINT_invert(group, P[2], ctx)) ABORT;
+	if (!EC_POINT_set_to_infinity(group, P[3])) ABORT;
+	BN_zero(k[4]);
+	BN_set_negative(k[5], 1);
+	BN_set_negative(k[6], 1);
+	if (!BN_lshift(k[7], order, 3)) ABORT;
+	if (!BN_add(k[7], k[7], k[8])) ABORT;
+	if (!BN_copy(k[9], order)) ABORT;
+	if (!BN_rand_range(g, order)) ABORT;
+
+	if (!EC_POINTs_mul(group, R, g, MULTI_MUL_NUM,
+		(const EC_POINT **)P, (const BIGNUM **)k, ctx)) ABORT;
+	fprintf(stdout, ".");
+	fflush(stdout);
+
+	if (!EC_POINT_mul(group, S, g, NULL, NULL, ctx)) ABORT;
+	for (i = 0; i < MULTI_MUL_NUM; i += MULTI_MUL_PART)
+		{
+		if (!EC_POINTs_mul(group, T, NULL, MULTI_MUL_PART,
+			(const EC_POINT **)P + i, (const BIGNUM **)k + i, ctx)) ABORT;
+		if (!EC_POINT_add(group, S, S, T, ctx)) ABORT;
+		}
+	if (0 != EC_POINT_cmp(group, R, S, ctx)) ABORT;
+	fprintf(stdout, ".");
+	fflush(stdout);
+
+	/* all the multiples cancelling out */
+	if (!BN_copy(k[1], k[0])) ABORT;
+	if (!BN_copy(k[2], k[0])) ABORT;
+	for (i = 0; i < MULTI_MUL_NUM; i++)
+		{
+		if (i == 0 || i == 2)
+			continue;
+		BN_zero(k[i]);
+		}
+	if (!EC_POINTs_mul(group, R, NULL, MULTI_MUL_NUM,
+		(const EC_POINT **)P, (const BIGNUM **)k, ctx)) ABORT;
+	if (!EC_POINT_is_at_infinity(group, R)) ABORT;
+	fprintf(stdout, ". ok\n");
+
+	for (i = 0; i < MULTI_MUL_NUM; i++)
+		{
+		EC_POINT_free(P[i]);
+		BN_free(k[i]);
+		}
+	EC_POINT_free(R);
+	EC_POINT_free(S);
+	EC_POINT_free(T);
+	EC_GROUP_free(group);
+	BN_free(order);
+	BN_free(g);
+	BN_CTX_free(ctx);
+	}
+
+/* Helpers for p256_test(): point transfer between groups on one curve */
+static void p256_move(const EC_GROUP *from, const EC_POINT *P,
+	const EC_GROUP *to, EC_POINT *Q, BN_CTX *ctx)
+	{
+	unsigned char buf[1 + 2 * 32];
+	size_t len;
+
+	len = EC_POINT_point2oct(from, P, POINT_CONVERSION_UNCOMPRESSED,
+		buf, sizeof buf, ctx);
+	if (len == 0) ABORT;
+	if (!EC_POINT_oct2point(to, Q, buf, len, ctx)) ABORT;
+	}
+
+static void p256_check(const EC_GROUP *group, const EC_POINT *P,
+	const EC_GROUP *ref, const EC_POINT *Q, BN_CTX *ctx)
+	{
+	EC_POINT *T = EC_POINT_new(ref);
+
+	if (T == NULL) ABORT;
+	p256_move(group, P, ref, T, ctx);
+	if (0 != EC_POINT_cmp(ref, T, Q, ctx)) ABORT;
+	EC_POINT_free(T);
+	}
+
+/* Checks the multiplications of the P-256 group, which may have a method
+ * of its own, against a group of the same curve with the generic prime
+ * method */
+static void p256_test(void)
+	{
+	BN_CTX *ctx = BN_CTX_new();
+	EC_GROUP *group, *ref;
+	BIGNUM *p = BN_new(), *a = BN_new(), *b = BN_new();
+	BIGNUM *order = BN_new(), *cofactor = BN_new();
+	BIGNUM *k = BN_new(), *k2 = BN_new(), *d = BN_new();
+	EC_POINT *P, *Q, *R, *S, *refG, *refP, *refQ, *refR;
+	const EC_POINT *points[3];
+	const BIGNUM *scalars[3];
+	int i;
+
+	if (ctx == NULL || p == NULL || a == NULL || b == NULL ||
+		order == NULL || cofactor == NULL ||
+		k == NULL || k2 == NULL || d == NULL) ABORT;
+	if ((group = EC_GROUP_new_by_curve_name(NID_X9_62_prime256v1)) == NULL)
+		ABORT;
+	if (!EC_GROUP_get_curve_GFp(group, p, a, b, ctx)) ABORT;
+	if (!EC_GROUP_get_order(group, order, ctx)) ABORT;
+	if (!EC_GROUP_get_cofactor(group, cofactor, ctx)) ABORT;
+	if ((ref = EC_GROUP_new(EC_GFp_mont_method())) == NULL) ABORT;
+	if (!EC_GROUP_set_curve_GFp(ref, p, a, b, ctx)) ABORT;
+	if ((refG = EC_POINT_new(ref)) == NULL) ABORT;
+	p256_move(group, EC_GROUP_get0_generator(group), ref, refG, ctx);
+	if (!EC_GROUP_set_generator(ref, refG, order, cofactor)) ABORT;
+
+	if ((P = EC_POINT_new(group)) == NULL || (Q = EC_POINT_new(group)) == NULL
+		|| (R = EC_POINT_new(group)) == NULL
+		|| (S = EC_POINT_new(group)) == NULL
+		|| (refP = EC_POINT_new(ref)) == NULL
+		|| (refQ = EC_POINT_new(ref)) == NULL
+		|| (refR = EC_POINT_new(ref)) == NULL) ABORT;
+
+	fprintf(stdout, "testing P-256 multiplication: ");
+
+	/* k*G, and k*P for a random P */
+	if (!BN_rand_range(d, order)) ABORT;
+	if (!EC_POINT_mul(ref, refP, d, NULL, NULL, ctx)) ABORT;
+	p256_move(ref, refP, group, P, ctx);
+	for (i = 0; i < 16; i++)
+		{
+		switch (i)
+			{
+		case 0: BN_zero(k); break;
+		case 1: if (!BN_one(k)) ABORT; break;
+		case 2: if (!BN_sub(k, order, BN_value_one())) ABORT; break;
+		case 3: if (!BN_copy(k, order)) ABORT; break;
+		case 4: if (!BN_add(k, order, BN_value_one())) ABORT; break;
+		case 5: if (!BN_lshift1(k, order)) ABORT;
+			if (!BN_sub(k, k, BN_value_one())) ABORT;
+			break;
+		case 6: if (!BN_lshift(k, order, 7)) ABORT;
+			if (!BN_add(k, k, BN_value_one())) ABORT;
+			break;
+		case 7: if (!BN_one(k)) ABORT; BN_set_negative(k, 1); break;
+		case 8: if (!BN_set_word(k, 1)) ABORT;
+			if (!BN_lshift(k, k, 255)) ABORT;
+			break;
+		default: if (!BN_rand_range(k, order)) ABORT; break;
+			}
+		if (!EC_POINT_mul(group, Q, k, NULL, NULL, ctx)) ABORT;
+		if (!EC_POINT_mul(ref, refQ, k, NULL, NULL, ctx)) ABORT;
+		p256_check(group, Q, ref, refQ, ctx);
+
+		if (!EC_POINT_mul(group, Q, NULL, P, k, ctx)) ABORT;
+		if (!EC_POINT_mul(ref, refQ, NULL, refP, k, ctx)) ABORT;
+		p256_check(group, Q, ref, refQ, ctx);
+		fprintf(stdout, ".");
+		fflush(stdout);
+		}
+
+	/* k*G + k2*P as in ECDSA verification, including the two sums that
+	 * double and cancel, with P = d*G */
+	for (i = 0; i < 6; i++)
+		{
+		if (!BN_rand_range(k2, order)) ABORT;
+		switch (i)
+			{
+		case 0: if (!BN_mod_mul(k, k2, d, order, ctx)) ABORT; break;
+		case 1: if (!BN_mod_mul(k, k2, d, order, ctx)) ABORT;
+			if (!BN_sub(k, order, k)) ABORT;
+			break;
+		default: if (!BN_rand_range(k, order)) ABORT; break;
+			}
+		if (!EC_POINT_mul(group, Q, k, P, k2, ctx)) ABORT;
+		if (!EC_POINT_mul(ref, refQ, k, refP, k2, ctx)) ABORT;
+		p256_check(group, Q, ref, refQ, ctx);
+		}
+	if (!EC_POINT_mul(group, Q, d, NULL, NULL, ctx)) ABORT;
+	if (!BN_sub(k, order, BN_value_one())) ABORT;
+	if (!EC_POINT_mul(group, Q, NULL, Q, k, ctx)) ABORT;
+	if (!EC_POINT_add(group, Q, Q, P, ctx)) ABORT;
+	if (!EC_POINT_is_at_infinity(group, Q)) ABORT;
+
+	/* several points, one of them at infinity */
+	if (!BN_rand_range(k, order)) ABORT;
+	if (!EC_POINT_mul(ref, refR, k, NULL, NULL, ctx)) ABORT;
+	p256_move(ref, refR, group, R, ctx);
+	if (!EC_POINT_set_to_infinity(group, S)) ABORT;
+	points[0] = P;
+	points[1] = R;
+	points[2] = S;
+	scalars[0] = k;
+	scalars[1] = k2;
+	scalars[2] = d;
+	if (!EC_POINTs_mul(group, Q, d, 3, points, scalars, ctx)) ABORT;
+	points[0] = refP;
+	points[1] = refR;
+	points[2] = NULL;
+	if (!EC_POINTs_mul(ref, refQ, d, 2, points, scalars, ctx)) ABORT;
+	p256_check(group, Q, ref, refQ, ctx);
+	fprintf(stdout, " ok\n");
+
+	EC_POINT_free(P);
+	EC_POINT_free(Q);
+	EC_POINT_free(R);
+	EC_POINT_free(S);
+	EC_POINT_free(refG);
+	EC_POINT_free(refP);
+	EC_POINT_free(refQ);
+	EC_POINT_free(refR);
+	EC_GROUP_free(group);
+	EC_GROUP_free(ref);
+	BN_free(p);
+	BN_free(a);
+	BN_free(b);
+	BN_free(order);
+	BN_free(cofactor);
+	BN_free(k);
+	BN_free(k2);
+	BN_free(d);
+	BN_CTX_free(ctx);
+	}
+
 static void internal_curve_test(void)
 	{
 	EC_builtin_curve *curves = NULL;
@@ -1256,6 +1599,7 @@ static void internal_curve_test(void)
 			/* try the next curve */
 			continue;
 			}
+		comb_test(group);
 		fprintf(stdout, ".");
 		fflush(stdout);
 		EC_GROUP_free(group);
@@ -1475,6 +1819,11 @@ int main(int argc, char *argv[])
 #endif
 	/* test the internal curves */
 	internal_curve_test();
+	p256_test();
+	multi_mul_test(NID_secp384r1);
+#ifndef OPENSSL_NO_EC2M
+	multi_mul_test(NID_sect283k1);
+#endif
 
 #ifndef OPENSSL_NO_ENGINE
 	ENGINE_cleanup();
@@ -142,6 +142,24 @@ ECDSA_SIG *ECDSA_do_sign_ex(const unsigned char *dgst, int dgstlen,
 int	  ECDSA_do_verify(const unsigned char *dgst, int dgst_len,
 		const ECDSA_SIG *sig, EC_KEY* eckey);
 
+/** Verifies several ECDSA signatures at once. Signatures with keys of the
+ *  same group share one inversion modulo the order, the precomputed
+ *  multiples of the generator and one field inversion; the others are
+ *  verified one at a time.
+ *  \param  dgst      array of num pointers to the hash values
+ *  \param  dgst_len  array of num lengths of the hash values
+ *  \param  sig       array of num ECDSA_SIG structures
+ *  \param  eckey     array of num EC_KEY objects containing public EC keys
+ *  \param  num       number of signatures
+ *  \param  results   array of num ints set to what ECDSA_do_verify()
+ *                    returns for each signature
+ *  \return 1 if all signatures are valid, 0 if a signature is invalid
+ *          and -1 on error
+ */
+int	  ECDSA_do_verify_batch(const unsigned char *const *dgst,
+		const int *dgst_len, const ECDSA_SIG *const *sig,
+		EC_KEY *const *eckey, size_t num, int *results);
+
 const ECDSA_METHOD *ECDSA_OpenSSL(void);
 
 /** Sets the default ECDSA method
@@ -283,6 +301,17 @@ void ECDSA_METHOD_set_verify(ECDSA_METHOD *ecdsa_method,
         int (*ecdsa_do_verify)(const unsigned char *dgst, int dgst_len,
                 const ECDSA_SIG *sig, EC_KEY *eckey));
 
+/**  Set the ECDSA_do_verify_batch function in the ECDSA_METHOD; setting
+ *   the ECDSA_do_verify function clears it
+ *   \param  ecdsa_method  pointer to existing ECDSA_METHOD
+ *   \param  ecdsa_do_verify_batch a funtion of type ECDSA_do_verify_batch
+ */
+
+void ECDSA_METHOD_set_verify_batch(ECDSA_METHOD *ecdsa_method,
+        int (*ecdsa_do_verify_batch)(const unsigned char *const *dgst,
+                const int *dgst_len, const ECDSA_SIG *const *sig,
+                EC_KEY *const *eckey, size_t num, int *results));
+
 void ECDSA_METHOD_set_flags(ECDSA_METHOD *ecdsa_method, int flags);
 
 /**  Set the flags field in the ECDSA_METHOD
@@ -309,6 +338,7 @@ void ERR_load_ECDSA_strings(void);
 #define ECDSA_F_ECDSA_DATA_NEW_METHOD			 100
 #define ECDSA_F_ECDSA_DO_SIGN				 101
 #define ECDSA_F_ECDSA_DO_VERIFY				 102
+#define ECDSA_F_ECDSA_DO_VERIFY_BATCH			 106
 #define ECDSA_F_ECDSA_METHOD_NEW			 105
 #define ECDSA_F_ECDSA_SIGN_SETUP			 103
 
@@ -101,6 +101,7 @@ static const char rnd_seed[] = "string to make the random number generator "
 int x9_62_tests(BIO *);
 int x9_62_test_internal(BIO *out, int nid, const char *r, const char *s);
 int test_builtin(BIO *);
+int test_batch(BIO *);
 
 /* functions to change the RAND_METHOD */
 int change_rand(void);
@@ -539,6 +540,122 @@ builtin_err:
 	return ret;
 	}
 
+/* ECDSA_do_verify_batch() with keys on two curves, some of the signatures
+ * broken, must give the same results as ECDSA_do_verify() */
+#define BATCH_NUM	12
+
+int test_batch(BIO *out)
+	{
+	static const int nids[] = { NID_X9_62_prime256v1, NID_secp384r1 };
+	EC_KEY		*keys[BATCH_NUM];
+	ECDSA_SIG	*sigs[BATCH_NUM];
+	unsigned char	digests[BATCH_NUM][32];
+	const unsigned char *dgst[BATCH_NUM];
+	int		dgst_len[BATCH_NUM], results[BATCH_NUM];
+	int		i, expected, ret = 0;
+
+	BIO_printf(out, "\ntesting ECDSA_do_verify_batch(): ");
+	memset(keys, 0, sizeof(keys));
+	memset(sigs, 0, sizeof(sigs));
+
+	for (i = 0; i < BATCH_NUM; i++)
+		{
+		/* a few keys on each curve, shared by several signatures */
+		if (i < 6)
+			{
+			keys[i] = EC_KEY_new_by_curve_name(nids[i & 1]);
+			if (keys[i] == NULL || !EC_KEY_generate_key(keys[i]))
+				goto batch_err;
+			}
+		else
+			{
+			keys[i] = keys[i - 6];
+			EC_KEY_up_ref(keys[i]);
+			}
+		if (!RAND_pseudo_bytes(digests[i], 32))
+			goto batch_err;
+		dgst[i] = digests[i];
+		dgst_len[i] = 32;
+		if ((sigs[i] = ECDSA_do_sign(dgst[i], 32, keys[i])) == NULL)
+			goto batch_err;
+		}
+	BIO_printf(out, ".");
+	(void)BIO_flush(out);
+
+	/* all good */
+	if (ECDSA_do_verify_batch(dgst, dgst_len,
+		(const ECDSA_SIG *const *)sigs, keys, BATCH_NUM, results) != 1)
+		goto batch_err;
+	for (i = 0; i < BATCH_NUM; i++)
+		if (results[i] != 1)
+			goto batch_err;
+	BIO_printf(out, ".");
+	(void)BIO_flush(out);
+
+	/* a wrong digest, a signature of another key, s out of range and
+	 * r of another signature */
+	digests[1][0] ^= 1;
+	ECDSA_SIG_free(sigs[4]);
+	if ((sigs[4] = ECDSA_do_sign(dgst[4], 32, keys[2])) == NULL)
+		goto batch_err;
+	if (!EC_GROUP_get_order(EC_KEY_get0_group(keys[7]), sigs[7]->s, NULL))
+		goto batch_err;
+	if (!BN_copy(sigs[10]->r, sigs[8]->r))
+		goto batch_err;
+	if (ECDSA_do_verify_batch(dgst, dgst_len,
+		(const ECDSA_SIG *const *)sigs, keys, BATCH_NUM, results) != 0)
+		goto batch_err;
+	for (i = 0; i < BATCH_NUM; i++)
+		{
+		expected = ECDSA_do_verify(dgst[i], 32, sigs[i], keys[i]);
+		if (results[i] != expected ||
+		    results[i] != (i != 1 && i != 4 && i != 7 && i != 10))
+			goto batch_err;
+		}
+	BIO_printf(out, ".");
+	(void)BIO_flush(out);
+
+	/* a first key without a group: the others are still verified */
+	digests[1][0] ^= 1;
+	ECDSA_SIG_free(sigs[10]);
+	if ((sigs[10] = ECDSA_do_sign(dgst[10], 32, keys[10])) == NULL)
+		goto batch_err;
+	EC_KEY_free(keys[0]);
+	if ((keys[0] = EC_KEY_new()) == NULL)
+		goto batch_err;
+	if (ECDSA_do_verify_batch(dgst, dgst_len,
+		(const ECDSA_SIG *const *)sigs, keys, BATCH_NUM, results) != -1)
+		goto batch_err;
+	for (i = 0; i < BATCH_NUM; i++)
+		if (results[i] != (i == 0 ? -1 : i == 4 || i == 7 ? 0 : 1))
+			goto batch_err;
+	BIO_printf(out, ".");
+	(void)BIO_flush(out);
+
+	/* an empty batch verifies */
+	if (ECDSA_do_verify_batch(dgst, dgst_len,
+		(const ECDSA_SIG *const *)sigs, keys, 0, results) != 1)
+		goto batch_err;
+	BIO_printf(out, ".");
+	(void)BIO_flush(out);
+
+	BIO_printf(out, " ok\n");
+	ret = 1;
+batch_err:
+	if (!ret)
+		BIO_printf(out, " failed\n");
+	/* clean bogus errors */
+	ERR_clear_error();
+	for (i = 0; i < BATCH_NUM; i++)
+		{
+		if (keys[i])
+			EC_KEY_free(keys[i]);
+		if (sigs[i])
+			ECDSA_SIG_free(sigs[i]);
+		}
+	return ret;
+	}
+
 int main(void)
 	{
 	int 	ret = 1;
@@ -568,6 +685,7 @@ int main(void)
 	/* the tests */
 	if (!x9_62_tests(out))  goto err;
 	if (!test_builtin(out)) goto err;
+	if (!test_batch(out))   goto err;
 	
 	ret = 0;
 err:	
@@ -283,6 +283,7 @@ ECDSA_METHOD *ECDSA_METHOD_new(ECDSA_METHOD *ecdsa_meth)
 		ret->ecdsa_sign_setup = 0;
 		ret->ecdsa_do_sign = 0;
 		ret->ecdsa_do_verify = 0;
+		ret->ecdsa_do_verify_batch = 0;
 		ret->name = NULL;
 		ret->flags = 0;
 		}
@@ -310,6 +311,16 @@ void ECDSA_METHOD_set_verify(ECDSA_METHOD *ecdsa_method,
 		const ECDSA_SIG *sig, EC_KEY *eckey))
 	{
 	ecdsa_method->ecdsa_do_verify = ecdsa_do_verify;
+	/* a batch verification of the copied method would bypass it */
+	ecdsa_method->ecdsa_do_verify_batch = 0;
+	}
+
+void ECDSA_METHOD_set_verify_batch(ECDSA_METHOD *ecdsa_method,
+	int (*ecdsa_do_verify_batch)(const unsigned char *const *dgst,
+		const int *dgst_len, const ECDSA_SIG *const *sig,
+		EC_KEY *const *eckey, size_t num, int *results))
+	{
+	ecdsa_method->ecdsa_do_verify_batch = ecdsa_do_verify_batch;
 	}
 
 void ECDSA_METHOD_set_flags(ECDSA_METHOD *ecdsa_method, int flags)
@@ -74,6 +74,9 @@ struct ecdsa_method
 			BIGNUM **r);
 	int (*ecdsa_do_verify)(const unsigned char *dgst, int dgst_len, 
 			const ECDSA_SIG *sig, EC_KEY *eckey);
+	int (*ecdsa_do_verify_batch)(const unsigned char *const *dgst,
+			const int *dgst_len, const ECDSA_SIG *const *sig,
+			EC_KEY *const *eckey, size_t num, int *results);
 #if 0
 	int (*init)(EC_KEY *eckey);
 	int (*finish)(EC_KEY *eckey);
@@ -73,12 +73,16 @@ static int ecdsa_sign_setup(EC_KEY *eckey, BN_CTX *ctx_in,
 					const unsigned char *dgst, int dlen);
 static int ecdsa_do_verify(const unsigned char *dgst, int dgst_len, 
 		const ECDSA_SIG *sig, EC_KEY *eckey);
+static int ecdsa_do_verify_batch(const unsigned char *const *dgst,
+		const int *dgst_len, const ECDSA_SIG *const *sig,
+		EC_KEY *const *eckey, size_t num, int *results);
 
 static ECDSA_METHOD openssl_ecdsa_meth = {
 	"OpenSSL ECDSA method",
 	ecdsa_do_sign,
 	ecdsa_sign_setup_no_digest,
 	ecdsa_do_verify,
+	ecdsa_do_verify_batch,
 #if 0
 	NULL, /* init     */
 	NULL, /* finish   */
@@ -396,10 +400,29 @@ err:
 	return ret;
 }
 
+/* m = the leftmost bits of the digest, as many as the order has */
+static int ecdsa_digest_to_bn(BIGNUM *m, const unsigned char *dgst,
+		int dgst_len, const BIGNUM *order)
+{
+	int i = BN_num_bits(order);
+
+	/* Need to truncate digest if it is too long: first truncate whole
+	 * bytes.
+	 */
+	if (8 * dgst_len > i)
+		dgst_len = (i + 7)/8;
+	if (!BN_bin2bn(dgst, dgst_len, m))
+		return 0;
+	/* If still too long truncate remaining bits with a shift */
+	if ((8 * dgst_len > i) && !BN_rshift(m, m, 8 - (i & 0x7)))
+		return 0;
+	return 1;
+}
+
 static int ecdsa_do_verify(const unsigned char *dgst, int dgst_len,
 		const ECDSA_SIG *sig, EC_KEY *eckey)
 {
-	int ret = -1, i;
+	int ret = -1;
 	BN_CTX   *ctx;
 	BIGNUM   *order, *u1, *u2, *m, *X;
 	EC_POINT *point = NULL;
@@ -461,19 +484,7 @@ static int ecdsa_do_verify(const unsigned char *dgst, int dgst_len,
 		goto err;
 	}
 	/* digest -> m */
-	i = BN_num_bits(order);
-	/* Need to truncate digest if it is too long: first truncate whole
-	 * bytes.
-	 */
-	if (8 * dgst_len > i)
-		dgst_len = (i + 7)/8;
-	if (!BN_bin2bn(dgst, dgst_len, m))
-	{
-		ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY, ERR_R_BN_LIB);
-		goto err;
-	}
-	/* If still too long truncate remaining bits with a shift */
-	if ((8 * dgst_len > i) && !BN_rshift(m, m, 8 - (i & 0x7)))
+	if (!ecdsa_digest_to_bn(m, dgst, dgst_len, order))
 	{
 		ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY, ERR_R_BN_LIB);
 		goto err;
@@ -536,6 +547,247 @@ err:
 	return ret;
 }
 
+/* Verifies the signatures whose keys have the group of the first one and
+ * this method in a batch: one BN_CTX, one inversion modulo the order for
+ * all the s (Montgomery's trick), u1*G + u2*Q with the precomputed
+ * multiples of the generator of the group, and one field inversion for
+ * all the x coordinates (EC_POINTs_make_affine()). The other signatures
+ * are verified one at a time. */
+static int ecdsa_do_verify_batch(const unsigned char *const *dgst,
+		const int *dgst_len, const ECDSA_SIG *const *sig,
+		EC_KEY *const *eckey, size_t num, int *results)
+{
+	int ret = 1;
+	BN_CTX   *ctx = NULL;
+	BIGNUM   *order, *u1, *u2, *m, *X, *inv;
+	BIGNUM   **w = NULL;
+	EC_POINT **points = NULL;
+	size_t   *idx = NULL;
+	size_t   i, j, n = 0;
+	const EC_GROUP *group, *g;
+	const EC_POINT *pub_key;
+	ECDSA_DATA *ecdsa;
+
+#ifdef OPENSSL_FIPS
+	if(FIPS_selftest_failed())
+		{
+		FIPSerr(FIPS_F_ECDSA_DO_VERIFY,FIPS_R_FIPS_SELFTEST_FAILED);
+		return -1;
+		}
+#endif
+
+	for (i = 0; i < num; i++)
+		results[i] = -1;
+
+	if ((group = EC_KEY_get0_group(eckey[0])) == NULL)
+	{
+		/* no batch: each signature is checked with its own key */
+		for (i = 0; i < num; i++)
+		{
+			results[i] = ECDSA_do_verify(dgst[i], dgst_len[i],
+				sig[i], eckey[i]);
+			if (results[i] < ret)
+				ret = results[i];
+		}
+		return ret;
+	}
+
+	if ((ctx = BN_CTX_new()) == NULL)
+	{
+		ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_MALLOC_FAILURE);
+		return -1;
+	}
+	BN_CTX_start(ctx);
+	w = OPENSSL_malloc(num * sizeof(*w));
+	points = OPENSSL_malloc(num * sizeof(*points));
+	idx = OPENSSL_malloc(num * sizeof(*idx));
+	if (w == NULL || points == NULL || idx == NULL)
+	{
+		ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_MALLOC_FAILURE);
+		ret = -1;
+		goto done;
+	}
+	order = BN_CTX_get(ctx);
+	u1    = BN_CTX_get(ctx);
+	u2    = BN_CTX_get(ctx);
+	m     = BN_CTX_get(ctx);
+	X     = BN_CTX_get(ctx);
+	inv   = BN_CTX_get(ctx);
+	if (!inv)
+	{
+		ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_BN_LIB);
+		ret = -1;
+		goto done;
+	}
+	if (!EC_GROUP_get_order(group, order, ctx))
+	{
+		ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_EC_LIB);
+		ret = -1;
+		goto done;
+	}
+
+	/* pick the signatures of the batch: idx[j] is the j-th of them */
+	for (i = 0; i < num; i++)
+	{
+		ecdsa = ecdsa_check(eckey[i]);
+		g = EC_KEY_get0_group(eckey[i]);
+		if (ecdsa == NULL || ecdsa->meth->ecdsa_do_verify !=
+			ecdsa_do_verify || g == NULL ||
+		    (g != group && (EC_GROUP_method_of(g) !=
+			EC_GROUP_method_of(group) ||
+			EC_GROUP_cmp(g, group, ctx) != 0)) ||
+		    EC_KEY_get0_public_key(eckey[i]) == NULL || sig[i] == NULL)
+		{
+			results[i] = ECDSA_do_verify(dgst[i], dgst_len[i],
+				sig[i], eckey[i]);
+			continue;
+		}
+		if (BN_is_zero(sig[i]->r)          ||
+		    BN_is_negative(sig[i]->r)      ||
+		    BN_ucmp(sig[i]->r, order) >= 0 || BN_is_zero(sig[i]->s) ||
+		    BN_is_negative(sig[i]->s)      ||
+		    BN_ucmp(sig[i]->s, order) >= 0)
+		{
+			ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ECDSA_R_BAD_SIGNATURE);
+			results[i] = 0;	/* signature is invalid */
+			continue;
+		}
+		idx[n] = i;
+		points[n] = NULL;
+		w[n++] = NULL;
+	}
+	if (n == 0)
+		goto done;
+
+	/* w[j] = s_0 * ... * s_j */
+	for (j = 0; j < n; j++)
+	{
+		const BIGNUM *s = sig[idx[j]]->s;
+
+		if ((w[j] = BN_new()) == NULL ||
+		    (j == 0 && !BN_copy(w[j], s)) ||
+		    (j > 0 && !BN_mod_mul(w[j], w[j - 1], s, order, ctx)))
+		{
+			ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_BN_LIB);
+			goto batch_err;
+		}
+	}
+	/* inv = 1/(s_0 * ... * s_j) going down, and w[j] = 1/s_j */
+	if (!BN_mod_inverse(inv, w[n - 1], order, ctx))
+	{
+		ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_BN_LIB);
+		goto batch_err;
+	}
+	for (j = n - 1; j > 0; j--)
+	{
+		if (!BN_mod_mul(w[j], w[j - 1], inv, order, ctx) ||
+		    !BN_mod_mul(inv, inv, sig[idx[j]]->s, order, ctx))
+		{
+			ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_BN_LIB);
+			goto batch_err;
+		}
+	}
+	if (!BN_copy(w[0], inv))
+	{
+		ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_BN_LIB);
+		goto batch_err;
+	}
+
+	for (j = 0; j < n; j++)
+	{
+		i = idx[j];
+		pub_key = EC_KEY_get0_public_key(eckey[i]);
+		if ((points[j] = EC_POINT_new(group)) == NULL)
+		{
+			ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_MALLOC_FAILURE);
+			goto batch_err;
+		}
+		/* u1 = m * w mod order, u2 = r * w mod order */
+		if (!ecdsa_digest_to_bn(m, dgst[i], dgst_len[i], order) ||
+		    !BN_mod_mul(u1, m, w[j], order, ctx) ||
+		    !BN_mod_mul(u2, sig[i]->r, w[j], order, ctx))
+		{
+			ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_BN_LIB);
+			goto batch_err;
+		}
+		if (!EC_POINT_mul(group, points[j], u1, pub_key, u2, ctx))
+		{
+			ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_EC_LIB);
+			goto batch_err;
+		}
+	}
+	if (!EC_POINTs_make_affine(group, n, points, ctx))
+	{
+		ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_EC_LIB);
+		goto batch_err;
+	}
+
+	for (j = 0; j < n; j++)
+	{
+		i = idx[j];
+		if (EC_POINT_is_at_infinity(group, points[j]))
+		{
+			results[i] = 0;
+			continue;
+		}
+		if (EC_METHOD_get_field_type(EC_GROUP_method_of(group)) == NID_X9_62_prime_field)
+		{
+			if (!EC_POINT_get_affine_coordinates_GFp(group,
+				points[j], X, NULL, ctx))
+			{
+				ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_EC_LIB);
+				goto batch_err;
+			}
+		}
+#ifndef OPENSSL_NO_EC2M
+		else /* NID_X9_62_characteristic_two_field */
+		{
+			if (!EC_POINT_get_affine_coordinates_GF2m(group,
+				points[j], X, NULL, ctx))
+			{
+				ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_EC_LIB);
+				goto batch_err;
+			}
+		}
+#endif
+		if (!BN_nnmod(u1, X, order, ctx))
+		{
+			ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY_BATCH, ERR_R_BN_LIB);
+			goto batch_err;
+		}
+		/*  if the signature is correct u1 is equal to sig->r */
+		results[i] = (BN_ucmp(u1, sig[i]->r) == 0);
+	}
+	goto done;
+
+batch_err:
+	for (j = 0; j < n; j++)
+		results[idx[j]] = -1;
+done:
+	if (ret == 1)
+	{
+		for (i = 0; i < num; i++)
+			if (results[i] < ret)
+				ret = results[i];
+	}
+	for (j = 0; j < n; j++)
+	{
+		if (w[j])
+			BN_free(w[j]);
+		if (points[j])
+			EC_POINT_free(points[j]);
+	}
+	BN_CTX_end(ctx);
+	BN_CTX_free(ctx);
+	if (w)
+		OPENSSL_free(w);
+	if (points)
+		OPENSSL_free(points);
+	if (idx)
+		OPENSSL_free(idx);
+	return ret;
+}
+
 #ifdef OPENSSL_FIPSCANISTER
 /* FIPS stanadlone version of ecdsa_check: just return FIPS method */
 ECDSA_DATA *fips_ecdsa_check(EC_KEY *key)
@@ -75,6 +75,37 @@ int ECDSA_do_verify(const unsigned char *dgst, int dgst_len,
 	return ecdsa->meth->ecdsa_do_verify(dgst, dgst_len, sig, eckey);
 	}
 
+/* returns
+ *      1: all signatures correct
+ *      0: an incorrect signature
+ *     -1: error
+ * and sets results[i] to what ECDSA_do_verify() returns for signature i
+ */
+int ECDSA_do_verify_batch(const unsigned char *const *dgst,
+		const int *dgst_len, const ECDSA_SIG *const *sig,
+		EC_KEY *const *eckey, size_t num, int *results)
+	{
+	ECDSA_DATA *ecdsa;
+	size_t i;
+	int ret = 1;
+
+	if (num == 0)
+		return 1;
+	ecdsa = ecdsa_check(eckey[0]);
+	if (ecdsa != NULL && ecdsa->meth->ecdsa_do_verify_batch != NULL)
+		return ecdsa->meth->ecdsa_do_verify_batch(dgst, dgst_len, sig,
+			eckey, num, results);
+
+	for (i = 0; i < num; i++)
+		{
+		results[i] = ECDSA_do_verify(dgst[i], dgst_len[i], sig[i],
+			eckey[i]);
+		if (results[i] < ret)
+			ret = results[i];
+		}
+	return ret;
+	}
+
 /* returns
  *      1: correct signature
  *      0: incorrect signature
@@ -463,11 +463,23 @@ static const EVP_CIPHER aes_##keylen##_##mode = { \
 const EVP_CIPHER *EVP_aes_##keylen##_##mode(void) \
 { return AESNI_CAPABLE?&aesni_##keylen##_##mode:&aes_##keylen##_##mode; }
 
+/* Only the AES-NI GCM ciphers seal or open several TLS records per call:
+ * without the stitched code there is nothing to gain */
+#if !defined(OPENSSL_NO_MULTIBLOCK) && !defined(OPENSSL_SMALL_FOOTPRINT) && \
+	defined(AES_gcm_encrypt)
+#define AES_GCM_MULTIBLOCK
+#define AESNI_GCM_FLAGS	EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK
+#else
+#define AESNI_GCM_FLAGS	0
+#endif
+#define AESNI_XTS_FLAGS	0
+#define AESNI_CCM_FLAGS	0
+
 #define BLOCK_CIPHER_custom(nid,keylen,blocksize,ivlen,mode,MODE,flags) \
 static const EVP_CIPHER aesni_##keylen##_##mode = { \
 	nid##_##keylen##_##mode,blocksize, \
 	(EVP_CIPH_##MODE##_MODE==EVP_CIPH_XTS_MODE?2:1)*keylen/8, ivlen, \
-	flags|EVP_CIPH_##MODE##_MODE,	\
+	flags|EVP_CIPH_##MODE##_MODE|AESNI_##MODE##_FLAGS,	\
 	aesni_##mode##_init_key,	\
 	aesni_##mode##_cipher,		\
 	aes_##mode##_cleanup,		\
@@ -1120,6 +1132,14 @@ static void ctr64_inc(unsigned char *counter) {
 	} while (n);
 }
 
+#ifdef AES_GCM_MULTIBLOCK
+static size_t aes_gcm_tls_multi_encrypt(EVP_CIPHER_CTX *c,
+		unsigned char *out, const unsigned char *inp, size_t len,
+		unsigned int n);
+static int aes_gcm_tls_multi_decrypt(EVP_CIPHER_CTX *c, unsigned char *inp,
+		size_t len, unsigned int n);
+#endif
+
 static int aes_gcm_ctrl(EVP_CIPHER_CTX *c, int type, int arg, void *ptr)
 	{
 	EVP_AES_GCM_CTX *gctx = c->cipher_data;
@@ -1231,6 +1251,65 @@ static int aes_gcm_ctrl(EVP_CIPHER_CTX *c, int type, int arg, void *ptr)
 		/* Extra padding: tag appended to record */
 		return EVP_GCM_TLS_TAG_LEN;
 
+#ifdef AES_GCM_MULTIBLOCK
+	case EVP_CTRL_TLS1_1_MULTIBLOCK_MAX_BUFSIZE:
+		/* Header, explicit IV, payload and tag */
+		return 5+EVP_GCM_TLS_EXPLICIT_IV_LEN+arg+EVP_GCM_TLS_TAG_LEN;
+
+	case EVP_CTRL_TLS1_1_MULTIBLOCK_AAD:
+		{
+		EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM *param =
+			(EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM *)ptr;
+		unsigned int n, frag, last;
+
+		if (arg<(int)sizeof(EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM))
+			return -1;
+		n = param->interleave;
+		if (n == 0 || n > 8 || (param->inp[11]|param->inp[12]))
+			return -1;
+		/* Keep sequence number, type and version; the length is
+		 * filled in for each record.
+		 */
+		memcpy(c->buf, param->inp, 13);
+		gctx->tls_aad_len = -1;
+		/* For opening tell where the payload of a record starts */
+		if (!c->encrypt)
+			return EVP_GCM_TLS_EXPLICIT_IV_LEN;
+
+		frag = param->len/n;
+		last = param->len-frag*(n-1);
+		if (frag == 0)
+			return -1;
+		return (int)((n-1)*(5+EVP_GCM_TLS_EXPLICIT_IV_LEN+frag+
+				EVP_GCM_TLS_TAG_LEN)+
+			5+EVP_GCM_TLS_EXPLICIT_IV_LEN+last+EVP_GCM_TLS_TAG_LEN);
+		}
+
+	case EVP_CTRL_TLS1_1_MULTIBLOCK_ENCRYPT:
+		{
+		EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM *param =
+			(EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM *)ptr;
+
+		if (!c->encrypt || param->interleave == 0 ||
+		    param->interleave > 8)
+			return -1;
+		return (int)aes_gcm_tls_multi_encrypt(c, param->out, param->inp,
+					param->len, param->interleave);
+		}
+
+	case EVP_CTRL_TLS1_1_MULTIBLOCK_DECRYPT:
+		{
+		EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM *param =
+			(EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM *)ptr;
+
+		if (c->encrypt || param->out != param->inp ||
+		    param->interleave == 0 || param->interleave > 8)
+			return -1;
+		return aes_gcm_tls_multi_decrypt(c, param->out, param->len,
+					param->interleave);
+		}
+#endif
+
 	default:
 		return -1;
 
@@ -1303,45 +1382,24 @@ static int aes_gcm_init_key(EVP_CIPHER_CTX *ctx, const unsigned char *key,
 	return 1;
 	}
 
-/* Handle TLS GCM packet format. This consists of the last portion of the IV
- * followed by the payload and finally the tag. On encrypt generate IV,
- * encrypt payload and write the tag. On verify retrieve IV, decrypt payload
- * and verify tag.
+/* Encrypt or decrypt the payload of a TLS GCM record once its IV and AAD
+ * are set, using the stitched AES-NI GCM code for the bulk if available.
  */
 
-static int aes_gcm_tls_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
-		const unsigned char *in, size_t len)
+static int aes_gcm_tls_payload(EVP_AES_GCM_CTX *gctx, int enc,
+		const unsigned char *in, unsigned char *out, size_t len)
 	{
-	EVP_AES_GCM_CTX *gctx = ctx->cipher_data;
-	int rv = -1;
-	/* Encrypt/decrypt must be performed in place */
-	if (out != in || len < (EVP_GCM_TLS_EXPLICIT_IV_LEN+EVP_GCM_TLS_TAG_LEN))
-		return -1;
-	/* Set IV from start of buffer or generate IV and write to start
-	 * of buffer.
-	 */
-	if (EVP_CIPHER_CTX_ctrl(ctx, ctx->encrypt ?
-				EVP_CTRL_GCM_IV_GEN : EVP_CTRL_GCM_SET_IV_INV,
-				EVP_GCM_TLS_EXPLICIT_IV_LEN, out) <= 0)
-		goto err;
-	/* Use saved AAD */
-	if (CRYPTO_gcm128_aad(&gctx->gcm, ctx->buf, gctx->tls_aad_len))
-		goto err;
-	/* Fix buffer and length to point to payload */
-	in += EVP_GCM_TLS_EXPLICIT_IV_LEN;
-	out += EVP_GCM_TLS_EXPLICIT_IV_LEN;
-	len -= EVP_GCM_TLS_EXPLICIT_IV_LEN + EVP_GCM_TLS_TAG_LEN;
-	if (ctx->encrypt)
+	size_t bulk=0;
+
+	if (enc)
 		{
-		/* Encrypt payload */
 		if (gctx->ctr)
 			{
-			size_t bulk=0;
 #if defined(AES_GCM_ASM)
 			if (len>=32 && AES_GCM_ASM(gctx))
 				{
 				if (CRYPTO_gcm128_encrypt(&gctx->gcm,NULL,NULL,0))
-					return -1;
+					return 0;
 
 				bulk = AES_gcm_encrypt(in,out,len,
 							gctx->gcm.key,
@@ -1355,15 +1413,14 @@ static int aes_gcm_tls_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
 							out+bulk,
 							len-bulk,
 							gctx->ctr))
-				goto err;
+				return 0;
 			}
 		else	{
-			size_t bulk=0;
 #if defined(AES_GCM_ASM2)
 			if (len>=32 && AES_GCM_ASM2(gctx))
 				{
 				if (CRYPTO_gcm128_encrypt(&gctx->gcm,NULL,NULL,0))
-					return -1;
+					return 0;
 
 				bulk = AES_gcm_encrypt(in,out,len,
 							gctx->gcm.key,
@@ -1376,24 +1433,18 @@ static int aes_gcm_tls_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
 							in +bulk,
 							out+bulk,
 							len-bulk))
-				goto err;
+				return 0;
 			}
-		out += len;
-		/* Finally write tag */
-		CRYPTO_gcm128_tag(&gctx->gcm, out, EVP_GCM_TLS_TAG_LEN);
-		rv = len + EVP_GCM_TLS_EXPLICIT_IV_LEN + EVP_GCM_TLS_TAG_LEN;
 		}
 	else
 		{
-		/* Decrypt */
 		if (gctx->ctr)
 			{
-			size_t bulk=0;
 #if defined(AES_GCM_ASM)
 			if (len>=16 && AES_GCM_ASM(gctx))
 				{
 				if (CRYPTO_gcm128_decrypt(&gctx->gcm,NULL,NULL,0))
-					return -1;
+					return 0;
 
 				bulk = AES_gcm_decrypt(in,out,len,
 							gctx->gcm.key,
@@ -1407,15 +1458,14 @@ static int aes_gcm_tls_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
 							out+bulk,
 							len-bulk,
 							gctx->ctr))
-				goto err;
+				return 0;
 			}
 		else	{
-			size_t bulk=0;
 #if defined(AES_GCM_ASM2)
 			if (len>=16 && AES_GCM_ASM2(gctx))
 				{
 				if (CRYPTO_gcm128_decrypt(&gctx->gcm,NULL,NULL,0))
-					return -1;
+					return 0;
 
 				bulk = AES_gcm_decrypt(in,out,len,
 							gctx->gcm.key,
@@ -1428,8 +1478,51 @@ static int aes_gcm_tls_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
 							in +bulk,
 							out+bulk,
 							len-bulk))
-				goto err;
+				return 0;
 			}
+		}
+	return 1;
+	}
+
+/* Handle TLS GCM packet format. This consists of the last portion of the IV
+ * followed by the payload and finally the tag. On encrypt generate IV,
+ * encrypt payload and write the tag. On verify retrieve IV, decrypt payload
+ * and verify tag.
+ */
+
+static int aes_gcm_tls_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
+		const unsigned char *in, size_t len)
+	{
+	EVP_AES_GCM_CTX *gctx = ctx->cipher_data;
+	int rv = -1;
+	/* Encrypt/decrypt must be performed in place */
+	if (out != in || len < (EVP_GCM_TLS_EXPLICIT_IV_LEN+EVP_GCM_TLS_TAG_LEN))
+		return -1;
+	/* Set IV from start of buffer or generate IV and write to start
+	 * of buffer.
+	 */
+	if (EVP_CIPHER_CTX_ctrl(ctx, ctx->encrypt ?
+				EVP_CTRL_GCM_IV_GEN : EVP_CTRL_GCM_SET_IV_INV,
+				EVP_GCM_TLS_EXPLICIT_IV_LEN, out) <= 0)
+		goto err;
+	/* Use saved AAD */
+	if (CRYPTO_gcm128_aad(&gctx->gcm, ctx->buf, gctx->tls_aad_len))
+		goto err;
+	/* Fix buffer and length to point to payload */
+	in += EVP_GCM_TLS_EXPLICIT_IV_LEN;
+	out += EVP_GCM_TLS_EXPLICIT_IV_LEN;
+	len -= EVP_GCM_TLS_EXPLICIT_IV_LEN + EVP_GCM_TLS_TAG_LEN;
+	if (!aes_gcm_tls_payload(gctx, ctx->encrypt, in, out, len))
+		goto err;
+	if (ctx->encrypt)
+		{
+		out += len;
+		/* Finally write tag */
+		CRYPTO_gcm128_tag(&gctx->gcm, out, EVP_GCM_TLS_TAG_LEN);
+		rv = len + EVP_GCM_TLS_EXPLICIT_IV_LEN + EVP_GCM_TLS_TAG_LEN;
+		}
+	else
+		{
 		/* Retrieve tag */
 		CRYPTO_gcm128_tag(&gctx->gcm, ctx->buf,
 					EVP_GCM_TLS_TAG_LEN);
@@ -1448,6 +1541,125 @@ static int aes_gcm_tls_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
 	return rv;
 	}
 
+#ifdef AES_GCM_MULTIBLOCK
+/* Multi-record TLS GCM. The AAD template saved by the
+ * EVP_CTRL_TLS1_1_MULTIBLOCK_AAD control holds the sequence number of the
+ * first record, which is advanced record by record. Unlike the CBC-HMAC
+ * ciphers GCM needs no interleaving of its own: the records are sealed or
+ * opened back to back, each in one pass of the stitched AES-NI GCM code,
+ * and the gain comes from doing a whole batch per call.
+ */
+
+static void aes_gcm_tls_next_aad(unsigned char *aad, int first,
+		size_t len)
+	{
+	int i;
+
+	if (!first)
+		{
+		for (i = 7; i >= 0 && ++aad[i] == 0; i--)
+			;
+		}
+	aad[11] = (unsigned char)(len>>8);
+	aad[12] = (unsigned char)len;
+	}
+
+static size_t aes_gcm_tls_multi_encrypt(EVP_CIPHER_CTX *c,
+		unsigned char *out, const unsigned char *inp, size_t len,
+		unsigned int n)
+	{
+	EVP_AES_GCM_CTX *gctx = c->cipher_data;
+	unsigned char aad[13];
+	size_t frag = len/n, last = len-frag*(n-1), rl, ret = 0;
+	unsigned int i;
+
+	memcpy(aad, c->buf, 13);
+	for (i = 0; i < n; i++)
+		{
+		rl = i == n-1 ? last : frag;
+		aes_gcm_tls_next_aad(aad, i == 0, rl);
+		/* Record header */
+		out[0] = aad[8];
+		out[1] = aad[9];
+		out[2] = aad[10];
+		out[3] = (EVP_GCM_TLS_EXPLICIT_IV_LEN+rl+EVP_GCM_TLS_TAG_LEN)>>8;
+		out[4] = (EVP_GCM_TLS_EXPLICIT_IV_LEN+rl+EVP_GCM_TLS_TAG_LEN)&0xff;
+		out += 5;
+		if (EVP_CIPHER_CTX_ctrl(c, EVP_CTRL_GCM_IV_GEN,
+				EVP_GCM_TLS_EXPLICIT_IV_LEN, out) <= 0 ||
+		    CRYPTO_gcm128_aad(&gctx->gcm, aad, 13) ||
+		    !aes_gcm_tls_payload(gctx, 1, inp,
+				out+EVP_GCM_TLS_EXPLICIT_IV_LEN, rl))
+			{
+			ret = 0;
+			break;
+			}
+		out += EVP_GCM_TLS_EXPLICIT_IV_LEN+rl;
+		CRYPTO_gcm128_tag(&gctx->gcm, out, EVP_GCM_TLS_TAG_LEN);
+		out += EVP_GCM_TLS_TAG_LEN;
+		inp += rl;
+		ret += 5+EVP_GCM_TLS_EXPLICIT_IV_LEN+rl+EVP_GCM_TLS_TAG_LEN;
+		}
+	gctx->iv_set = 0;
+	return ret;
+	}
+
+/* Decrypt in place up to |n| complete records laid out back to back in the
+ * |len| bytes at |inp|, headers included. Returns the number of leading
+ * records whose tags verified; a record that fails is wiped and ends the
+ * batch. Returns -1 if the records do not fill |len| bytes exactly.
+ */
+
+static int aes_gcm_tls_multi_decrypt(EVP_CIPHER_CTX *c, unsigned char *inp,
+		size_t len, unsigned int n)
+	{
+	EVP_AES_GCM_CTX *gctx = c->cipher_data;
+	unsigned char aad[13], *p;
+	size_t rl, off;
+	unsigned int i;
+
+	/* Check the framing before touching anything */
+	for (i = 0, off = 0; i < n; i++)
+		{
+		if (len-off < 5)
+			return -1;
+		off += 5+(inp[off+3]<<8|inp[off+4]);
+		if (off > len)
+			return -1;
+		}
+	if (off != len)
+		return -1;
+
+	memcpy(aad, c->buf, 13);
+	for (i = 0, p = inp; i < n; i++)
+		{
+		rl = p[3]<<8|p[4];
+		if (rl < EVP_GCM_TLS_EXPLICIT_IV_LEN+EVP_GCM_TLS_TAG_LEN)
+			break;
+		rl -= EVP_GCM_TLS_EXPLICIT_IV_LEN+EVP_GCM_TLS_TAG_LEN;
+		aes_gcm_tls_next_aad(aad, i == 0, rl);
+		aad[8] = p[0];
+		p += 5;
+		if (EVP_CIPHER_CTX_ctrl(c, EVP_CTRL_GCM_SET_IV_INV,
+				EVP_GCM_TLS_EXPLICIT_IV_LEN, p) <= 0 ||
+		    CRYPTO_gcm128_aad(&gctx->gcm, aad, 13))
+			break;
+		p += EVP_GCM_TLS_EXPLICIT_IV_LEN;
+		if (!aes_gcm_tls_payload(gctx, 0, p, p, rl))
+			break;
+		CRYPTO_gcm128_tag(&gctx->gcm, c->buf, EVP_GCM_TLS_TAG_LEN);
+		if (memcmp(c->buf, p+rl, EVP_GCM_TLS_TAG_LEN))
+			{
+			OPENSSL_cleanse(p, rl);
+			break;
+			}
+		p += rl+EVP_GCM_TLS_TAG_LEN;
+		}
+	gctx->iv_set = 0;
+	return (int)i;
+	}
+#endif
+
 static int aes_gcm_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
 		const unsigned char *in, size_t len)
 	{
@@ -170,7 +170,33 @@ static const char* const lock_names[CRYPTO_NUM_LOCKS] =
 	"comp",
 	"fips",
 	"fips2",
-#if CRYPTO_NUM_LOCKS != 41
+	"ssl_sess_shard0",
+	"ssl_sess_shard1",
+	"ssl_sess_shard2",
+	"ssl_sess_shard3",
+	"ssl_sess_shard4",
+	"ssl_sess_shard5",
+	"ssl_sess_shard6",
+	"ssl_sess_shard7",
+	"ssl_sess_shard8",
+	"ssl_sess_shard9",
+	"ssl_sess_shard10",
+	"ssl_sess_shard11",
+	"ssl_sess_shard12",
+	"ssl_sess_shard13",
+	"ssl_sess_shard14",
+	"ssl_sess_shard15",
+	"ssl_ticket_keys",
+	"ssl_buf_pool0",
+	"ssl_buf_pool1",
+	"ssl_buf_pool2",
+	"ssl_buf_pool3",
+	"ssl_buf_pool4",
+	"ssl_buf_pool5",
+	"ssl_buf_pool6",
+	"ssl_buf_pool7",
+	"ssl_cipher_list",
+#if CRYPTO_NUM_LOCKS != 67
 # error "Inconsistency between crypto.h and cryptlib.c"
 #endif
 	};
@@ -158,6 +158,9 @@ struct rsa_st
 	char *bignum_data;
 	BN_BLINDING *blinding;
 	BN_BLINDING *mt_blinding;
+	/* blinding factors claimed without locking by concurrent private
+	 * key operations (see rsa_crpt.c) */
+	struct rsa_blinding_pool_st *blinding_pool;
 	};
 
 #ifndef OPENSSL_RSA_MAX_MODULUS_BITS
@@ -219,6 +222,11 @@ struct rsa_st
                                                 */
 #endif
 
+/* Internal: set by the built-in implementation once it has set up one of
+ * its Montgomery contexts; those already set up are then read without
+ * taking CRYPTO_LOCK_RSA */
+#define RSA_FLAG_MONT_PRECOMPUTED	0x1000
+
 
 #define EVP_PKEY_CTX_set_rsa_padding(ctx, pad) \
 	EVP_PKEY_CTX_ctrl(ctx, EVP_PKEY_RSA, -1, EVP_PKEY_CTRL_RSA_PADDING, \
@@ -62,6 +62,7 @@
 #include <openssl/rsa.h>
 #include <openssl/x509.h>
 #include <openssl/asn1t.h>
+#include "rsa_locl.h"
 
 /* Override the default free and new methods */
 static int rsa_cb(int operation, ASN1_VALUE **pval, const ASN1_ITEM *it,
@@ -75,6 +76,14 @@ static int rsa_cb(int operation, ASN1_VALUE **pval, const ASN1_ITEM *it,
 		RSA_free((RSA *)*pval);
 		*pval = NULL;
 		return 2;
+	} else if(operation == ASN1_OP_D2I_POST && it == ASN1_ITEM_rptr(RSAPrivateKey)) {
+		/* The key is not shared yet: set up what private key
+		 * operations would otherwise set up under a lock */
+		BN_CTX *ctx = BN_CTX_new();
+		int ret = ctx != NULL && rsa_mont_precompute((RSA *)*pval, ctx);
+		if (ctx != NULL)
+			BN_CTX_free(ctx);
+		return ret;
 	}
 	return 1;
 }
@@ -65,6 +65,7 @@
 #include <openssl/bn.h>
 #include <openssl/rsa.h>
 #include <openssl/rand.h>
+#include "rsa_locl.h"
 
 int RSA_size(const RSA *r)
 	{
@@ -222,3 +223,129 @@ err:
 
 	return ret;
 }
+
+#ifdef RSA_BLINDING_POOL
+
+struct rsa_blinding_pool_st
+	{
+	/* a cache line per slot, as each is written by the thread claiming it */
+	union
+		{
+		struct
+			{
+			int busy;
+			BN_BLINDING *b;
+			} s;
+		char pad[64];
+		} slot[RSA_BLINDING_POOL_SIZE];
+	};
+
+/* Claims a blinding factor for the calling thread only, setting it up if
+ * it is used for the first time.  Returns the slot to be passed to
+ * rsa_blinding_pool_release(), or -1 if none could be claimed. */
+int rsa_blinding_pool_claim(RSA *rsa, BN_BLINDING **pb, BN_CTX *ctx)
+	{
+	struct rsa_blinding_pool_st *pool;
+	CRYPTO_THREADID cur;
+	unsigned long h;
+	int i, n;
+
+	pool = *(struct rsa_blinding_pool_st * volatile *)&rsa->blinding_pool;
+	if (pool == NULL)
+		{
+		pool = OPENSSL_malloc(sizeof *pool);
+		if (pool == NULL)
+			return -1;
+		memset(pool, 0, sizeof *pool);
+		if (!__sync_bool_compare_and_swap(&rsa->blinding_pool,
+						  NULL, pool))
+			{
+			OPENSSL_free(pool);
+			pool = rsa->blinding_pool;
+			}
+		}
+
+	/* Start where this thread did last time, so that a thread on its
+	 * own keeps using the same factor. */
+	CRYPTO_THREADID_current(&cur);
+	h = CRYPTO_THREADID_hash(&cur);
+	h ^= h >> 16;
+	h ^= h >> 6;
+	for (i = 0; i < RSA_BLINDING_POOL_SIZE; i++)
+		{
+		n = (int)((h + i) % RSA_BLINDING_POOL_SIZE);
+		if (*(volatile int *)&pool->slot[n].s.busy ||
+		    __sync_lock_test_and_set(&pool->slot[n].s.busy, 1))
+			continue;
+		if (pool->slot[n].s.b == NULL &&
+		    (pool->slot[n].s.b = RSA_setup_blinding(rsa, ctx)) == NULL)
+			{
+			__sync_lock_release(&pool->slot[n].s.busy);
+			return -1;
+			}
+		*pb = pool->slot[n].s.b;
+		return n;
+		}
+	return -1;
+	}
+
+void rsa_blinding_pool_release(RSA *rsa, int slot)
+	{
+	__sync_lock_release(&rsa->blinding_pool->slot[slot].s.busy);
+	}
+
+void rsa_blinding_pool_free(struct rsa_blinding_pool_st *pool)
+	{
+	int i;
+
+	for (i = 0; i < RSA_BLINDING_POOL_SIZE; i++)
+		if (pool->slot[i].s.b != NULL)
+			BN_BLINDING_free(pool->slot[i].s.b);
+	OPENSSL_free(pool);
+	}
+
+#endif
+
+/* Sets up the Montgomery contexts the built-in implementation caches, so
+ * that no private key operation has to set them up under the lock.  Called
+ * when a key is decoded; other keys get them on first use. */
+int rsa_mont_precompute(RSA *rsa, BN_CTX *ctx)
+	{
+	BIGNUM local_p, local_q;
+	BIGNUM *p, *q;
+
+	if (!(rsa->flags & RSA_FLAG_CACHE_PUBLIC) ||
+	    !(rsa->flags & RSA_FLAG_CACHE_PRIVATE) ||
+	    rsa->n == NULL || rsa->p == NULL || rsa->q == NULL)
+		return 1;
+	/* leave the errors of a bad key to the operations using it */
+	if (!BN_is_odd(rsa->n) || !BN_is_odd(rsa->p) || !BN_is_odd(rsa->q))
+		return 1;
+
+	/* as in RSA_eay_mod_exp() */
+	if (!(rsa->flags & RSA_FLAG_NO_CONSTTIME))
+		{
+		BN_init(&local_p);
+		p = &local_p;
+		BN_with_flags(p, rsa->p, BN_FLG_CONSTTIME);
+
+		BN_init(&local_q);
+		q = &local_q;
+		BN_with_flags(q, rsa->q, BN_FLG_CONSTTIME);
+		}
+	else
+		{
+		p = rsa->p;
+		q = rsa->q;
+		}
+
+	if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_n, CRYPTO_LOCK_RSA,
+				    rsa->n, ctx) ||
+	    !BN_MONT_CTX_set_locked(&rsa->_method_mod_p, CRYPTO_LOCK_RSA,
+				    p, ctx) ||
+	    !BN_MONT_CTX_set_locked(&rsa->_method_mod_q, CRYPTO_LOCK_RSA,
+				    q, ctx))
+		return 0;
+	rsa->flags |= RSA_FLAG_MONT_PRECOMPUTED;
+	return 1;
+	}
@@ -116,6 +116,7 @@
 #include <openssl/bn.h>
 #include <openssl/rsa.h>
 #include <openssl/rand.h>
+#include "rsa_locl.h"
 #ifdef OPENSSL_FIPS
 #include <openssl/fips.h>
 #endif
@@ -155,6 +156,25 @@ const RSA_METHOD *RSA_PKCS1_SSLeay(void)
 	return(&rsa_pkcs1_eay_meth);
 	}
 
+/* Returns the Montgomery context cached in '*pmont' for 'mod', setting it
+ * up if needed */
+static int rsa_mont_ctx(RSA *rsa, BN_MONT_CTX **pmont, const BIGNUM *mod,
+	BN_CTX *ctx)
+	{
+	/* a context once set up is not changed until RSA_eay_finish() */
+	if ((rsa->flags & RSA_FLAG_MONT_PRECOMPUTED) && *pmont != NULL)
+		return 1;
+	if (BN_MONT_CTX_set_locked(pmont, CRYPTO_LOCK_RSA, mod, ctx) == NULL)
+		return 0;
+	if (!(rsa->flags & RSA_FLAG_MONT_PRECOMPUTED))
+		{
+		CRYPTO_w_lock(CRYPTO_LOCK_RSA);
+		rsa->flags |= RSA_FLAG_MONT_PRECOMPUTED;
+		CRYPTO_w_unlock(CRYPTO_LOCK_RSA);
+		}
+	return 1;
+	}
+
 static int RSA_eay_public_encrypt(int flen, const unsigned char *from,
 	     unsigned char *to, RSA *rsa, int padding)
 	{
@@ -244,7 +264,7 @@ static int RSA_eay_public_encrypt(int flen, const unsigned char *from,
 		}
 
 	if (rsa->flags & RSA_FLAG_CACHE_PUBLIC)
-		if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_n, CRYPTO_LOCK_RSA, rsa->n, ctx))
+		if (!rsa_mont_ctx(rsa, &rsa->_method_mod_n, rsa->n, ctx))
 			goto err;
 
 	if (!rsa->meth->bn_mod_exp(ret,f,rsa->e,rsa->n,ctx,
@@ -272,12 +292,25 @@ err:
 	return(r);
 	}
 
-static BN_BLINDING *rsa_get_blinding(RSA *rsa, int *local, BN_CTX *ctx)
+/* On return '*slot' is the slot of rsa->blinding_pool to be released when
+ * done with the blinding returned, or -1 */
+static BN_BLINDING *rsa_get_blinding(RSA *rsa, int *local, int *slot,
+	BN_CTX *ctx)
 {
 	BN_BLINDING *ret;
 	int got_write_lock = 0;
 	CRYPTO_THREADID cur;
 
+	*slot = -1;
+#ifdef RSA_BLINDING_POOL
+	if ((*slot = rsa_blinding_pool_claim(rsa, &ret, ctx)) >= 0)
+		{
+		/* the claiming thread has it to itself */
+		*local = 1;
+		return ret;
+		}
+#endif
+
 	CRYPTO_r_lock(CRYPTO_LOCK_RSA);
 
 	if (rsa->blinding == NULL)
@@ -380,6 +413,7 @@ static int RSA_eay_private_encrypt(int flen, const unsigned char *from,
 	 * the unblinding factor outside the blinding structure. */
 	BIGNUM *unblind = NULL;
 	BN_BLINDING *blinding = NULL;
+	int blinding_slot = -1;
 
 #ifdef OPENSSL_FIPS
 	if(FIPS_selftest_failed())
@@ -437,7 +471,8 @@ static int RSA_eay_private_encrypt(int flen, const unsigned char *from,
 
 	if (!(rsa->flags & RSA_FLAG_NO_BLINDING))
 		{
-		blinding = rsa_get_blinding(rsa, &local_blinding, ctx);
+		blinding = rsa_get_blinding(rsa, &local_blinding,
+			&blinding_slot, ctx);
 		if (blinding == NULL)
 			{
 			RSAerr(RSA_F_RSA_EAY_PRIVATE_ENCRYPT, ERR_R_INTERNAL_ERROR);
@@ -480,7 +515,7 @@ static int RSA_eay_private_encrypt(int flen, const unsigned char *from,
 			d= rsa->d;
 
 		if (rsa->flags & RSA_FLAG_CACHE_PUBLIC)
-			if(!BN_MONT_CTX_set_locked(&rsa->_method_mod_n, CRYPTO_LOCK_RSA, rsa->n, ctx))
+			if(!rsa_mont_ctx(rsa, &rsa->_method_mod_n, rsa->n, ctx))
 				goto err;
 
 		if (!rsa->meth->bn_mod_exp(ret,f,d,rsa->n,ctx,
@@ -511,6 +546,10 @@ static int RSA_eay_private_encrypt(int flen, const unsigned char *from,
 
 	r=num;
 err:
+#ifdef RSA_BLINDING_POOL
+	if (blinding_slot >= 0)
+		rsa_blinding_pool_release(rsa, blinding_slot);
+#endif
 	if (ctx != NULL)
 		{
 		BN_CTX_end(ctx);
@@ -538,6 +577,7 @@ static int RSA_eay_private_decrypt(int flen, const unsigned char *from,
 	 * the unblinding factor outside the blinding structure. */
 	BIGNUM *unblind = NULL;
 	BN_BLINDING *blinding = NULL;
+	int blinding_slot = -1;
 
 #ifdef OPENSSL_FIPS
 	if(FIPS_selftest_failed())
@@ -585,7 +625,8 @@ static int RSA_eay_private_decrypt(int flen, const unsigned char *from,
 
 	if (!(rsa->flags & RSA_FLAG_NO_BLINDING))
 		{
-		blinding = rsa_get_blinding(rsa, &local_blinding, ctx);
+		blinding = rsa_get_blinding(rsa, &local_blinding,
+			&blinding_slot, ctx);
 		if (blinding == NULL)
 			{
 			RSAerr(RSA_F_RSA_EAY_PRIVATE_DECRYPT, ERR_R_INTERNAL_ERROR);
@@ -628,7 +669,7 @@ static int RSA_eay_private_decrypt(int flen, const unsigned char *from,
 			d = rsa->d;
 
 		if (rsa->flags & RSA_FLAG_CACHE_PUBLIC)
-			if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_n, CRYPTO_LOCK_RSA, rsa->n, ctx))
+			if (!rsa_mont_ctx(rsa, &rsa->_method_mod_n, rsa->n, ctx))
 				goto err;
 		if (!rsa->meth->bn_mod_exp(ret,f,d,rsa->n,ctx,
 				rsa->_method_mod_n))
@@ -666,6 +707,10 @@ static int RSA_eay_private_decrypt(int flen, const unsigned char *from,
 		RSAerr(RSA_F_RSA_EAY_PRIVATE_DECRYPT,RSA_R_PADDING_CHECK_FAILED);
 
 err:
+#ifdef RSA_BLINDING_POOL
+	if (blinding_slot >= 0)
+		rsa_blinding_pool_release(rsa, blinding_slot);
+#endif
 	if (ctx != NULL)
 		{
 		BN_CTX_end(ctx);
@@ -755,7 +800,7 @@ static int RSA_eay_public_decrypt(int flen, const unsigned char *from,
 		}
 
 	if (rsa->flags & RSA_FLAG_CACHE_PUBLIC)
-		if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_n, CRYPTO_LOCK_RSA, rsa->n, ctx))
+		if (!rsa_mont_ctx(rsa, &rsa->_method_mod_n, rsa->n, ctx))
 			goto err;
 
 	if (!rsa->meth->bn_mod_exp(ret,f,rsa->e,rsa->n,ctx,
@@ -836,15 +881,15 @@ static int RSA_eay_mod_exp(BIGNUM *r0, const BIGNUM *I, RSA *rsa, BN_CTX *ctx)
 
 		if (rsa->flags & RSA_FLAG_CACHE_PRIVATE)
 			{
-			if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_p, CRYPTO_LOCK_RSA, p, ctx))
+			if (!rsa_mont_ctx(rsa, &rsa->_method_mod_p, p, ctx))
 				goto err;
-			if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_q, CRYPTO_LOCK_RSA, q, ctx))
+			if (!rsa_mont_ctx(rsa, &rsa->_method_mod_q, q, ctx))
 				goto err;
 			}
 	}
 
 	if (rsa->flags & RSA_FLAG_CACHE_PUBLIC)
-		if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_n, CRYPTO_LOCK_RSA, rsa->n, ctx))
+		if (!rsa_mont_ctx(rsa, &rsa->_method_mod_n, rsa->n, ctx))
 			goto err;
 
 	/* compute I mod q */
@@ -975,6 +1020,7 @@ static int RSA_eay_init(RSA *rsa)
 
 static int RSA_eay_finish(RSA *rsa)
 	{
+	rsa->flags &= ~RSA_FLAG_MONT_PRECOMPUTED;
 	if (rsa->_method_mod_n != NULL)
 		BN_MONT_CTX_free(rsa->_method_mod_n);
 	if (rsa->_method_mod_p != NULL)
@@ -2,3 +2,17 @@ extern int int_rsa_verify(int dtype, const unsigned char *m, unsigned int m_len,
 		unsigned char *rm, size_t *prm_len,
 		const unsigned char *sigbuf, size_t siglen,
 		RSA *rsa);
+
+/* With atomic operations each private key operation claims one of a set of
+ * blinding factors kept with the key, so concurrent operations neither
+ * share a BN_BLINDING nor take CRYPTO_LOCK_RSA_BLINDING. */
+#if defined(__GNUC__) && !defined(OPENSSL_NO_RSA_BLINDING_POOL)
+# define RSA_BLINDING_POOL
+# define RSA_BLINDING_POOL_SIZE	16
+
+int rsa_blinding_pool_claim(RSA *rsa, BN_BLINDING **pb, BN_CTX *ctx);
+void rsa_blinding_pool_release(RSA *rsa, int slot);
+void rsa_blinding_pool_free(struct rsa_blinding_pool_st *pool);
+#endif
+
+int rsa_mont_precompute(RSA *rsa, BN_CTX *ctx);
@@ -60,6 +60,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <time.h>
 #ifdef LINUX
 #include <typedefs.h>
 #endif
@@ -144,10 +145,20 @@ int thread_number=10;
 int number_of_loops=10;
 int reconnect=0;
 int cache_stats=0;
+int sharded_cache=0;
+int lookup_sessions=0;
+long lookup_timeout=0;
+int add_latency=0;
+int add_flush=0;
+static SSL_SESSION **lookup_sess=NULL;
+static unsigned char lookup_salt[SSL3_SSL_SESSION_ID_LENGTH];
 
 static const char rnd_seed[] = "string to make the random number generator think it has entropy";
 
 int doit(char *ctx[4]);
+static int lookup_setup(SSL_CTX *s_ctx);
+static int lookup_doit(SSL_CTX *s_ctx);
+static int latency_doit(SSL_CTX *s_ctx);
 static void print_stats(FILE *fp, SSL_CTX *ctx)
 {
 	fprintf(fp,"%4ld items in the session cache\n",
@@ -178,6 +189,17 @@ static void sv_usage(void)
 	fprintf(stderr," -loops arg    - number of 'connections', per thread\n");
 	fprintf(stderr," -reconnect    - reuse session-id's\n");
 	fprintf(stderr," -stats        - server session-id cache stats\n");
+	fprintf(stderr," -sharded      - use a sharded server session cache\n");
+	fprintf(stderr," -lookups arg  - fill the server cache with 'arg' sessions and\n");
+	fprintf(stderr,"                 time 'loops' lookups per thread instead of\n");
+	fprintf(stderr,"                 doing handshakes\n");
+	fprintf(stderr," -timeout arg  - timeout of the '-lookups' sessions, so that\n");
+	fprintf(stderr,"                 they expire while being looked up\n");
+	fprintf(stderr," -latency      - with '-lookups', have those sessions expired and\n");
+	fprintf(stderr,"                 time 'loops' additions of new ones in one\n");
+	fprintf(stderr,"                 thread instead, printing percentiles\n");
+	fprintf(stderr," -flush        - with '-latency', also flush the cache every 255\n");
+	fprintf(stderr,"                 additions, as ssl_update_cache() once did\n");
 	fprintf(stderr," -cert arg     - server certificate/key\n");
 	fprintf(stderr," -ccert arg    - client certificate/key\n");
 	fprintf(stderr," -ssl3         - just SSLv3n\n");
@@ -215,6 +237,22 @@ int main(int argc, char *argv[])
 			reconnect=1;
 		else if	(strcmp(*argv,"-stats") == 0)
 			cache_stats=1;
+		else if	(strcmp(*argv,"-sharded") == 0)
+			sharded_cache=1;
+		else if	(strcmp(*argv,"-lookups") == 0)
+			{
+			if (--argc < 1) goto bad;
+			lookup_sessions= atoi(*(++argv));
+			}
+		else if	(strcmp(*argv,"-timeout") == 0)
+			{
+			if (--argc < 1) goto bad;
+			lookup_timeout= atol(*(++argv));
+			}
+		else if	(strcmp(*argv,"-latency") == 0)
+			add_latency=1;
+		else if	(strcmp(*argv,"-flush") == 0)
+			add_flush=1;
 		else if	(strcmp(*argv,"-ssl3") == 0)
 			ssl_method=SSLv3_method();
 		else if	(strcmp(*argv,"-ssl2") == 0)
@@ -284,7 +322,8 @@ bad:
 		}
 
 	SSL_CTX_set_session_cache_mode(s_ctx,
-		SSL_SESS_CACHE_NO_AUTO_CLEAR|SSL_SESS_CACHE_SERVER);
+		SSL_SESS_CACHE_NO_AUTO_CLEAR|SSL_SESS_CACHE_SERVER|
+		(sharded_cache?SSL_SESS_CACHE_SHARDED:0));
 	SSL_CTX_set_session_cache_mode(c_ctx,
 		SSL_SESS_CACHE_NO_AUTO_CLEAR|SSL_SESS_CACHE_SERVER);
 
@@ -330,8 +369,26 @@ bad:
 			verify_callback);
 		}
 
+	if (lookup_sessions > 0 && !lookup_setup(s_ctx))
+		goto end;
+
 	thread_setup();
-	do_threads(s_ctx,c_ctx);
+	if (lookup_sessions > 0 && add_latency)
+		ret=latency_doit(s_ctx);
+	else if (lookup_sessions > 0)
+		{
+		time_t start=time(NULL);
+		double secs;
+
+		do_threads(s_ctx,c_ctx);
+		secs=difftime(time(NULL),start);
+		if (secs < 1) secs=1;
+		fprintf(stderr,"%d threads, %s cache: %.0f lookups/s\n",
+			thread_number,sharded_cache?"sharded":"single",
+			(double)thread_number*number_of_loops/secs);
+		}
+	else
+		do_threads(s_ctx,c_ctx);
 	thread_cleanup();
 end:
 	
@@ -358,6 +415,14 @@ end:
 		SSL_CTX_free(s_ctx);
 		fprintf(stderr,"done free\n");
 		}
+	if (lookup_sess != NULL)
+		{
+		int i;
+
+		for (i=0; i<lookup_sessions; i++)
+			SSL_SESSION_free(lookup_sess[i]);
+		OPENSSL_free(lookup_sess);
+		}
 	exit(ret);
 	return(0);
 	}
@@ -373,6 +438,9 @@ int ndoit(SSL_CTX *ssl_ctx[2])
 	int ret;
 	char *ctx[4];
 
+	if (lookup_sessions > 0)
+		return(lookup_doit(ssl_ctx[0]));
+
 	ctx[0]=(char *)ssl_ctx[0];
 	ctx[1]=(char *)ssl_ctx[1];
 
@@ -416,6 +484,148 @@ int ndoit(SSL_CTX *ssl_ctx[2])
 	return(0);
 	}
 
+static void lookup_id(int n, unsigned char id[SSL3_SSL_SESSION_ID_LENGTH])
+	{
+	memcpy(id,lookup_salt,SSL3_SSL_SESSION_ID_LENGTH);
+	id[0]=(unsigned char)(n    );
+	id[1]=(unsigned char)(n>> 8);
+	id[2]=(unsigned char)(n>>16);
+	id[3]=(unsigned char)(n>>24);
+	}
+
+/* Fills the server session cache with 'lookup_sessions' dummy sessions
+ * for lookup_doit() to look up. */
+static int lookup_setup(SSL_CTX *s_ctx)
+	{
+	SSL *s;
+	int i;
+
+	SSL_CTX_sess_set_cache_size(s_ctx,0);
+	RAND_pseudo_bytes(lookup_salt,sizeof lookup_salt);
+	lookup_sess=OPENSSL_malloc(lookup_sessions*sizeof(SSL_SESSION *));
+	if ((lookup_sess == NULL) || ((s=SSL_new(s_ctx)) == NULL))
+		return(0);
+	for (i=0; i<lookup_sessions; i++)
+		{
+		if ((lookup_sess[i]=SSL_SESSION_new()) == NULL)
+			return(0);
+		lookup_sess[i]->ssl_version=s->version;
+		lookup_sess[i]->session_id_length=SSL3_SSL_SESSION_ID_LENGTH;
+		lookup_id(i,lookup_sess[i]->session_id);
+		if (lookup_timeout > 0)
+			SSL_SESSION_set_timeout(lookup_sess[i],lookup_timeout);
+		/* expired a second before the additions start */
+		if (add_latency)
+			SSL_SESSION_set_time(lookup_sess[i],(long)time(NULL)-
+				SSL_SESSION_get_timeout(lookup_sess[i])-1);
+		SSL_CTX_add_session(s_ctx,lookup_sess[i]);
+		}
+	SSL_free(s);
+	return(1);
+	}
+
+/* Looks up random sessions in the server session cache, replacing every
+ * 16th one so that readers contend with writers as during a resumption
+ * storm. With '-timeout' the sessions expire during the run and are
+ * only put back, as new sessions, when they are next replaced. */
+static int lookup_doit(SSL_CTX *s_ctx)
+	{
+	unsigned char id[SSL3_SSL_SESSION_ID_LENGTH];
+	unsigned long seed;
+	SSL *s;
+	int i,n,miss=0;
+
+	if ((s=SSL_new(s_ctx)) == NULL)
+		return(1);
+	seed=CRYPTO_thread_id();
+	for (i=0; i<number_of_loops; i++)
+		{
+		seed=seed*1103515245+12345;
+		n=(int)((seed>>8)%lookup_sessions);
+		if ((i & 15) == 15)
+			{
+			SSL_CTX_remove_session(s_ctx,lookup_sess[n]);
+			SSL_SESSION_set_time(lookup_sess[n],(long)time(NULL));
+			SSL_CTX_add_session(s_ctx,lookup_sess[n]);
+			continue;
+			}
+		lookup_id(n,id);
+		if (!SSL_has_matching_session_id(s,id,sizeof id))
+			miss++;
+		}
+	SSL_free(s);
+	/* Sessions are only missing briefly while being replaced */
+	if (lookup_timeout == 0 && miss > number_of_loops/16)
+		{
+		fprintf(stdout,"thread %lu: %d lookups missed\n",
+			CRYPTO_thread_id(),miss);
+		return(1);
+		}
+	return(0);
+	}
+
+static double latency_now(void)
+	{
+#if defined(OPENSSL_SYS_UNIX) && defined(CLOCK_MONOTONIC)
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+	return(ts.tv_sec*1e9+ts.tv_nsec);
+#else
+	return(clock()*(1e9/CLOCKS_PER_SEC));
+#endif
+	}
+
+static int latency_cmp(const void *a, const void *b)
+	{
+	double x= *(const double *)a,y= *(const double *)b;
+
+	return((x > y)-(x < y));
+	}
+
+/* Adds 'loops' new sessions to the server session cache, which removes
+ * the expired '-lookups' sessions as it goes, and prints how long the
+ * additions took: the share of a handshake spent caching its session. */
+static int latency_doit(SSL_CTX *s_ctx)
+	{
+	SSL_SESSION *sess;
+	double *lat,t;
+	int i,n=number_of_loops;
+
+	if ((lat=OPENSSL_malloc(n*sizeof(double))) == NULL)
+		return(1);
+	/* removing expired sessions is up to the additions now */
+	SSL_CTX_set_session_cache_mode(s_ctx,
+		SSL_CTX_get_session_cache_mode(s_ctx)&
+		~SSL_SESS_CACHE_NO_AUTO_CLEAR);
+	for (i=0; i<n; i++)
+		{
+		if ((sess=SSL_SESSION_new()) == NULL)
+			{
+			OPENSSL_free(lat);
+			return(1);
+			}
+		sess->ssl_version=lookup_sess[0]->ssl_version;
+		sess->session_id_length=SSL3_SSL_SESSION_ID_LENGTH;
+		lookup_id(lookup_sessions+i,sess->session_id);
+		if (lookup_timeout > 0)
+			SSL_SESSION_set_timeout(sess,lookup_timeout);
+		t=latency_now();
+		SSL_CTX_add_session(s_ctx,sess);
+		if (add_flush && (i & 0xff) == 0xff)
+			SSL_CTX_flush_sessions(s_ctx,(long)time(NULL));
+		lat[i]=latency_now()-t;
+		SSL_SESSION_free(sess);
+		}
+	qsort(lat,n,sizeof(double),latency_cmp);
+	fprintf(stderr,"%s cache, %d expired: %d additions take "
+		"p50 %.0f ns, p99 %.0f ns, p99.9 %.0f ns, max %.0f ns\n",
+		sharded_cache?"sharded":"single",lookup_sessions,n,
+		lat[n/2],lat[(int)(n*0.99)],lat[(int)(n*0.999)],lat[n-1]);
+	OPENSSL_free(lat);
+	return(0);
+	}
+
 int doit(char *ctx[4])
 	{
 	SSL_CTX *s_ctx,*c_ctx;
@@ -71,7 +71,22 @@
 
 #include <openssl/lhash.h>
 #include <openssl/x509.h>
-
+#include "x509_lcl.h"
+
+/* The names of the files in a directory are read into an index, so that
+ * the files it lists are loaded without probing for them first and names
+ * it does not list cost no system call at all.  The index also remembers
+ * the certificate files already loaded: what they hold is in the store.
+ * At most once a second a lookup compares the modification time of the
+ * directory with the one the index was read at, and reads it again if it
+ * changed: files added to the directory are found within a second.  A
+ * directory that cannot be listed has its files probed for, and a hash
+ * that none was found for is not probed for again within that second. */
+#if !defined(OPENSSL_NO_POSIX_IO) && !defined(OPENSSL_SYS_VMS) && \
+	!defined(_WIN32)
+# define BY_DIR_INDEX
+# include "o_dir.h"
+#endif
 
 typedef struct lookup_dir_hashes_st
 	{
@@ -79,11 +94,37 @@ typedef struct lookup_dir_hashes_st
 	int suffix;
 	} BY_DIR_HASH;
 
+#ifdef BY_DIR_INDEX
+typedef struct lookup_dir_files_st
+	{
+	unsigned long hash;
+	int certs;		/* <hash>.0 to <hash>.<certs - 1> exist */
+	int crls;		/* <hash>.r0 to <hash>.r<crls - 1> exist */
+	int certs_loaded;	/* certificate files loaded */
+	} BY_DIR_FILES;
+
+#define BY_DIR_MISSES	256
+
+typedef struct lookup_dir_miss_st
+	{
+	unsigned long hash;
+	int type;
+	time_t time;		/* when no file was found, 0 if unused */
+	} BY_DIR_MISS;
+#endif
+
 typedef struct lookup_dir_entry_st
 	{
 	char *dir;
 	int dir_type;
 	STACK_OF(BY_DIR_HASH) *hashes;
+#ifdef BY_DIR_INDEX
+	BY_DIR_FILES *files;	/* sorted by hash, NULL if not read */
+	int nfiles;
+	time_t mtime;		/* of the directory read, -1 to read again */
+	time_t checked;		/* when the mtime was last compared */
+	BY_DIR_MISS *misses;	/* BY_DIR_MISSES slots, NULL if none yet */
+#endif
 	} BY_DIR_ENTRY;
 
 typedef struct lookup_dir_st
@@ -190,6 +231,12 @@ static void by_dir_entry_free(BY_DIR_ENTRY *ent)
 		OPENSSL_free(ent->dir);
 	if (ent->hashes)
 		sk_BY_DIR_HASH_pop_free(ent->hashes, by_dir_hash_free);
+#ifdef BY_DIR_INDEX
+	if (ent->files)
+		OPENSSL_free(ent->files);
+	if (ent->misses)
+		OPENSSL_free(ent->misses);
+#endif
 	OPENSSL_free(ent);
 	}
 
@@ -250,6 +297,13 @@ static int add_cert_dir(BY_DIR *ctx, const char *dir, int type)
 				return 0;
 			ent->dir_type = type;
 			ent->hashes = sk_BY_DIR_HASH_new(by_dir_hash_cmp);
+#ifdef BY_DIR_INDEX
+			ent->files = NULL;
+			ent->nfiles = 0;
+			ent->mtime = (time_t)-1;
+			ent->checked = 0;
+			ent->misses = NULL;
+#endif
 			ent->dir = OPENSSL_malloc((unsigned int)len+1);
 			if (!ent->dir || !ent->hashes)
 				{
@@ -268,44 +322,250 @@ static int add_cert_dir(BY_DIR *ctx, const char *dir, int type)
 	return 1;
 	}
 
+#ifdef BY_DIR_INDEX
+
+static int by_dir_files_cmp(const void *a, const void *b)
+	{
+	const BY_DIR_FILES *fa = a, *fb = b;
+
+	if (fa->hash > fb->hash)
+		return 1;
+	if (fa->hash < fb->hash)
+		return -1;
+	return 0;
+	}
+
+static BY_DIR_FILES *by_dir_files_find(BY_DIR_ENTRY *ent, unsigned long h)
+	{
+	BY_DIR_FILES key;
+
+	if (ent->files == NULL)
+		return NULL;
+	key.hash = h;
+	return bsearch(&key, ent->files, ent->nfiles, sizeof(key),
+		by_dir_files_cmp);
+	}
+
+/* Parses "<hash>.<n>" or "<hash>.r<n>" as written by get_cert_by_subject() */
+static int by_dir_name_parse(const char *name, unsigned long *h, int *crl,
+	int *n)
+	{
+	int i;
+	long l;
+
+	for (i = 0; i < 8; i++)
+		if (!(name[i] >= '0' && name[i] <= '9') &&
+		    !(name[i] >= 'a' && name[i] <= 'f'))
+			return 0;
+	if (name[8] != '.')
+		return 0;
+	name += 9;
+	if ((*crl = *name == 'r'))
+		name++;
+	for (l = 0, i = 0; name[i] >= '0' && name[i] <= '9'; i++)
+		if ((l = l * 10 + name[i] - '0') > 0xffff)
+			return 0;
+	if (i == 0 || name[i] != '\0')
+		return 0;
+	*h = strtoul(name - 9 - *crl, NULL, 16);
+	*n = (int)l;
+	return 1;
+	}
+
+/* Reads the names of the files in 'ent->dir' into a new index in '*pfiles'.
+ * The numbers of the files of a hash count from 0 up to the first
+ * missing. */
+static int by_dir_index_read(BY_DIR_ENTRY *ent, BY_DIR_FILES **pfiles,
+	int *pn)
+	{
+	OPENSSL_DIR_CTX *d = NULL;
+	const char *name;
+	BY_DIR_FILES *names = NULL, *files = NULL, *tmp;
+	int num = 0, max = 0, n = 0, i, crl, k;
+	unsigned long h;
+
+	/* one entry for each file, with the number in 'certs' or 'crls' */
+	for (;;)
+		{
+		/* only a NULL return tells an error by errno */
+		errno = 0;
+		if ((name = OPENSSL_DIR_read(&d, ent->dir)) == NULL)
+			{
+			if (errno != 0)
+				goto err;
+			break;
+			}
+		if (!by_dir_name_parse(name, &h, &crl, &k))
+			continue;
+		if (num == max)
+			{
+			max = max ? 2 * max : 64;
+			tmp = OPENSSL_realloc(names, max * sizeof(*names));
+			if (tmp == NULL)
+				goto err;
+			names = tmp;
+			}
+		names[num].hash = h;
+		names[num].certs = crl ? -1 : k;
+		names[num].crls = crl ? k : -1;
+		num++;
+		}
+	if (d != NULL)
+		OPENSSL_DIR_end(&d);
+
+	if (num > 0)
+		{
+		qsort(names, num, sizeof(*names), by_dir_files_cmp);
+		if ((files = OPENSSL_malloc(num * sizeof(*files))) == NULL)
+			goto err;
+		}
+	for (i = 0; i < num; i = k)
+		{
+		BY_DIR_FILES *f = &files[n++];
+		int j, found;
+
+		f->hash = names[i].hash;
+		f->certs = f->crls = f->certs_loaded = 0;
+		for (k = i; k < num && names[k].hash == f->hash; k++)
+			;
+		/* count the numbers present from 0 up */
+		do	{
+			found = 0;
+			for (j = i; j < k; j++)
+				{
+				if (names[j].certs == f->certs)
+					f->certs++, found = 1;
+				if (names[j].crls == f->crls)
+					f->crls++, found = 1;
+				}
+			} while (found);
+		}
+	if (names != NULL)
+		OPENSSL_free(names);
+	*pfiles = files;
+	*pn = n;
+	return 1;
+ err:
+	if (d != NULL)
+		OPENSSL_DIR_end(&d);
+	if (names != NULL)
+		OPENSSL_free(names);
+	return 0;
+	}
+
+/* Has the index of 'ent' up to date as of 'now', comparing the modification
+ * time of the directory once a second.  Returns 0 if the directory cannot
+ * be listed, for files to be probed for one by one. */
+static int by_dir_index_check(BY_DIR_ENTRY *ent, time_t now)
+	{
+	BY_DIR_FILES *files = NULL;
+	struct stat st;
+	int n = 0, ok;
+
+	CRYPTO_r_lock(CRYPTO_LOCK_X509_STORE);
+	ok = ent->checked == now ? ent->files != NULL : -1;
+	CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
+	if (ok >= 0)
+		return ok;
+
+	ok = stat(ent->dir, &st) == 0;
+	if (ok)
+		{
+		CRYPTO_r_lock(CRYPTO_LOCK_X509_STORE);
+		ok = ent->files != NULL && ent->mtime == st.st_mtime;
+		CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
+		if (!ok && by_dir_index_read(ent, &files, &n))
+			{
+			/* an empty directory still has an index */
+			if (files == NULL)
+				files = OPENSSL_malloc(sizeof(*files));
+			ok = files != NULL;
+			}
+		}
+
+	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
+	if (files != NULL || !ok)
+		{
+		if (ent->files != NULL)
+			OPENSSL_free(ent->files);
+		ent->files = files;
+		ent->nfiles = n;
+		/* a change within the second read may not show in the mtime */
+		ent->mtime = ok && st.st_mtime < now ? st.st_mtime : (time_t)-1;
+		}
+	ent->checked = now;
+	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	return ok;
+	}
+
+/* Has the index of 'ent' read again by the next lookup */
+static void by_dir_index_stale(BY_DIR_ENTRY *ent)
+	{
+	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
+	ent->mtime = (time_t)-1;
+	ent->checked = 0;
+	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	}
+
+/* Tells whether no file of 'type' for 'h' was found in 'ent' at 'now' */
+static int by_dir_miss_find(BY_DIR_ENTRY *ent, unsigned long h, int type,
+	time_t now)
+	{
+	BY_DIR_MISS *m;
+	int found = 0;
+
+	CRYPTO_r_lock(CRYPTO_LOCK_X509_STORE);
+	if (ent->misses != NULL)
+		{
+		m = &ent->misses[h % BY_DIR_MISSES];
+		found = m->hash == h && m->type == type && m->time == now;
+		}
+	CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
+	return found;
+	}
+
+/* Records that no file of 'type' for 'h' was found in 'ent' at 'now' */
+static void by_dir_miss_add(BY_DIR_ENTRY *ent, unsigned long h, int type,
+	time_t now)
+	{
+	BY_DIR_MISS *m;
+
+	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
+	if (ent->misses == NULL &&
+	    (ent->misses = OPENSSL_malloc(BY_DIR_MISSES * sizeof(*m))) != NULL)
+		memset(ent->misses, 0, BY_DIR_MISSES * sizeof(*m));
+	if (ent->misses != NULL)
+		{
+		m = &ent->misses[h % BY_DIR_MISSES];
+		m->hash = h;
+		m->type = type;
+		m->time = now;
+		}
+	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	}
+
+#endif
+
 static int get_cert_by_subject(X509_LOOKUP *xl, int type, X509_NAME *name,
 	     X509_OBJECT *ret)
 	{
 	BY_DIR *ctx;
-	union	{
-		struct	{
-			X509 st_x509;
-			X509_CINF st_x509_cinf;
-			} x509;
-		struct	{
-			X509_CRL st_crl;
-			X509_CRL_INFO st_crl_info;
-			} crl;
-		} data;
 	int ok=0;
 	int i,j,k;
 	unsigned long h;
 	BUF_MEM *b=NULL;
-	X509_OBJECT stmp,*tmp;
+	X509_OBJECT *tmp;
 	const char *postfix="";
+#ifdef BY_DIR_INDEX
+	time_t now = time(NULL);
+#endif
 
 	if (name == NULL) return(0);
 
-	stmp.type=type;
 	if (type == X509_LU_X509)
-		{
-		data.x509.st_x509.cert_info= &data.x509.st_x509_cinf;
-		data.x509.st_x509_cinf.subject=name;
-		stmp.data.x509= &data.x509.st_x509;
 		postfix="";
-		}
 	else if (type == X509_LU_CRL)
-		{
-		data.crl.st_crl.crl= &data.crl.st_crl_info;
-		data.crl.st_crl_info.issuer=name;
-		stmp.data.crl= &data.crl.st_crl;
 		postfix="r";
-		}
 	else
 		{
 		X509err(X509_F_GET_CERT_BY_SUBJECT,X509_R_WRONG_LOOKUP_TYPE);
@@ -325,6 +585,10 @@ static int get_cert_by_subject(X509_LOOKUP *xl, int type, X509_NAME *name,
 		{
 		BY_DIR_ENTRY *ent;
 		int idx;
+		int last = -1;	/* number of the first missing file if known */
+#ifdef BY_DIR_INDEX
+		int first;	/* number of the first file to look for */
+#endif
 		BY_DIR_HASH htmp, *hent;
 		ent = sk_BY_DIR_ENTRY_value(ctx->dirs, i);
 		j=strlen(ent->dir)+1+8+6+1+1;
@@ -355,6 +619,26 @@ static int get_cert_by_subject(X509_LOOKUP *xl, int type, X509_NAME *name,
 			k = 0;
 			hent = NULL;
 			}
+#ifdef BY_DIR_INDEX
+		first = k;
+		if (by_dir_index_check(ent, now))
+			{
+			BY_DIR_FILES *f;
+
+			CRYPTO_r_lock(CRYPTO_LOCK_X509_STORE);
+			f = by_dir_files_find(ent, h);
+			if (type == X509_LU_CRL)
+				last = f != NULL ? f->crls : 0;
+			else
+				{
+				k = f != NULL ? f->certs_loaded : 0;
+				last = f != NULL ? f->certs : 0;
+				}
+			CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
+			}
+		else if (by_dir_miss_find(ent, h, type, now))
+			last = k;	/* probed for this second */
+#endif
 		for (;;)
 			{
 			char c = '/';
@@ -389,15 +673,22 @@ static int get_cert_by_subject(X509_LOOKUP *xl, int type, X509_NAME *name,
 					"%s%c%08lx.%s%d",ent->dir,c,h,
 					postfix,k);
 				}
+			if (last >= 0)
+				{
+				/* the index lists no more */
+				if (k >= last)
+					break;
+				}
 #ifndef OPENSSL_NO_POSIX_IO
 #ifdef _WIN32
 #define stat _stat
 #endif
-			{
-			struct stat st;
-			if (stat(b->data,&st) < 0)
-				break;
-			}
+			else
+				{
+				struct stat st;
+				if (stat(b->data,&st) < 0)
+					break;
+				}
 #endif
 			/* found one. */
 			if (type == X509_LU_X509)
@@ -416,13 +707,28 @@ static int get_cert_by_subject(X509_LOOKUP *xl, int type, X509_NAME *name,
 			k++;
 			}
 
+#ifdef BY_DIR_INDEX
+		if (last >= 0 && k < last)
+			/* a file listed is gone or bad */
+			by_dir_index_stale(ent);
+		else if (last < 0 && k == first)
+			by_dir_miss_add(ent, h, type, now);
+		/* what they hold is in the store now */
+		if (type == X509_LU_X509 && last >= 0)
+			{
+			BY_DIR_FILES *f;
+
+			CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
+			f = by_dir_files_find(ent, h);
+			if (f != NULL && f->certs_loaded < k)
+				f->certs_loaded = k;
+			CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+			}
+#endif
+
 		/* we have added it to the cache so now pull
 		 * it out again */
-		CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
-		j = sk_X509_OBJECT_find(xl->store_ctx->objs,&stmp);
-		if(j != -1) tmp=sk_X509_OBJECT_value(xl->store_ctx->objs,j);
-		else tmp = NULL;
-		CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+		tmp = x509_store_get0_object(xl->store_ctx, type, name);
 
 
 		/* If a CRL, update the last file suffix added for this */
@@ -306,6 +306,8 @@ struct x509_st
 	unsigned char sha1_hash[SHA_DIGEST_LENGTH];
 #endif
 	X509_CERT_AUX *aux;
+	/* State of the extension values above, see v3_purp.c */
+	int ex_cached;
 	} /* X509 */;
 
 DECLARE_STACK_OF(X509)
@@ -1276,6 +1278,7 @@ void ERR_load_X509_strings(void);
 #define X509_F_X509_STORE_CTX_INIT			 143
 #define X509_F_X509_STORE_CTX_NEW			 142
 #define X509_F_X509_STORE_CTX_PURPOSE_INHERIT		 134
+#define X509_F_X509_STORE_SET_CHAIN_CACHE		 148
 #define X509_F_X509_TO_X509_REQ				 126
 #define X509_F_X509_TRUST_ADD				 133
 #define X509_F_X509_TRUST_SET				 141
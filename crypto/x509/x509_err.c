@@ -112,6 +112,7 @@ static ERR_STRING_DATA X509_str_functs[]=
 {ERR_FUNC(X509_F_X509_STORE_CTX_INIT),	"X509_STORE_CTX_init"},
 {ERR_FUNC(X509_F_X509_STORE_CTX_NEW),	"X509_STORE_CTX_new"},
 {ERR_FUNC(X509_F_X509_STORE_CTX_PURPOSE_INHERIT),	"X509_STORE_CTX_purpose_inherit"},
+{ERR_FUNC(X509_F_X509_STORE_SET_CHAIN_CACHE),	"X509_STORE_set_chain_cache"},
 {ERR_FUNC(X509_F_X509_TO_X509_REQ),	"X509_to_X509_REQ"},
 {ERR_FUNC(X509_F_X509_TRUST_ADD),	"X509_TRUST_add"},
 {ERR_FUNC(X509_F_X509_TRUST_SET),	"X509_TRUST_set"},
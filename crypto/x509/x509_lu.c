@@ -62,6 +62,85 @@
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 
+#include "x509_lcl.h"
+
+/* Lookups in the store go through a hash index of its objects by subject
+ * name (issuer name for CRLs), as searching 'objs' needs it sorted again
+ * after every addition.  Objects of the same type and name form a group,
+ * in the order they were added.  Additions are made with the store locked
+ * for writing and never change anything a lookup could be reading: entries
+ * are complete before they are linked in and a table that is full is
+ * replaced by a larger one.  With atomic operations a lookup takes no lock
+ * and pins the table by counting itself in 'readers'; replaced tables are
+ * freed by an addition finding no reader left.  Without them a lookup
+ * holds CRYPTO_LOCK_X509_STORE for reading. */
+#ifdef X509_STORE_LOCKLESS
+/* for pointers changed while lookups may read them */
+# define x509_store_load(p)	(*(__typeof__(p) volatile *)&(p))
+# define x509_store_publish()	__sync_synchronize()
+#else
+# define x509_store_load(p)	(p)
+# define x509_store_publish()
+#endif
+
+#define X509_STORE_INDEX_MIN	16
+
+/* Signatures verified are remembered with the entries of the objects they
+ * sign, as the SHA-256 digests of the keys that verified them, so that an
+ * object shared by verifications is verified once for an issuer key.
+ * Memos are only ever added, complete before they are linked in, and are
+ * only kept where lookups take no lock. */
+#if defined(X509_STORE_LOCKLESS) && !defined(OPENSSL_NO_SHA256)
+# define X509_STORE_SIG_MEMO
+#endif
+
+/* issuer keys remembered for an object at most */
+#define X509_STORE_SIG_MEMO_MAX	4
+
+typedef struct x509_store_memo_st
+	{
+#ifdef X509_STORE_SIG_MEMO
+	unsigned char key[SHA256_DIGEST_LENGTH];
+#endif
+	struct x509_store_memo_st *next;
+	} X509_STORE_MEMO;
+
+typedef struct x509_store_entry_st
+	{
+	X509_OBJECT *obj;
+	X509_STORE_MEMO *memo;
+	struct x509_store_entry_st *next;
+	} X509_STORE_ENTRY;
+
+typedef struct x509_store_group_st
+	{
+	int type;
+	X509_NAME *name;	/* of the first object */
+	unsigned long hash;
+	X509_STORE_ENTRY *first;
+	X509_STORE_ENTRY *last;
+	} X509_STORE_GROUP;
+
+/* Groups are chained in their bucket through nodes of the table, so that
+ * a larger table can chain them again while lookups still use the old */
+typedef struct x509_store_node_st
+	{
+	X509_STORE_GROUP *group;
+	struct x509_store_node_st *next;
+	} X509_STORE_NODE;
+
+struct x509_store_index_st
+	{
+	unsigned long mask;	/* number of buckets - 1 */
+	unsigned long num;	/* groups, at most one per bucket */
+	X509_STORE_NODE **buckets;
+	X509_STORE_NODE *nodes;
+	struct x509_store_index_st *next;	/* in the retired list */
+	};
+typedef struct x509_store_index_st X509_STORE_INDEX;
+
+static X509_STORE_INDEX *x509_store_index_new(unsigned long nbuckets);
+
 X509_LOOKUP *X509_LOOKUP_new(X509_LOOKUP_METHOD *method)
 	{
 	X509_LOOKUP *ret;
@@ -181,6 +260,11 @@ X509_STORE *X509_STORE_new(void)
 
 	if ((ret=(X509_STORE *)OPENSSL_malloc(sizeof(X509_STORE))) == NULL)
 		return NULL;
+	if ((ret->index = x509_store_index_new(X509_STORE_INDEX_MIN)) == NULL)
+		{
+		OPENSSL_free(ret);
+		return NULL;
+		}
 	ret->objs = sk_X509_OBJECT_new(x509_object_cmp);
 	ret->cache=1;
 	ret->get_cert_methods=sk_X509_LOOKUP_new_null();
@@ -203,14 +287,347 @@ X509_STORE *X509_STORE_new(void)
 	if (!CRYPTO_new_ex_data(CRYPTO_EX_INDEX_X509_STORE, ret, &ret->ex_data))
 		{
 		sk_X509_OBJECT_free(ret->objs);
+		OPENSSL_free(ret->index);
 		OPENSSL_free(ret);
 		return NULL;
 		}
 
+	ret->retired = NULL;
+	ret->readers = 0;
+	ret->chain_cache = NULL;
+	ret->generation = 0;
 	ret->references=1;
 	return ret;
 	}
 
+static X509_NAME *x509_object_name(X509_OBJECT *a)
+	{
+	switch (a->type)
+		{
+	case X509_LU_X509:
+		return X509_get_subject_name(a->data.x509);
+	case X509_LU_CRL:
+		return X509_CRL_get_issuer(a->data.crl);
+		}
+	return NULL;
+	}
+
+/* FNV-1a of the canonical encoding compared by X509_NAME_cmp() */
+static unsigned long x509_store_hash(int type, X509_NAME *name)
+	{
+	unsigned long h = 2166136261UL ^ (unsigned long)type;
+	int i;
+
+	if ((!name->canon_enc || name->modified) &&
+	    i2d_X509_NAME(name, NULL) < 0)
+		return 0;
+	for (i = 0; i < name->canon_enclen; i++)
+		h = ((h ^ name->canon_enc[i]) * 16777619UL) & 0xffffffffUL;
+	return h;
+	}
+
+static X509_STORE_INDEX *x509_store_index_new(unsigned long nbuckets)
+	{
+	X509_STORE_INDEX *idx;
+
+	idx = OPENSSL_malloc(sizeof *idx + nbuckets *
+		(sizeof(X509_STORE_NODE *) + sizeof(X509_STORE_NODE)));
+	if (idx == NULL)
+		return NULL;
+	idx->mask = nbuckets - 1;
+	idx->num = 0;
+	idx->buckets = (X509_STORE_NODE **)(idx + 1);
+	idx->nodes = (X509_STORE_NODE *)(idx->buckets + nbuckets);
+	idx->next = NULL;
+	memset(idx->buckets, 0, nbuckets * sizeof *idx->buckets);
+	return idx;
+	}
+
+static X509_STORE_GROUP *x509_store_index_find(X509_STORE_INDEX *idx,
+	int type, X509_NAME *name, unsigned long h)
+	{
+	X509_STORE_NODE *n;
+	X509_STORE_GROUP *g;
+
+	for (n = x509_store_load(idx->buckets[h & idx->mask]); n != NULL;
+	     n = n->next)
+		{
+		g = n->group;
+		if (g->hash == h && g->type == type && !X509_NAME_cmp(g->name, name))
+			return g;
+		}
+	return NULL;
+	}
+
+/* Adds a group to a table that is not full */
+static void x509_store_index_link(X509_STORE_INDEX *idx, X509_STORE_GROUP *g)
+	{
+	X509_STORE_NODE *n = &idx->nodes[idx->num++];
+	X509_STORE_NODE **b = &idx->buckets[g->hash & idx->mask];
+
+	n->group = g;
+	n->next = *b;
+	x509_store_publish();
+	*b = n;
+	}
+
+/* Replaces the full table of 'store' by one twice as large, retiring the
+ * old one: called with the store locked for writing */
+static int x509_store_index_grow(X509_STORE *store)
+	{
+	X509_STORE_INDEX *old = store->index, *idx;
+	unsigned long i;
+
+	if ((idx = x509_store_index_new(2 * (old->mask + 1))) == NULL)
+		return 0;
+	for (i = 0; i < old->num; i++)
+		x509_store_index_link(idx, old->nodes[i].group);
+	x509_store_publish();
+	store->index = idx;
+	old->next = store->retired;
+	store->retired = old;
+	return 1;
+	}
+
+/* Frees the retired tables if no lookup can still use them: called with
+ * the store locked for writing */
+static void x509_store_reclaim(X509_STORE *store)
+	{
+	X509_STORE_INDEX *idx, *next;
+
+	if (store->retired == NULL)
+		return;
+#ifdef X509_STORE_LOCKLESS
+	/* a lookup counted after this finds the current table */
+	__sync_synchronize();
+	if (x509_store_load(store->readers) != 0)
+		return;
+#endif
+	for (idx = store->retired; idx != NULL; idx = next)
+		{
+		next = idx->next;
+		OPENSSL_free(idx);
+		}
+	store->retired = NULL;
+	}
+
+/* Returns the table of 'store' for lookups until x509_store_unpin() */
+static X509_STORE_INDEX *x509_store_pin(X509_STORE *store)
+	{
+#ifdef X509_STORE_LOCKLESS
+	__sync_fetch_and_add(&store->readers, 1);
+	return x509_store_load(store->index);
+#else
+	CRYPTO_r_lock(CRYPTO_LOCK_X509_STORE);
+	return store->index;
+#endif
+	}
+
+static void x509_store_unpin(X509_STORE *store)
+	{
+#ifdef X509_STORE_LOCKLESS
+	__sync_fetch_and_sub(&store->readers, 1);
+#else
+	CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
+#endif
+	}
+
+/* Returns the first object of 'type' named 'name' in 'store' or NULL.  The
+ * object stays in the store until it is freed. */
+X509_OBJECT *x509_store_get0_object(X509_STORE *store, int type,
+	X509_NAME *name)
+	{
+	X509_STORE_GROUP *g;
+	X509_OBJECT *ret;
+
+	g = x509_store_index_find(x509_store_pin(store), type, name,
+		x509_store_hash(type, name));
+	ret = g != NULL ? g->first->obj : NULL;
+	x509_store_unpin(store);
+	return ret;
+	}
+
+static int x509_object_match(X509_OBJECT *a, X509_OBJECT *b)
+	{
+	switch (a->type)
+		{
+	case X509_LU_X509:
+		return !X509_cmp(a->data.x509, b->data.x509);
+	case X509_LU_CRL:
+		return !X509_CRL_match(a->data.crl, b->data.crl);
+		}
+	return 1;
+	}
+
+/* Adds 'obj' to 'objs' and the index: called with the store locked for
+ * writing.  Returns 1 if added, 0 if a matching object is there already
+ * and -1 if out of memory. */
+static int x509_store_add_object(X509_STORE *store, X509_OBJECT *obj)
+	{
+	X509_NAME *name = x509_object_name(obj);
+	unsigned long h = x509_store_hash(obj->type, name);
+	X509_STORE_GROUP *g;
+	X509_STORE_ENTRY *e;
+	int new_group = 0;
+
+	g = x509_store_index_find(store->index, obj->type, name, h);
+	if (g != NULL)
+		for (e = g->first; e != NULL; e = e->next)
+			if (x509_object_match(e->obj, obj))
+				return 0;
+
+	if ((e = OPENSSL_malloc(sizeof *e)) == NULL)
+		return -1;
+	e->obj = obj;
+	e->memo = NULL;
+	e->next = NULL;
+	if (g == NULL)
+		{
+		if (store->index->num > store->index->mask &&
+		    !x509_store_index_grow(store))
+			goto err;
+		if ((g = OPENSSL_malloc(sizeof *g)) == NULL)
+			goto err;
+		g->type = obj->type;
+		g->name = name;
+		g->hash = h;
+		g->first = g->last = e;
+		new_group = 1;
+		}
+	if (!sk_X509_OBJECT_push(store->objs, obj))
+		{
+		if (new_group)
+			OPENSSL_free(g);
+		goto err;
+		}
+
+	if (new_group)
+		x509_store_index_link(store->index, g);
+	else
+		{
+		x509_store_publish();
+		g->last->next = e;
+		g->last = e;
+		}
+	x509_store_reclaim(store);
+	store->generation++;
+	return 1;
+err:
+	OPENSSL_free(e);
+	return -1;
+	}
+
+#ifdef X509_STORE_SIG_MEMO
+/* Returns the entry of 'obj' itself in 'idx' or NULL */
+static X509_STORE_ENTRY *x509_store_entry_find(X509_STORE_INDEX *idx,
+	X509_OBJECT *obj)
+	{
+	X509_NAME *name = x509_object_name(obj);
+	X509_STORE_GROUP *g;
+	X509_STORE_ENTRY *e;
+
+	g = x509_store_index_find(idx, obj->type, name,
+		x509_store_hash(obj->type, name));
+	if (g == NULL)
+		return NULL;
+	for (e = g->first; e != NULL; e = x509_store_load(e->next))
+		if (e->obj->data.ptr == obj->data.ptr)
+			return e;
+	return NULL;
+	}
+#endif
+
+/* Whether the signature of 'obj' was verified with the key whose SHA-256
+ * digest is 'key', as remembered by x509_store_sig_memo_add().  Objects
+ * not in 'store' are never remembered. */
+int x509_store_sig_memo_find(X509_STORE *store, X509_OBJECT *obj,
+	const unsigned char *key)
+	{
+#ifdef X509_STORE_SIG_MEMO
+	X509_STORE_ENTRY *e;
+	X509_STORE_MEMO *m;
+	int found = 0;
+
+	e = x509_store_entry_find(x509_store_pin(store), obj);
+	if (e != NULL)
+		for (m = x509_store_load(e->memo); m != NULL;
+		     m = x509_store_load(m->next))
+			if (memcmp(m->key, key, SHA256_DIGEST_LENGTH) == 0)
+				{
+				found = 1;
+				break;
+				}
+	x509_store_unpin(store);
+	return found;
+#else
+	return 0;
+#endif
+	}
+
+void x509_store_sig_memo_add(X509_STORE *store, X509_OBJECT *obj,
+	const unsigned char *key)
+	{
+#ifdef X509_STORE_SIG_MEMO
+	X509_STORE_ENTRY *e;
+	X509_STORE_MEMO *m, *p = NULL;
+	int n = 0;
+
+	if ((m = OPENSSL_malloc(sizeof *m)) == NULL)
+		return;
+	memcpy(m->key, key, SHA256_DIGEST_LENGTH);
+
+	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
+	if ((e = x509_store_entry_find(store->index, obj)) != NULL)
+		{
+		for (p = e->memo; p != NULL; p = p->next, n++)
+			if (memcmp(p->key, key, SHA256_DIGEST_LENGTH) == 0)
+				break;
+		if (p == NULL && n < X509_STORE_SIG_MEMO_MAX)
+			{
+			m->next = e->memo;
+			x509_store_publish();
+			e->memo = m;
+			m = NULL;
+			}
+		}
+	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	if (m != NULL)
+		OPENSSL_free(m);
+#endif
+	}
+
+static void x509_store_index_free(X509_STORE *store)
+	{
+	X509_STORE_INDEX *idx = store->index;
+	X509_STORE_ENTRY *e, *next;
+	unsigned long i;
+
+	for (i = 0; i < idx->num; i++)
+		{
+		for (e = idx->nodes[i].group->first; e != NULL; e = next)
+			{
+			X509_STORE_MEMO *m, *mnext;
+
+			for (m = e->memo; m != NULL; m = mnext)
+				{
+				mnext = m->next;
+				OPENSSL_free(m);
+				}
+			next = e->next;
+			OPENSSL_free(e);
+			}
+		OPENSSL_free(idx->nodes[i].group);
+		}
+	OPENSSL_free(idx);
+	store->index = store->retired;
+	store->retired = NULL;
+	for (idx = store->index; idx != NULL; idx = store->index)
+		{
+		store->index = idx->next;
+		OPENSSL_free(idx);
+		}
+	}
+
 static void cleanup(X509_OBJECT *a)
 	{
 	if (a->type == X509_LU_X509)
@@ -259,6 +676,9 @@ void X509_STORE_free(X509_STORE *vfy)
 		X509_LOOKUP_free(lu);
 		}
 	sk_X509_LOOKUP_free(sk);
+	if (vfy->chain_cache)
+		x509_chain_cache_free(vfy->chain_cache);
+	x509_store_index_free(vfy);
 	sk_X509_OBJECT_pop_free(vfy->objs, cleanup);
 
 	CRYPTO_free_ex_data(CRYPTO_EX_INDEX_X509_STORE, vfy, &vfy->ex_data);
@@ -307,9 +727,7 @@ int X509_STORE_get_by_subject(X509_STORE_CTX *vs, int type, X509_NAME *name,
 	X509_OBJECT stmp,*tmp;
 	int i,j;
 
-	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
-	tmp=X509_OBJECT_retrieve_by_subject(ctx->objs,type,name);
-	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	tmp=x509_store_get0_object(ctx,type,name);
 
 	if (tmp == NULL || type == X509_LU_CRL)
 		{
@@ -363,14 +781,17 @@ int X509_STORE_add_cert(X509_STORE *ctx, X509 *x)
 
 	X509_OBJECT_up_ref_count(obj);
 
-	if (X509_OBJECT_retrieve_match(ctx->objs, obj))
+	ret=x509_store_add_object(ctx, obj);
+	if (ret <= 0)
 		{
 		X509_OBJECT_free_contents(obj);
 		OPENSSL_free(obj);
-		X509err(X509_F_X509_STORE_ADD_CERT,X509_R_CERT_ALREADY_IN_HASH_TABLE);
+		if (ret == 0)
+			X509err(X509_F_X509_STORE_ADD_CERT,X509_R_CERT_ALREADY_IN_HASH_TABLE);
+		else
+			X509err(X509_F_X509_STORE_ADD_CERT,ERR_R_MALLOC_FAILURE);
 		ret=0;
-		} 
-	else sk_X509_OBJECT_push(ctx->objs, obj);
+		}
 
 	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
 
@@ -396,14 +817,17 @@ int X509_STORE_add_crl(X509_STORE *ctx, X509_CRL *x)
 
 	X509_OBJECT_up_ref_count(obj);
 
-	if (X509_OBJECT_retrieve_match(ctx->objs, obj))
+	ret=x509_store_add_object(ctx, obj);
+	if (ret <= 0)
 		{
 		X509_OBJECT_free_contents(obj);
 		OPENSSL_free(obj);
-		X509err(X509_F_X509_STORE_ADD_CRL,X509_R_CERT_ALREADY_IN_HASH_TABLE);
+		if (ret == 0)
+			X509err(X509_F_X509_STORE_ADD_CRL,X509_R_CERT_ALREADY_IN_HASH_TABLE);
+		else
+			X509err(X509_F_X509_STORE_ADD_CRL,ERR_R_MALLOC_FAILURE);
 		ret=0;
 		}
-	else sk_X509_OBJECT_push(ctx->objs, obj);
 
 	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
 
@@ -500,96 +924,92 @@ X509_OBJECT *X509_OBJECT_retrieve_by_subject(STACK_OF(X509_OBJECT) *h, int type,
 
 STACK_OF(X509)* X509_STORE_get1_certs(X509_STORE_CTX *ctx, X509_NAME *nm)
 	{
-	int i, idx, cnt;
+	unsigned long h;
 	STACK_OF(X509) *sk;
 	X509 *x;
-	X509_OBJECT *obj;
+	X509_STORE_GROUP *g;
+	X509_STORE_ENTRY *e;
 	sk = sk_X509_new_null();
-	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
-	idx = x509_object_idx_cnt(ctx->ctx->objs, X509_LU_X509, nm, &cnt);
-	if (idx < 0)
+	h = x509_store_hash(X509_LU_X509, nm);
+	g = x509_store_index_find(x509_store_pin(ctx->ctx), X509_LU_X509, nm, h);
+	if (g == NULL)
 		{
 		/* Nothing found in cache: do lookup to possibly add new
 		 * objects to cache
 		 */
 		X509_OBJECT xobj;
-		CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+		x509_store_unpin(ctx->ctx);
 		if (!X509_STORE_get_by_subject(ctx, X509_LU_X509, nm, &xobj))
 			{
 			sk_X509_free(sk);
 			return NULL;
 			}
 		X509_OBJECT_free_contents(&xobj);
-		CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
-		idx = x509_object_idx_cnt(ctx->ctx->objs,X509_LU_X509,nm, &cnt);
-		if (idx < 0)
+		g = x509_store_index_find(x509_store_pin(ctx->ctx),
+			X509_LU_X509, nm, h);
+		if (g == NULL)
 			{
-			CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+			x509_store_unpin(ctx->ctx);
 			sk_X509_free(sk);
 			return NULL;
 			}
 		}
-	for (i = 0; i < cnt; i++, idx++)
+	for (e = g->first; e != NULL; e = x509_store_load(e->next))
 		{
-		obj = sk_X509_OBJECT_value(ctx->ctx->objs, idx);
-		x = obj->data.x509;
+		x = e->obj->data.x509;
 		CRYPTO_add(&x->references, 1, CRYPTO_LOCK_X509);
 		if (!sk_X509_push(sk, x))
 			{
-			CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+			x509_store_unpin(ctx->ctx);
 			X509_free(x);
 			sk_X509_pop_free(sk, X509_free);
 			return NULL;
 			}
 		}
-	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	x509_store_unpin(ctx->ctx);
 	return sk;
 
 	}
 
 STACK_OF(X509_CRL)* X509_STORE_get1_crls(X509_STORE_CTX *ctx, X509_NAME *nm)
 	{
-	int i, idx, cnt;
 	STACK_OF(X509_CRL) *sk;
 	X509_CRL *x;
-	X509_OBJECT *obj, xobj;
+	X509_OBJECT xobj;
+	X509_STORE_GROUP *g;
+	X509_STORE_ENTRY *e;
 	sk = sk_X509_CRL_new_null();
-	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
-	/* Check cache first */
-	idx = x509_object_idx_cnt(ctx->ctx->objs, X509_LU_CRL, nm, &cnt);
 
 	/* Always do lookup to possibly add new CRLs to cache
 	 */
-	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
 	if (!X509_STORE_get_by_subject(ctx, X509_LU_CRL, nm, &xobj))
 		{
 		sk_X509_CRL_free(sk);
 		return NULL;
 		}
 	X509_OBJECT_free_contents(&xobj);
-	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
-	idx = x509_object_idx_cnt(ctx->ctx->objs,X509_LU_CRL, nm, &cnt);
-	if (idx < 0)
+	g = x509_store_index_find(x509_store_pin(ctx->ctx), X509_LU_CRL, nm,
+		x509_store_hash(X509_LU_CRL, nm));
+	if (g == NULL)
 		{
-		CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+		x509_store_unpin(ctx->ctx);
 		sk_X509_CRL_free(sk);
 		return NULL;
 		}
 
-	for (i = 0; i < cnt; i++, idx++)
+	for (e = g->first; e != NULL; e = x509_store_load(e->next))
 		{
-		obj = sk_X509_OBJECT_value(ctx->ctx->objs, idx);
-		x = obj->data.crl;
+		x = e->obj->data.crl;
 		CRYPTO_add(&x->references, 1, CRYPTO_LOCK_X509_CRL);
 		if (!sk_X509_CRL_push(sk, x))
 			{
-			CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+			x509_store_unpin(ctx->ctx);
 			X509_CRL_free(x);
 			sk_X509_CRL_pop_free(sk, X509_CRL_free);
 			return NULL;
 			}
 		}
-	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	x509_store_unpin(ctx->ctx);
 	return sk;
 	}
 
@@ -637,8 +1057,10 @@ X509_OBJECT *X509_OBJECT_retrieve_match(STACK_OF(X509_OBJECT) *h, X509_OBJECT *x
 int X509_STORE_CTX_get1_issuer(X509 **issuer, X509_STORE_CTX *ctx, X509 *x)
 	{
 	X509_NAME *xn;
-	X509_OBJECT obj, *pobj;
-	int i, ok, idx, ret;
+	X509_OBJECT obj;
+	X509_STORE_GROUP *g;
+	X509_STORE_ENTRY *e;
+	int ok, ret;
 	xn=X509_get_issuer_name(x);
 	ok=X509_STORE_get_by_subject(ctx,X509_LU_X509,xn,&obj);
 	if (ok != X509_LU_X509)
@@ -665,31 +1087,25 @@ int X509_STORE_CTX_get1_issuer(X509 **issuer, X509_STORE_CTX *ctx, X509 *x)
 		}
 	X509_OBJECT_free_contents(&obj);
 
-	/* Else find index of first cert accepted by 'check_issued' */
+	/* Else find first cert accepted by 'check_issued' */
 	ret = 0;
-	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
-	idx = X509_OBJECT_idx_by_subject(ctx->ctx->objs, X509_LU_X509, xn);
-	if (idx != -1) /* should be true as we've had at least one match */
+	g = x509_store_index_find(x509_store_pin(ctx->ctx), X509_LU_X509, xn,
+		x509_store_hash(X509_LU_X509, xn));
+	if (g != NULL) /* should be true as we've had at least one match */
 		{
 		/* Look through all matching certs for suitable issuer */
-		for (i = idx; i < sk_X509_OBJECT_num(ctx->ctx->objs); i++)
+		for (e = g->first; e != NULL; e = x509_store_load(e->next))
 			{
-			pobj = sk_X509_OBJECT_value(ctx->ctx->objs, i);
-			/* See if we've run past the matches */
-			if (pobj->type != X509_LU_X509)
-				break;
-			if (X509_NAME_cmp(xn, X509_get_subject_name(pobj->data.x509)))
-				break;
-			if (ctx->check_issued(ctx, x, pobj->data.x509))
+			if (ctx->check_issued(ctx, x, e->obj->data.x509))
 				{
-				*issuer = pobj->data.x509;
-				X509_OBJECT_up_ref_count(pobj);
+				*issuer = e->obj->data.x509;
+				X509_OBJECT_up_ref_count(e->obj);
 				ret = 1;
 				break;
 				}
 			}
 		}
-	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	x509_store_unpin(ctx->ctx);
 	return ret;
 	}
 
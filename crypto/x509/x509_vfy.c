@@ -69,7 +69,9 @@
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 #include <openssl/objects.h>
+#include <openssl/sha.h>
 #include "vpm_int.h"
+#include "x509_lcl.h"
 
 /* CRL score values */
 
@@ -137,6 +139,20 @@ static int check_crl_chain(X509_STORE_CTX *ctx,
 			STACK_OF(X509) *crl_path);
 
 static int internal_verify(X509_STORE_CTX *ctx);
+
+static int sig_memo_find(X509_STORE_CTX *ctx, X509_OBJECT *obj,
+			X509 *issuer, unsigned char *key);
+
+#define X509_CHAIN_CACHE_KEY_LENGTH	SHA256_DIGEST_LENGTH
+
+typedef struct x509_chain_cache_st X509_CHAIN_CACHE;
+
+static int chain_cache_key(X509_STORE_CTX *ctx, unsigned char *key);
+static int chain_cache_get(X509_STORE_CTX *ctx, const unsigned char *key,
+			unsigned long *pgeneration);
+static void chain_cache_put(X509_STORE_CTX *ctx, const unsigned char *key,
+			unsigned long generation);
+
 const char X509_version[]="X.509" OPENSSL_VERSION_PTEXT;
 
 
@@ -196,6 +212,9 @@ int X509_verify_cert(X509_STORE_CTX *ctx)
 	int num;
 	int (*cb)(int xok,X509_STORE_CTX *xctx);
 	STACK_OF(X509) *sktmp=NULL;
+	unsigned char cache_key[X509_CHAIN_CACHE_KEY_LENGTH];
+	unsigned long generation = 0;
+	int use_cache;
 	if (ctx->cert == NULL)
 		{
 		X509err(X509_F_X509_VERIFY_CERT,X509_R_NO_CERT_SET_FOR_US_TO_VERIFY);
@@ -204,6 +223,16 @@ int X509_verify_cert(X509_STORE_CTX *ctx)
 
 	cb=ctx->verify_cb;
 
+	/* A chain verified before needs no building nor checking */
+	use_cache = chain_cache_key(ctx, cache_key);
+	if (use_cache)
+		{
+		ok = chain_cache_get(ctx, cache_key, &generation);
+		if (ok >= 0)
+			return ok;
+		ok = 0;
+		}
+
 	/* first we make sure the chain we are going to build is
 	 * present and that the first entry is in place */
 	if (ctx->chain == NULL)
@@ -457,6 +486,10 @@ int X509_verify_cert(X509_STORE_CTX *ctx)
 end:
 		X509_get_pubkey_parameters(NULL,ctx->chain);
 		}
+	/* Only chains verified without any error overridden by the callback
+	 * are cached */
+	if (ok > 0 && use_cache && ctx->error == X509_V_OK)
+		chain_cache_put(ctx, cache_key, generation);
 	if (sktmp != NULL) sk_X509_free(sktmp);
 	if (chain_ss != NULL) X509_free(chain_ss);
 	return ok;
@@ -1498,7 +1531,9 @@ static int check_crl(X509_STORE_CTX *ctx, X509_CRL *crl)
 	{
 	X509 *issuer = NULL;
 	EVP_PKEY *ikey = NULL;
-	int ok = 0, chnum, cnum;
+	X509_OBJECT obj;
+	unsigned char memo_key[SHA256_DIGEST_LENGTH];
+	int ok = 0, chnum, cnum, memo = -1;
 	cnum = ctx->error_depth;
 	chnum = sk_X509_num(ctx->chain) - 1;
 	/* if we have an alternative CRL issuer cert use that */
@@ -1593,12 +1628,18 @@ static int check_crl(X509_STORE_CTX *ctx, X509_CRL *crl)
 					goto err;
 				}
 			/* Verify CRL signature */
-			if(X509_CRL_verify(crl, ikey) <= 0)
+			obj.type = X509_LU_CRL;
+			obj.data.crl = crl;
+			if ((memo = sig_memo_find(ctx, &obj, issuer, memo_key)) > 0)
+				;
+			else if(X509_CRL_verify(crl, ikey) <= 0)
 				{
 				ctx->error=X509_V_ERR_CRL_SIGNATURE_FAILURE;
 				ok = ctx->verify_cb(0, ctx);
 				if (!ok) goto err;
 				}
+			else if (memo == 0)
+				x509_store_sig_memo_add(ctx->ctx, &obj, memo_key);
 			}
 		}
 
@@ -1742,9 +1783,11 @@ static int check_cert_time(X509_STORE_CTX *ctx, X509 *x)
 
 static int internal_verify(X509_STORE_CTX *ctx)
 	{
-	int ok=0,n;
+	int ok=0,n,memo=-1;
 	X509 *xs,*xi;
 	EVP_PKEY *pkey=NULL;
+	X509_OBJECT obj;
+	unsigned char memo_key[SHA256_DIGEST_LENGTH];
 	int (*cb)(int xok,X509_STORE_CTX *xctx);
 
 	cb=ctx->verify_cb;
@@ -1787,7 +1830,10 @@ static int internal_verify(X509_STORE_CTX *ctx)
 		 * explicitly asked for. It doesn't add any security and
 		 * just wastes time.
 		 */
-		if (!xs->valid && (xs != xi || (ctx->param->flags & X509_V_FLAG_CHECK_SS_SIGNATURE)))
+		obj.type = X509_LU_X509;
+		obj.data.x509 = xs;
+		if ((xs != xi || (ctx->param->flags & X509_V_FLAG_CHECK_SS_SIGNATURE))
+			&& (memo = sig_memo_find(ctx, &obj, xi, memo_key)) <= 0)
 			{
 			if ((pkey=X509_get_pubkey(xi)) == NULL)
 				{
@@ -1807,6 +1853,8 @@ static int internal_verify(X509_STORE_CTX *ctx)
 					goto end;
 					}
 				}
+			else if (memo == 0)
+				x509_store_sig_memo_add(ctx->ctx, &obj, memo_key);
 			EVP_PKEY_free(pkey);
 			pkey=NULL;
 			}
@@ -1836,6 +1884,29 @@ end:
 	return ok;
 	}
 
+/* Whether the signature of 'obj' was verified with the key of 'issuer'
+ * before, as remembered by the store: returns 1 if so and 0 if not, with
+ * 'key' set for x509_store_sig_memo_add(), or -1 if it cannot be
+ * remembered, for an object whose signed encoding was modified. */
+static int sig_memo_find(X509_STORE_CTX *ctx, X509_OBJECT *obj,
+	X509 *issuer, unsigned char *key)
+	{
+#if defined(X509_STORE_LOCKLESS) && !defined(OPENSSL_NO_SHA256)
+	ASN1_ENCODING *enc;
+
+	if (obj->type == X509_LU_X509)
+		enc = &obj->data.x509->cert_info->enc;
+	else
+		enc = &obj->data.crl->crl->enc;
+	if (ctx->ctx == NULL || enc->modified
+		|| !X509_pubkey_digest(issuer, EVP_sha256(), key, NULL))
+		return -1;
+	return x509_store_sig_memo_find(ctx->ctx, obj, key);
+#else
+	return -1;
+#endif
+	}
+
 int X509_cmp_current_time(const ASN1_TIME *ctm)
 {
 	return X509_cmp_time(ctm, NULL);
@@ -2490,6 +2561,327 @@ void X509_STORE_CTX_set0_param(X509_STORE_CTX *ctx, X509_VERIFY_PARAM *param)
 	ctx->param = param;
 	}
 
+/* Cache of verified chains.  An entry is found by a digest of everything
+ * verification depends on besides the store: the certificate, the
+ * untrusted certificates and the parameters.  It is used if nothing was
+ * added to the store since it was verified, it has not expired, the
+ * certificate and the untrusted certificates in it compare equal to those
+ * passed and all are still valid at the time of the check.  Entries are
+ * replaced oldest first.  Verifications checking CRLs or policies are not
+ * cached: those checks would have to be done again anyway. */
+
+typedef struct x509_chain_cache_entry_st
+	{
+	unsigned char key[X509_CHAIN_CACHE_KEY_LENGTH];
+	unsigned long generation;	/* of the store when verified */
+	time_t expires;
+	STACK_OF(X509) *chain;
+	int last_untrusted;
+	struct x509_chain_cache_entry_st *next;	/* in its bucket */
+	} X509_CHAIN_CACHE_ENTRY;
+
+struct x509_chain_cache_st
+	{
+	int max;
+	long timeout;
+	unsigned long mask;		/* number of buckets - 1 */
+	X509_CHAIN_CACHE_ENTRY **buckets;
+	X509_CHAIN_CACHE_ENTRY **entries;	/* 'max' of them, by age */
+	int oldest;
+	};
+
+int X509_STORE_set_chain_cache(X509_STORE *store, int max, long timeout)
+	{
+	X509_CHAIN_CACHE *cache = NULL, *old;
+	unsigned long n;
+
+	if (max > 0)
+		{
+		for (n = 16; n < (unsigned long)max; n <<= 1)
+			;
+		cache = OPENSSL_malloc(sizeof(*cache)
+			+ n * sizeof(*cache->buckets)
+			+ max * sizeof(*cache->entries));
+		if (cache == NULL)
+			{
+			X509err(X509_F_X509_STORE_SET_CHAIN_CACHE,
+				ERR_R_MALLOC_FAILURE);
+			return 0;
+			}
+		cache->max = max;
+		cache->timeout = timeout;
+		cache->mask = n - 1;
+		cache->buckets = (X509_CHAIN_CACHE_ENTRY **)(cache + 1);
+		cache->entries = cache->buckets + n;
+		cache->oldest = 0;
+		memset(cache->buckets, 0, n * sizeof(*cache->buckets));
+		memset(cache->entries, 0, max * sizeof(*cache->entries));
+		}
+
+	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
+	old = store->chain_cache;
+	store->chain_cache = cache;
+	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	if (old != NULL)
+		x509_chain_cache_free(old);
+	return 1;
+	}
+
+void x509_chain_cache_free(X509_CHAIN_CACHE *cache)
+	{
+	int i;
+
+	for (i = 0; i < cache->max; i++)
+		{
+		if (cache->entries[i] == NULL)
+			continue;
+		sk_X509_pop_free(cache->entries[i]->chain, X509_free);
+		OPENSSL_free(cache->entries[i]);
+		}
+	OPENSSL_free(cache);
+	}
+
+static X509_CHAIN_CACHE_ENTRY **chain_cache_find(X509_CHAIN_CACHE *cache,
+	const unsigned char *key)
+	{
+	X509_CHAIN_CACHE_ENTRY **pe;
+	unsigned long h;
+
+	h = key[0] | (key[1] << 8) | (key[2] << 16) | ((unsigned long)key[3] << 24);
+	for (pe = &cache->buckets[h & cache->mask]; *pe != NULL;
+	     pe = &(*pe)->next)
+		if (memcmp((*pe)->key, key, X509_CHAIN_CACHE_KEY_LENGTH) == 0)
+			break;
+	return pe;
+	}
+
+#if !defined(OPENSSL_NO_SHA) && !defined(OPENSSL_NO_SHA256)
+static void chain_cache_digest(SHA256_CTX *c, const void *data, size_t len)
+	{
+	SHA256_Update(c, &len, sizeof(len));
+	SHA256_Update(c, data, len);
+	}
+#endif
+
+/* Sets 'key' for the verification in 'ctx', or returns 0 if it cannot be
+ * cached: when the chain is started or checked by anything other than the
+ * store and the defaults, or CRLs or policies are checked. */
+static int chain_cache_key(X509_STORE_CTX *ctx, unsigned char *key)
+	{
+#if !defined(OPENSSL_NO_SHA) && !defined(OPENSSL_NO_SHA256)
+	X509_VERIFY_PARAM *param = ctx->param;
+	SHA256_CTX c;
+	X509 *x;
+	int i;
+
+	if (ctx->ctx == NULL || ctx->ctx->chain_cache == NULL
+		|| ctx->chain != NULL || ctx->crls != NULL
+		|| ctx->parent != NULL
+		|| ctx->verify != internal_verify
+		|| ctx->get_issuer != X509_STORE_CTX_get1_issuer
+		|| ctx->check_issued != check_issued
+		|| ctx->check_revocation != check_revocation
+		|| ctx->get_crl != NULL
+		|| ctx->check_crl != check_crl
+		|| ctx->cert_crl != cert_crl
+		|| ctx->check_policy != check_policy
+		|| ctx->lookup_certs != X509_STORE_get1_certs
+		|| ctx->lookup_crls != X509_STORE_get1_crls
+		|| (param->flags & (X509_V_FLAG_CRL_CHECK
+			| X509_V_FLAG_POLICY_MASK | X509_V_FLAG_NOTIFY_POLICY))
+		|| param->policies != NULL)
+		return 0;
+
+	SHA256_Init(&c);
+	X509_check_purpose(ctx->cert, -1, 0);
+	chain_cache_digest(&c, ctx->cert->sha1_hash, sizeof(ctx->cert->sha1_hash));
+	for (i = 0; i < sk_X509_num(ctx->untrusted); i++)
+		{
+		x = sk_X509_value(ctx->untrusted, i);
+		X509_check_purpose(x, -1, 0);
+		chain_cache_digest(&c, x->sha1_hash, sizeof(x->sha1_hash));
+		}
+	chain_cache_digest(&c, &param->flags, sizeof(param->flags));
+	chain_cache_digest(&c, &param->purpose, sizeof(param->purpose));
+	chain_cache_digest(&c, &param->trust, sizeof(param->trust));
+	chain_cache_digest(&c, &param->depth, sizeof(param->depth));
+	if (param->flags & X509_V_FLAG_USE_CHECK_TIME)
+		chain_cache_digest(&c, &param->check_time,
+			sizeof(param->check_time));
+	if (param->id != NULL)
+		{
+		chain_cache_digest(&c, param->id->host, param->id->hostlen);
+		chain_cache_digest(&c, param->id->email, param->id->emaillen);
+		chain_cache_digest(&c, param->id->ip, param->id->iplen);
+		}
+	SHA256_Final(key, &c);
+	return 1;
+#else
+	return 0;
+#endif
+	}
+
+static X509 *chain_cache_untrusted(X509_STORE_CTX *ctx, X509 *x)
+	{
+	X509 *u;
+	int i;
+
+	for (i = 0; i < sk_X509_num(ctx->untrusted); i++)
+		{
+		u = sk_X509_value(ctx->untrusted, i);
+		if (X509_cmp(u, x) == 0)
+			return u;
+		}
+	return NULL;
+	}
+
+/* Looks for the chain of 'key' and finishes a verification with it as
+ * internal_verify() would.  Returns -1 if it is not in the cache. */
+static int chain_cache_get(X509_STORE_CTX *ctx, const unsigned char *key,
+	unsigned long *pgeneration)
+	{
+	X509_STORE *store = ctx->ctx;
+	X509_CHAIN_CACHE_ENTRY *e;
+	STACK_OF(X509) *chain = NULL;
+	time_t *ptime = NULL;
+	X509 *x;
+	int i, n, last_untrusted = 0, ok;
+
+	CRYPTO_r_lock(CRYPTO_LOCK_X509_STORE);
+	*pgeneration = store->generation;
+	e = NULL;
+	if (store->chain_cache != NULL)
+		e = *chain_cache_find(store->chain_cache, key);
+	if (e != NULL && e->generation == store->generation
+		&& time(NULL) < e->expires
+		&& (chain = sk_X509_dup(e->chain)) != NULL)
+		{
+		for (i = 0; i < sk_X509_num(chain); i++)
+			CRYPTO_add(&sk_X509_value(chain, i)->references, 1,
+				CRYPTO_LOCK_X509);
+		last_untrusted = e->last_untrusted;
+		}
+	CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
+	if (chain == NULL)
+		return -1;
+
+	/* errors are left for a full verification to report */
+	if (ctx->param->flags & X509_V_FLAG_USE_CHECK_TIME)
+		ptime = &ctx->param->check_time;
+	for (i = 0; i < sk_X509_num(chain); i++)
+		{
+		x = sk_X509_value(chain, i);
+		if (X509_cmp_time(X509_get_notBefore(x), ptime) >= 0
+			|| X509_cmp_time(X509_get_notAfter(x), ptime) <= 0)
+			{
+			sk_X509_pop_free(chain, X509_free);
+			return -1;
+			}
+		}
+
+	/* the certificates passed, rather than the copies verified before,
+	 * compared in full since the key only tells their fingerprints */
+	if (X509_cmp(ctx->cert, sk_X509_value(chain, 0)) != 0)
+		{
+		sk_X509_pop_free(chain, X509_free);
+		return -1;
+		}
+	for (i = 0; i < last_untrusted && i < sk_X509_num(chain); i++)
+		{
+		x = i == 0 ? ctx->cert : chain_cache_untrusted(ctx,
+			sk_X509_value(chain, i));
+		if (x == NULL)
+			{
+			sk_X509_pop_free(chain, X509_free);
+			return -1;
+			}
+		CRYPTO_add(&x->references, 1, CRYPTO_LOCK_X509);
+		X509_free(sk_X509_value(chain, i));
+		(void)sk_X509_set(chain, i, x);
+		}
+
+	ctx->chain = chain;
+	ctx->last_untrusted = last_untrusted;
+	ctx->error = X509_V_OK;
+	n = sk_X509_num(chain) - 1;
+	for (i = n; i >= 0; i--)
+		{
+		ctx->error_depth = i;
+		ctx->current_cert = sk_X509_value(chain, i);
+		ctx->current_issuer = sk_X509_value(chain, i < n ? i + 1 : i);
+		ok = ctx->verify_cb(1, ctx);
+		if (!ok)
+			return 0;
+		}
+	return 1;
+	}
+
+static void chain_cache_put(X509_STORE_CTX *ctx, const unsigned char *key,
+	unsigned long generation)
+	{
+	X509_STORE *store = ctx->ctx;
+	X509_CHAIN_CACHE *cache;
+	X509_CHAIN_CACHE_ENTRY *e, **pe, *old = NULL;
+	int i;
+
+	if ((e = OPENSSL_malloc(sizeof(*e))) == NULL)
+		return;
+	if ((e->chain = sk_X509_dup(ctx->chain)) == NULL)
+		{
+		OPENSSL_free(e);
+		return;
+		}
+	for (i = 0; i < sk_X509_num(e->chain); i++)
+		CRYPTO_add(&sk_X509_value(e->chain, i)->references, 1,
+			CRYPTO_LOCK_X509);
+	memcpy(e->key, key, sizeof(e->key));
+	e->generation = generation;
+	e->last_untrusted = ctx->last_untrusted;
+
+	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
+	if ((cache = store->chain_cache) != NULL)
+		{
+		e->expires = time(NULL) + cache->timeout;
+		pe = chain_cache_find(cache, key);
+		if (*pe == NULL)
+			{
+			/* make room, dropping the oldest entry */
+			if ((old = cache->entries[cache->oldest]) != NULL)
+				*chain_cache_find(cache, old->key) = old->next;
+			cache->entries[cache->oldest] = e;
+			cache->oldest = (cache->oldest + 1) % cache->max;
+			pe = chain_cache_find(cache, key);
+			e->next = NULL;
+			*pe = e;
+			}
+		else
+			{
+			/* the entry keeps its place, 'e' takes the old chain */
+			old = *pe;
+			if (old->generation <= generation)
+				{
+				STACK_OF(X509) *chain = old->chain;
+
+				old->chain = e->chain;
+				old->generation = e->generation;
+				old->expires = e->expires;
+				old->last_untrusted = e->last_untrusted;
+				e->chain = chain;
+				}
+			old = e;
+			}
+		}
+	else
+		old = e;
+	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+
+	if (old != NULL)
+		{
+		sk_X509_pop_free(old->chain, X509_free);
+		OPENSSL_free(old);
+		}
+	}
+
 IMPLEMENT_STACK_OF(X509)
 IMPLEMENT_ASN1_SET_OF(X509)
 
@@ -209,9 +209,24 @@ struct x509_store_st
 
 	CRYPTO_EX_DATA ex_data;
 	int references;
+
+	/* Hash index of 'objs' by name searched by lookups; tables replaced
+	 * by larger ones wait in 'retired' until no lookup ('readers') can
+	 * still use them (see x509_lu.c).  'objs' must only be changed
+	 * through X509_STORE_add_cert() and X509_STORE_add_crl(). */
+	struct x509_store_index_st *index;
+	struct x509_store_index_st *retired;
+	int readers;
+
+	/* Chains verified by X509_verify_cert() if enabled with
+	 * X509_STORE_set_chain_cache(); adding objects to the store changes
+	 * its 'generation' and makes them stale. */
+	struct x509_chain_cache_st *chain_cache;
+	unsigned long generation;
 	} /* X509_STORE */;
 
 int X509_STORE_set_depth(X509_STORE *store, int depth);
+int X509_STORE_set_chain_cache(X509_STORE *store, int max, long timeout);
 
 #define X509_STORE_set_verify_cb_func(ctx,func) ((ctx)->verify_cb=(func))
 #define X509_STORE_set_verify_func(ctx,func)	((ctx)->verify=(func))
@@ -0,0 +1,1496 @@
+/* crypto/x509/x509storetest.c */
+/* Tests of the index of the objects of an X509_STORE and of the lookup in
+ * hashed directories, and benchmarks of loading and searching a large store
+ * and of verifying with a large directory:
+ *
+ *   x509storetest [-bench] [-n certificates] [-d files]
+ *
+ * The tests fill a store with certificates, some of them sharing a subject
+ * name, and with CRLs, and check that every name finds all its objects and
+ * nothing else, that names are matched in their canonical form and that
+ * duplicates are refused.  The same is checked of a store reading a
+ * directory, and that files added to the directory are found, that the
+ * cache of verified chains is used until the store changes, and that
+ * signatures verified are remembered for their issuer only.  With POSIX
+ * threads, threads released together look up a store while objects are
+ * added to it, and see the extension values of certificates cached
+ * complete by whichever thread gets to them first. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+#include <openssl/x509v3.h>
+#ifndef OPENSSL_NO_EC
+#include <openssl/ec.h>
+#include <openssl/ecdsa.h>
+#endif
+
+#if defined(OPENSSL_SYS_UNIX) && !defined(OPENSSL_NO_POSIX_IO)
+#define TEST_HASH_DIR
+#include <unistd.h>
+#include <dirent.h>
+#endif
+
+#if defined(OPENSSL_SYS_UNIX) && defined(OPENSSL_THREADS)
+#define TEST_THREADS
+#include <pthread.h>
+#endif
+
+/* Stores remember verified signatures where lookups take no lock, as in
+ * crypto/x509/x509_lcl.h */
+#if defined(__GNUC__) && !defined(OPENSSL_NO_X509_STORE_LOCKLESS) \
+	&& !defined(OPENSSL_NO_SHA256)
+#define TEST_SIG_MEMO
+#endif
+
+#ifdef OPENSSL_NO_EC
+int main(int argc, char *argv[])
+	{
+	puts("Elliptic curves are disabled.");
+	return 0;
+	}
+#else
+
+static EVP_PKEY *key;
+
+static X509_NAME *make_name(const char *fmt, int i)
+	{
+	X509_NAME *name;
+	char buf[64];
+
+	BIO_snprintf(buf, sizeof buf, fmt, i);
+	if ((name = X509_NAME_new()) == NULL)
+		return NULL;
+	if (!X509_NAME_add_entry_by_txt(name, "O", MBSTRING_ASC,
+			(unsigned char *)"x509storetest", -1, -1, 0)
+		|| !X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+			(unsigned char *)buf, -1, -1, 0))
+		{
+		X509_NAME_free(name);
+		return NULL;
+		}
+	return name;
+	}
+
+/* A certificate as it would be read from a file */
+static X509 *make_cert_issued(X509_NAME *subject, X509_NAME *issuer,
+	long serial)
+	{
+	X509 *x, *ret = NULL;
+	unsigned char *der = NULL;
+	const unsigned char *p;
+	int len;
+
+	if ((x = X509_new()) == NULL)
+		return NULL;
+	if (!X509_set_version(x, 2)
+		|| !ASN1_INTEGER_set(X509_get_serialNumber(x), serial)
+		|| !X509_set_subject_name(x, subject)
+		|| !X509_set_issuer_name(x, issuer)
+		|| !X509_gmtime_adj(X509_get_notBefore(x), 0)
+		|| !X509_gmtime_adj(X509_get_notAfter(x), 86400)
+		|| !X509_set_pubkey(x, key)
+		|| !X509_sign(x, key, EVP_sha256()))
+		goto end;
+	if ((len = i2d_X509(x, &der)) <= 0)
+		goto end;
+	p = der;
+	ret = d2i_X509(NULL, &p, len);
+ end:
+	if (der != NULL)
+		OPENSSL_free(der);
+	X509_free(x);
+	return ret;
+	}
+
+/* A certificate named "CA <i>" */
+static X509 *make_cert(int i, long serial)
+	{
+	X509 *ret;
+	X509_NAME *name;
+
+	if ((name = make_name("CA %d", i)) == NULL)
+		return NULL;
+	ret = make_cert_issued(name, name, serial);
+	X509_NAME_free(name);
+	return ret;
+	}
+
+/* A certificate named "leaf <i>" issued by "CA <ca>" */
+static X509 *make_leaf(int i, int ca)
+	{
+	X509 *ret = NULL;
+	X509_NAME *subject, *issuer = NULL;
+
+	if ((subject = make_name("leaf %d", i)) != NULL
+		&& (issuer = make_name("CA %d", ca)) != NULL)
+		ret = make_cert_issued(subject, issuer, 1);
+	if (subject != NULL)
+		X509_NAME_free(subject);
+	if (issuer != NULL)
+		X509_NAME_free(issuer);
+	return ret;
+	}
+
+/* A CRL issued by "CA <i>" */
+static X509_CRL *make_crl(int i, long days)
+	{
+	X509_CRL *crl, *ret = NULL;
+	X509_NAME *name;
+	ASN1_TIME *t = NULL;
+	unsigned char *der = NULL;
+	const unsigned char *p;
+	int len;
+
+	if ((crl = X509_CRL_new()) == NULL)
+		return NULL;
+	if ((name = make_name("CA %d", i)) == NULL)
+		goto end;
+	if ((t = X509_gmtime_adj(NULL, -86400 * days)) == NULL
+		|| !X509_CRL_set_issuer_name(crl, name)
+		|| !X509_CRL_set_lastUpdate(crl, t)
+		|| !X509_CRL_sign(crl, key, EVP_sha256()))
+		goto end;
+	if ((len = i2d_X509_CRL(crl, &der)) <= 0)
+		goto end;
+	p = der;
+	ret = d2i_X509_CRL(NULL, &p, len);
+ end:
+	if (der != NULL)
+		OPENSSL_free(der);
+	if (t != NULL)
+		ASN1_TIME_free(t);
+	X509_NAME_free(name);
+	X509_CRL_free(crl);
+	return ret;
+	}
+
+static int add_certs(X509_STORE *store, X509 **certs, int n)
+	{
+	int i, errors = 0;
+
+	for (i = 0; i < n; i++)
+		{
+		if (!X509_STORE_add_cert(store, certs[i]))
+			{
+			fprintf(stderr, "cannot add certificate %d\n", i);
+			errors++;
+			}
+		}
+	return errors;
+	}
+
+/* CA <i> has a second certificate if i is a multiple of 3 */
+static X509 **make_certs(int nca, int *pn)
+	{
+	X509 **certs;
+	int i, n = 0;
+
+	if ((certs = OPENSSL_malloc(2 * nca * sizeof *certs)) == NULL)
+		return NULL;
+	for (i = 0; i < nca; i++)
+		{
+		if ((certs[n++] = make_cert(i, 1)) == NULL)
+			break;
+		if (i % 3 == 0 && (certs[n++] = make_cert(i, 2)) == NULL)
+			break;
+		}
+	if (i < nca)
+		{
+		while (n > 0)
+			X509_free(certs[--n]);
+		OPENSSL_free(certs);
+		return NULL;
+		}
+	*pn = n;
+	return certs;
+	}
+
+static void free_certs(X509 **certs, int n)
+	{
+	while (n > 0)
+		X509_free(certs[--n]);
+	OPENSSL_free(certs);
+	}
+
+static int check_name(X509_STORE_CTX *ctx, X509_NAME *name, int ncerts,
+	int ncrls)
+	{
+	X509_OBJECT obj;
+	STACK_OF(X509) *certs;
+	STACK_OF(X509_CRL) *crls;
+	int i, errors = 0;
+
+	if (X509_STORE_get_by_subject(ctx, X509_LU_X509, name, &obj)
+		!= (ncerts > 0))
+		errors++;
+	else if (ncerts > 0)
+		{
+		if (X509_NAME_cmp(X509_get_subject_name(obj.data.x509), name))
+			errors++;
+		X509_OBJECT_free_contents(&obj);
+		}
+
+	certs = X509_STORE_get1_certs(ctx, name);
+	if (certs == NULL ? ncerts != 0 : sk_X509_num(certs) != ncerts)
+		errors++;
+	for (i = 0; i < sk_X509_num(certs); i++)
+		if (X509_NAME_cmp(X509_get_subject_name(sk_X509_value(certs, i)),
+				name))
+			errors++;
+	if (certs != NULL)
+		sk_X509_pop_free(certs, X509_free);
+
+	crls = X509_STORE_get1_crls(ctx, name);
+	if (crls == NULL ? ncrls != 0 : sk_X509_CRL_num(crls) != ncrls)
+		errors++;
+	for (i = 0; i < sk_X509_CRL_num(crls); i++)
+		if (X509_NAME_cmp(X509_CRL_get_issuer(sk_X509_CRL_value(crls, i)),
+				name))
+			errors++;
+	if (crls != NULL)
+		sk_X509_CRL_pop_free(crls, X509_CRL_free);
+	return errors;
+	}
+
+static int test_store(int nca)
+	{
+	X509_STORE *store = NULL;
+	X509_STORE_CTX *ctx = NULL;
+	X509_NAME *name;
+	X509 **certs = NULL, *x, *issuer;
+	X509_CRL *crl;
+	STACK_OF(X509_CRL) *crls;
+	int i, n = 0, errors = 0;
+
+	if ((store = X509_STORE_new()) == NULL
+		|| (ctx = X509_STORE_CTX_new()) == NULL
+		|| !X509_STORE_CTX_init(ctx, store, NULL, NULL)
+		|| (certs = make_certs(nca, &n)) == NULL)
+		{
+		errors++;
+		goto end;
+		}
+	errors += add_certs(store, certs, n);
+	/* CA <i> has a CRL if i is even, and two if a multiple of 4 */
+	for (i = 0; i < nca; i += 2)
+		{
+		if ((crl = make_crl(i, 1)) == NULL || !X509_STORE_add_crl(store, crl))
+			errors++;
+		X509_CRL_free(crl);
+		if (i % 4 != 0)
+			continue;
+		if ((crl = make_crl(i, 2)) == NULL || !X509_STORE_add_crl(store, crl))
+			errors++;
+		X509_CRL_free(crl);
+		}
+	if (errors)
+		{
+		fprintf(stderr, "cannot fill the store\n");
+		goto end;
+		}
+
+	/* the same objects read again are refused */
+	x = X509_dup(certs[n - 1]);
+	crl = NULL;
+	if ((name = make_name("CA %d", 0)) != NULL
+		&& (crls = X509_STORE_get1_crls(ctx, name)) != NULL)
+		{
+		crl = X509_CRL_dup(sk_X509_CRL_value(crls, 1));
+		sk_X509_CRL_pop_free(crls, X509_CRL_free);
+		}
+	X509_NAME_free(name);
+	if (x == NULL || X509_STORE_add_cert(store, x)
+		|| ERR_GET_REASON(ERR_peek_last_error())
+			!= X509_R_CERT_ALREADY_IN_HASH_TABLE
+		|| crl == NULL || X509_STORE_add_crl(store, crl))
+		{
+		fprintf(stderr, "duplicate added\n");
+		errors++;
+		}
+	ERR_clear_error();
+	X509_free(x);
+	X509_CRL_free(crl);
+
+	for (i = 0; i < nca + 10; i++)
+		{
+		if ((name = make_name("CA %d", i)) == NULL)
+			{
+			errors++;
+			break;
+			}
+		if (check_name(ctx, name,
+				i >= nca ? 0 : i % 3 == 0 ? 2 : 1,
+				i >= nca || i % 2 ? 0 : i % 4 == 0 ? 2 : 1))
+			{
+			fprintf(stderr, "wrong objects for CA %d\n", i);
+			errors++;
+			}
+		X509_NAME_free(name);
+		}
+
+	/* Names compare in their canonical form: case and spaces do not
+	 * count */
+	if ((name = make_name("  ca   %d ", nca - 1)) == NULL
+		|| check_name(ctx, name, (nca - 1) % 3 == 0 ? 2 : 1,
+			(nca - 1) % 2 ? 0 : (nca - 1) % 4 == 0 ? 2 : 1))
+		{
+		fprintf(stderr, "canonical name not found\n");
+		errors++;
+		}
+	X509_NAME_free(name);
+
+	/* The issuer of a certificate is found among the certificates of
+	 * its issuer name */
+	x = certs[n - 1];
+	if (X509_STORE_CTX_get1_issuer(&issuer, ctx, x) != 1)
+		{
+		fprintf(stderr, "issuer not found\n");
+		errors++;
+		}
+	else
+		X509_free(issuer);
+ end:
+	if (ctx != NULL)
+		X509_STORE_CTX_free(ctx);
+	if (store != NULL)
+		X509_STORE_free(store);
+	if (certs != NULL)
+		free_certs(certs, n);
+	if (errors == 0)
+		printf("store of %d certificates: ok\n", n);
+	return errors;
+	}
+
+static void bench(int nca)
+	{
+	X509_STORE *store;
+	X509_STORE_CTX *ctx;
+	X509_OBJECT obj;
+	X509 **certs;
+	clock_t t;
+	int i, n, found = 0;
+
+	if ((certs = make_certs(nca, &n)) == NULL)
+		return;
+	store = X509_STORE_new();
+	ctx = X509_STORE_CTX_new();
+	if (store == NULL || ctx == NULL
+		|| !X509_STORE_CTX_init(ctx, store, NULL, NULL))
+		goto end;
+
+	t = clock();
+	if (add_certs(store, certs, n))
+		goto end;
+	t = clock() - t;
+	printf("%-24s %8.2f us/certificate\n", "adding",
+		(double)t / CLOCKS_PER_SEC * 1e6 / n);
+
+	t = clock();
+	for (i = 0; i < n; i++)
+		{
+		if (X509_STORE_get_by_subject(ctx, X509_LU_X509,
+				X509_get_subject_name(certs[i]), &obj))
+			{
+			X509_OBJECT_free_contents(&obj);
+			found++;
+			}
+		}
+	t = clock() - t;
+	printf("%-24s %8.2f us/lookup\n", "looking up by subject",
+		(double)t / CLOCKS_PER_SEC * 1e6 / n);
+	if (found != n)
+		fprintf(stderr, "%d certificates not found\n", n - found);
+ end:
+	if (ctx != NULL)
+		X509_STORE_CTX_free(ctx);
+	if (store != NULL)
+		X509_STORE_free(store);
+	free_certs(certs, n);
+	}
+
+static int lookups;
+static X509 *lookup_ca;
+
+/* Finds 'lookup_ca' without adding it to the store */
+static int count_lookup(X509_LOOKUP *lu, int type, X509_NAME *name,
+	X509_OBJECT *ret)
+	{
+	lookups++;
+	if (type != X509_LU_X509 || lookup_ca == NULL
+		|| X509_NAME_cmp(name, X509_get_subject_name(lookup_ca)) != 0)
+		return 0;
+	ret->type = X509_LU_X509;
+	ret->data.x509 = lookup_ca;
+	return 1;
+	}
+
+static X509_LOOKUP_METHOD counting_lookup =
+	{
+	"counting lookup",
+	NULL, NULL, NULL, NULL, NULL,
+	count_lookup,
+	NULL, NULL, NULL
+	};
+
+static int verified;
+
+static int count_verified(int ok, X509_STORE_CTX *ctx)
+	{
+	if (ok)
+		verified++;
+	return ok;
+	}
+
+/* Verifies a copy of 'leaf', as a new connection would, and returns
+ * whether the chain was found in the cache.  The issuer is looked up,
+ * which is seen by the counting lookup method. */
+static int verify_cached(X509_STORE *store, X509 *leaf, int ok,
+	unsigned long flags)
+	{
+	X509_STORE_CTX *ctx;
+	X509 *x;
+	int n = lookups, ret = -1;
+
+	verified = 0;
+	if ((x = X509_dup(leaf)) == NULL
+		|| (ctx = X509_STORE_CTX_new()) == NULL)
+		{
+		if (x != NULL)
+			X509_free(x);
+		return -1;
+		}
+	if (X509_STORE_CTX_init(ctx, store, x, NULL))
+		{
+		X509_STORE_CTX_set_flags(ctx, flags);
+		if ((X509_verify_cert(ctx) > 0) != ok)
+			fprintf(stderr, "verification %s: %s\n",
+				ok ? "failed" : "succeeded",
+				X509_verify_cert_error_string(ctx->error));
+		else if (ok && (sk_X509_num(ctx->chain) != 2
+			|| sk_X509_value(ctx->chain, 0) != x || verified != 2))
+			fprintf(stderr, "wrong chain or callbacks\n");
+		else
+			ret = lookups == n;
+		}
+	X509_STORE_CTX_free(ctx);
+	X509_free(x);
+	return ret;
+	}
+
+static int test_chain_cache(void)
+	{
+	X509_STORE *store = NULL;
+	X509 *ca = NULL, *other = NULL, *leaves[4];
+	X509_CRL *crl = NULL;
+	int i, errors = 0;
+	/* leaf, success, then found in cache */
+	static const int steps[][3] =
+		{
+		{ 0, 1, 0 }, { 0, 1, 1 }, { 1, 1, 0 }, { 0, 1, 1 },
+		{ 2, 1, 0 }, { 0, 1, 0 }, { 3, 0, 0 }, { 3, 0, 0 },
+		};
+
+	memset(leaves, 0, sizeof leaves);
+	for (i = 0; i < 3; i++)
+		if ((leaves[i] = make_leaf(i, 0)) == NULL)
+			errors++;
+	if (errors
+		|| (leaves[3] = make_leaf(3, 2)) == NULL
+		|| (ca = make_cert(0, 1)) == NULL
+		|| (other = make_cert(1, 1)) == NULL
+		|| (crl = make_crl(0, 1)) == NULL
+		|| (store = X509_STORE_new()) == NULL
+		|| X509_STORE_add_lookup(store, &counting_lookup) == NULL
+		|| !X509_STORE_set_chain_cache(store, 2, 3600))
+		{
+		errors++;
+		goto end;
+		}
+	X509_STORE_set_verify_cb_func(store, count_verified);
+	lookup_ca = ca;
+
+	/* two entries, the oldest replaced first */
+	for (i = 0; i < (int)(sizeof steps / sizeof steps[0]); i++)
+		if (verify_cached(store, leaves[steps[i][0]], steps[i][1], 0)
+			!= steps[i][2])
+			{
+			fprintf(stderr, "chain cache step %d wrong\n", i);
+			errors++;
+			}
+
+	/* anything added to the store makes the cache stale */
+	if (!X509_STORE_add_cert(store, other)
+		|| verify_cached(store, leaves[0], 1, 0) != 0
+		|| verify_cached(store, leaves[0], 1, 0) != 1)
+		{
+		fprintf(stderr, "chain cache not stale after adding\n");
+		errors++;
+		}
+
+	/* CRLs and policies are checked each time */
+	if (!X509_STORE_add_crl(store, crl)
+		|| verify_cached(store, leaves[0], 1, 0) != 0)
+		errors++;
+	for (i = 0; i < 2; i++)
+		if (verify_cached(store, leaves[0], 1,
+				X509_V_FLAG_CRL_CHECK) != 0
+			|| verify_cached(store, leaves[0], 1,
+				X509_V_FLAG_POLICY_CHECK) != 0)
+			{
+			fprintf(stderr, "chain cache used for CRL or policy "
+				"check\n");
+			errors++;
+			}
+
+	/* expired at once, then disabled */
+	for (i = 0; i < 2; i++)
+		if (!X509_STORE_set_chain_cache(store, i ? 0 : 2, 0)
+			|| verify_cached(store, leaves[0], 1, 0) != 0
+			|| verify_cached(store, leaves[0], 1, 0) != 0)
+			{
+			fprintf(stderr, "chain cache used when %s\n",
+				i ? "disabled" : "expired");
+			errors++;
+			}
+ end:
+	for (i = 0; i < 4; i++)
+		if (leaves[i] != NULL)
+			X509_free(leaves[i]);
+	if (ca != NULL)
+		X509_free(ca);
+	if (other != NULL)
+		X509_free(other);
+	if (crl != NULL)
+		X509_CRL_free(crl);
+	if (store != NULL)
+		X509_STORE_free(store);
+	lookup_ca = NULL;
+	if (errors == 0)
+		printf("chain cache: ok\n");
+	return errors;
+	}
+
+#ifdef TEST_SIG_MEMO
+static int signatures;
+
+/* ECDSA_do_verify() of the default method, counted */
+static int count_verify(const unsigned char *dgst, int dgst_len,
+	const ECDSA_SIG *sig, EC_KEY *eckey)
+	{
+	EC_KEY *k;
+	int ret = -1;
+
+	signatures++;
+	if ((k = EC_KEY_new()) == NULL)
+		return -1;
+	if (EC_KEY_set_group(k, EC_KEY_get0_group(eckey))
+		&& EC_KEY_set_public_key(k, EC_KEY_get0_public_key(eckey)))
+		ret = ECDSA_do_verify(dgst, dgst_len, sig, k);
+	EC_KEY_free(k);
+	return ret;
+	}
+
+static int verify_error(X509_STORE *store, X509 *x, unsigned long flags)
+	{
+	X509_STORE_CTX *ctx;
+	int ret = -1;
+
+	if ((ctx = X509_STORE_CTX_new()) == NULL)
+		return -1;
+	if (X509_STORE_CTX_init(ctx, store, x, NULL))
+		{
+		X509_STORE_CTX_set_flags(ctx, flags);
+		X509_verify_cert(ctx);
+		ret = X509_STORE_CTX_get_error(ctx);
+		}
+	X509_STORE_CTX_free(ctx);
+	return ret;
+	}
+
+/* Memos are kept by the store, so "CA 0" signs an intermediate "CA 1"
+ * that is in the store with the CRLs; the leaf is verified each time. */
+static int test_sig_memo(void)
+	{
+	X509_STORE *store = NULL, *other = NULL;
+	X509 *ca = NULL, *ca2 = NULL, *inter = NULL, *leaf = NULL;
+	X509_NAME *name0 = NULL, *name1 = NULL;
+	X509_CRL *crl0 = NULL, *crl1 = NULL;
+	EVP_PKEY *pkey = NULL, *key2 = NULL, *key1 = key;
+	EC_KEY *ec = NULL;
+	ECDSA_METHOD *meth = NULL;
+	unsigned long flags = X509_V_FLAG_CRL_CHECK|X509_V_FLAG_CRL_CHECK_ALL;
+	int errors = 0;
+
+	/* "CA 0" again, with another key */
+	if ((ec = EC_KEY_new_by_curve_name(NID_X9_62_prime256v1)) == NULL
+		|| !EC_KEY_generate_key(ec)
+		|| (key2 = EVP_PKEY_new()) == NULL
+		|| !EVP_PKEY_set1_EC_KEY(key2, ec))
+		goto err;
+	EC_KEY_free(ec);
+	ec = NULL;
+	key = key2;
+	ca2 = make_cert(0, 1);
+	key = key1;
+
+	/* signatures by the key of 'ca' are counted */
+	if (ca2 == NULL
+		|| (name0 = make_name("CA %d", 0)) == NULL
+		|| (name1 = make_name("CA %d", 1)) == NULL
+		|| (ca = make_cert(0, 1)) == NULL
+		|| (inter = make_cert_issued(name1, name0, 2)) == NULL
+		|| (leaf = make_leaf(0, 1)) == NULL
+		|| (crl0 = make_crl(0, 1)) == NULL
+		|| (crl1 = make_crl(1, 1)) == NULL
+		|| (meth = ECDSA_METHOD_new(NULL)) == NULL
+		|| (pkey = X509_get_pubkey(ca)) == NULL
+		|| (ec = EVP_PKEY_get1_EC_KEY(pkey)) == NULL)
+		goto err;
+	ECDSA_METHOD_set_verify(meth, count_verify);
+	if (!ECDSA_set_method(ec, meth)
+		|| (store = X509_STORE_new()) == NULL
+		|| !X509_STORE_add_cert(store, ca)
+		|| !X509_STORE_add_cert(store, inter)
+		|| !X509_STORE_add_crl(store, crl0)
+		|| !X509_STORE_add_crl(store, crl1)
+		|| (other = X509_STORE_new()) == NULL
+		|| !X509_STORE_add_cert(other, ca2)
+		|| !X509_STORE_add_cert(other, inter))
+		goto err;
+
+	/* the intermediate and the CRL of "CA 0" once */
+	if (verify_error(store, leaf, flags) != X509_V_OK
+		|| signatures != 2
+		|| verify_error(store, leaf, flags) != X509_V_OK
+		|| signatures != 2)
+		{
+		fprintf(stderr, "signatures verified again: %d\n", signatures);
+		errors++;
+		}
+	/* not for an issuer with another key */
+	if (verify_error(other, leaf, 0) != X509_V_ERR_CERT_SIGNATURE_FAILURE)
+		{
+		fprintf(stderr, "signature accepted for another key\n");
+		errors++;
+		}
+	/* nor once signed again */
+	if (!X509_sign(inter, key, EVP_sha256())
+		|| verify_error(store, leaf, flags) != X509_V_OK
+		|| signatures != 3)
+		{
+		fprintf(stderr, "signature not verified after signing\n");
+		errors++;
+		}
+	goto end;
+ err:
+	errors++;
+ end:
+	if (ec != NULL)
+		EC_KEY_free(ec);
+	if (pkey != NULL)
+		EVP_PKEY_free(pkey);
+	if (key2 != NULL)
+		EVP_PKEY_free(key2);
+	if (name0 != NULL)
+		X509_NAME_free(name0);
+	if (name1 != NULL)
+		X509_NAME_free(name1);
+	if (ca != NULL)
+		X509_free(ca);
+	if (ca2 != NULL)
+		X509_free(ca2);
+	if (inter != NULL)
+		X509_free(inter);
+	if (leaf != NULL)
+		X509_free(leaf);
+	if (crl0 != NULL)
+		X509_CRL_free(crl0);
+	if (crl1 != NULL)
+		X509_CRL_free(crl1);
+	if (store != NULL)
+		X509_STORE_free(store);
+	if (other != NULL)
+		X509_STORE_free(other);
+	if (meth != NULL)
+		ECDSA_METHOD_free(meth);
+	if (errors == 0)
+		printf("signature memo: ok\n");
+	return errors;
+	}
+#endif
+
+/* Verifies new copies of a leaf, with and without the chain cache */
+static void bench_chain_cache(int n)
+	{
+	X509_STORE *store = NULL;
+	X509_STORE_CTX *ctx = NULL;
+	X509 *ca = NULL, *leaf = NULL, *x;
+	unsigned char *der = NULL;
+	const unsigned char *p;
+	clock_t t;
+	int i, k, len, bad = 0;
+
+	if ((ca = make_cert(0, 1)) == NULL
+		|| (leaf = make_leaf(0, 0)) == NULL
+		|| (len = i2d_X509(leaf, &der)) <= 0
+		|| (store = X509_STORE_new()) == NULL
+		|| (ctx = X509_STORE_CTX_new()) == NULL
+		|| !X509_STORE_add_cert(store, ca))
+		goto end;
+
+	for (k = 0; k < 2; k++)
+		{
+		if (k && !X509_STORE_set_chain_cache(store, 1000, 3600))
+			goto end;
+		t = clock();
+		for (i = 0; i < n; i++)
+			{
+			p = der;
+			if ((x = d2i_X509(NULL, &p, len)) == NULL)
+				goto end;
+			if (!X509_STORE_CTX_init(ctx, store, x, NULL)
+				|| X509_verify_cert(ctx) <= 0)
+				bad++;
+			X509_STORE_CTX_cleanup(ctx);
+			X509_free(x);
+			}
+		t = clock() - t;
+		printf("%-32s %8.0f/s\n", k ? "verifying, chain cached"
+			: "verifying, no chain cache",
+			t > 0 ? n * (double)CLOCKS_PER_SEC / t : 0);
+		}
+	if (bad)
+		fprintf(stderr, "%d verifications failed\n", bad);
+ end:
+	if (der != NULL)
+		OPENSSL_free(der);
+	if (ctx != NULL)
+		X509_STORE_CTX_free(ctx);
+	if (store != NULL)
+		X509_STORE_free(store);
+	if (leaf != NULL)
+		X509_free(leaf);
+	if (ca != NULL)
+		X509_free(ca);
+	}
+
+#ifdef TEST_HASH_DIR
+
+static int write_file(const char *dir, X509 *x, X509_CRL *crl, int k)
+	{
+	char path[256];
+	BIO *out;
+	int ok;
+
+	if (x != NULL)
+		BIO_snprintf(path, sizeof path, "%s/%08lx.%d", dir,
+			X509_NAME_hash(X509_get_subject_name(x)), k);
+	else
+		BIO_snprintf(path, sizeof path, "%s/%08lx.r%d", dir,
+			X509_NAME_hash(X509_CRL_get_issuer(crl)), k);
+	if ((out = BIO_new_file(path, "w")) == NULL)
+		return 0;
+	ok = x != NULL ? PEM_write_bio_X509(out, x)
+		: PEM_write_bio_X509_CRL(out, crl);
+	BIO_free(out);
+	return ok;
+	}
+
+static void remove_dir(const char *dir)
+	{
+	char path[256];
+	struct dirent *e;
+	DIR *d;
+
+	if ((d = opendir(dir)) == NULL)
+		return;
+	while ((e = readdir(d)) != NULL)
+		{
+		if (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0)
+			continue;
+		BIO_snprintf(path, sizeof path, "%s/%s", dir, e->d_name);
+		unlink(path);
+		}
+	closedir(d);
+	rmdir(dir);
+	}
+
+static X509_STORE *dir_store(const char *dir)
+	{
+	X509_STORE *store;
+	X509_LOOKUP *lookup;
+
+	if ((store = X509_STORE_new()) == NULL)
+		return NULL;
+	if ((lookup = X509_STORE_add_lookup(store, X509_LOOKUP_hash_dir()))
+			== NULL
+		|| !X509_LOOKUP_add_dir(lookup, dir, X509_FILETYPE_PEM))
+		{
+		X509_STORE_free(store);
+		return NULL;
+		}
+	return store;
+	}
+
+/* The same objects as test_store() in files of a directory */
+static int test_dir(int nca)
+	{
+	char dir[] = "x509storetest.XXXXXX";
+	X509_STORE *store = NULL;
+	X509_STORE_CTX *ctx = NULL;
+	X509_NAME *name = NULL;
+	X509 **certs = NULL, *x = NULL;
+	X509_CRL *crl;
+	int i, k, n = 0, errors = 0;
+
+	if (mkdtemp(dir) == NULL)
+		{
+		perror("mkdtemp");
+		return 1;
+		}
+	if ((certs = make_certs(nca, &n)) == NULL)
+		{
+		errors++;
+		goto end;
+		}
+	for (i = 0, k = 0; i < n; i++)
+		{
+		if (i > 0 && X509_NAME_cmp(X509_get_subject_name(certs[i]),
+				X509_get_subject_name(certs[i - 1])) == 0)
+			k++;
+		else
+			k = 0;
+		if (!write_file(dir, certs[i], NULL, k))
+			errors++;
+		}
+	for (i = 0; i < nca; i += 2)
+		{
+		for (k = 0; k < (i % 4 == 0 ? 2 : 1); k++)
+			{
+			if ((crl = make_crl(i, k + 1)) == NULL
+				|| !write_file(dir, NULL, crl, k))
+				errors++;
+			if (crl != NULL)
+				X509_CRL_free(crl);
+			}
+		}
+	if (errors
+		|| (store = dir_store(dir)) == NULL
+		|| (ctx = X509_STORE_CTX_new()) == NULL
+		|| !X509_STORE_CTX_init(ctx, store, NULL, NULL))
+		{
+		errors++;
+		goto end;
+		}
+
+	for (i = 0; i <= nca; i++)
+		{
+		int ncerts = i == nca ? 0 : i % 3 == 0 ? 2 : 1;
+		int ncrls = i == nca ? 0 : i % 4 == 0 ? 2 : i % 2 == 0 ? 1 : 0;
+
+		if ((name = make_name("CA %d", i)) == NULL)
+			{
+			errors++;
+			goto end;
+			}
+		/* twice, the second time from the store */
+		for (k = 0; k < 2; k++)
+			{
+			if (check_name(ctx, name, ncerts, ncrls))
+				{
+				fprintf(stderr, "objects of CA %d wrong in "
+					"directory\n", i);
+				errors++;
+				}
+			}
+		X509_NAME_free(name);
+		name = NULL;
+		}
+
+	/* a file added later is found once the directory is checked again,
+	 * at most a second later */
+	if ((x = make_cert(nca, 1)) == NULL || !write_file(dir, x, NULL, 0)
+		|| (name = make_name("CA %d", nca)) == NULL)
+		{
+		errors++;
+		goto end;
+		}
+	sleep(1);
+	if (check_name(ctx, name, 1, 0))
+		{
+		fprintf(stderr, "file added to directory not found\n");
+		errors++;
+		}
+ end:
+	if (name != NULL)
+		X509_NAME_free(name);
+	if (x != NULL)
+		X509_free(x);
+	if (ctx != NULL)
+		X509_STORE_CTX_free(ctx);
+	if (store != NULL)
+		X509_STORE_free(store);
+	if (certs != NULL)
+		free_certs(certs, n);
+	remove_dir(dir);
+	if (errors == 0)
+		printf("directory of %d certificates: ok\n", n);
+	return errors;
+	}
+
+static double verify_rate(X509_STORE *store, X509 **leaves, int n, int ok)
+	{
+	X509_STORE_CTX *ctx;
+	clock_t t;
+	int i, bad = 0;
+
+	if ((ctx = X509_STORE_CTX_new()) == NULL)
+		return 0;
+	t = clock();
+	for (i = 0; i < n; i++)
+		{
+		if (!X509_STORE_CTX_init(ctx, store, leaves[i], NULL))
+			bad++;
+		else if ((X509_verify_cert(ctx) > 0) != ok)
+			bad++;
+		X509_STORE_CTX_cleanup(ctx);
+		}
+	t = clock() - t;
+	X509_STORE_CTX_free(ctx);
+	if (bad)
+		fprintf(stderr, "%d verifications went wrong\n", bad);
+	return t > 0 ? n * (double)CLOCKS_PER_SEC / t : 0;
+	}
+
+/* Verifies leaves issued by CAs in a directory of 'nfiles' certificates,
+ * and by CAs not in it */
+static void bench_dir(int nfiles)
+	{
+	char dir[] = "x509storetest.XXXXXX";
+	X509_STORE *store = NULL;
+	X509 *x, **known = NULL, **unknown = NULL;
+	int i, nleaves = nfiles < 1000 ? nfiles : 1000;
+
+	if (mkdtemp(dir) == NULL)
+		{
+		perror("mkdtemp");
+		return;
+		}
+	for (i = 0; i < nfiles; i++)
+		{
+		if ((x = make_cert(i, 1)) == NULL)
+			goto end;
+		if (!write_file(dir, x, NULL, 0))
+			{
+			X509_free(x);
+			goto end;
+			}
+		X509_free(x);
+		}
+	known = OPENSSL_malloc(nleaves * sizeof *known);
+	unknown = OPENSSL_malloc(nleaves * sizeof *unknown);
+	if (known == NULL || unknown == NULL)
+		goto end;
+	memset(known, 0, nleaves * sizeof *known);
+	memset(unknown, 0, nleaves * sizeof *unknown);
+	for (i = 0; i < nleaves; i++)
+		{
+		if ((known[i] = make_leaf(i, (int)((long)i * nfiles / nleaves)))
+				== NULL
+			|| (unknown[i] = make_leaf(i, nfiles + i)) == NULL)
+			goto end;
+		}
+	if ((store = dir_store(dir)) == NULL)
+		goto end;
+
+	printf("directory of %d files:\n", nfiles);
+	printf("%-32s %8.0f/s\n", "verifying, issuer in file",
+		verify_rate(store, known, nleaves, 1));
+	printf("%-32s %8.0f/s\n", "verifying, issuer in store",
+		verify_rate(store, known, nleaves, 1));
+	printf("%-32s %8.0f/s\n", "verifying, issuer missing",
+		verify_rate(store, unknown, nleaves, 0));
+ end:
+	for (i = 0; i < nleaves; i++)
+		{
+		if (known != NULL && known[i] != NULL)
+			X509_free(known[i]);
+		if (unknown != NULL && unknown[i] != NULL)
+			X509_free(unknown[i]);
+		}
+	if (known != NULL)
+		OPENSSL_free(known);
+	if (unknown != NULL)
+		OPENSSL_free(unknown);
+	if (store != NULL)
+		X509_STORE_free(store);
+	remove_dir(dir);
+	}
+
+#endif
+
+#ifdef TEST_THREADS
+
+static pthread_mutex_t *lock_cs;
+
+static void locking_callback(int mode, int type, const char *file, int line)
+	{
+	if (mode & CRYPTO_LOCK)
+		pthread_mutex_lock(&lock_cs[type]);
+	else
+		pthread_mutex_unlock(&lock_cs[type]);
+	}
+
+static void thread_id(CRYPTO_THREADID *tid)
+	{
+	CRYPTO_THREADID_set_numeric(tid, (unsigned long)pthread_self());
+	}
+
+static int thread_setup(void)
+	{
+	int i;
+
+	lock_cs = OPENSSL_malloc(CRYPTO_num_locks() * sizeof *lock_cs);
+	if (lock_cs == NULL)
+		return 0;
+	for (i = 0; i < CRYPTO_num_locks(); i++)
+		pthread_mutex_init(&lock_cs[i], NULL);
+	CRYPTO_THREADID_set_callback(thread_id);
+	CRYPTO_set_locking_callback(locking_callback);
+	return 1;
+	}
+
+static void thread_cleanup(void)
+	{
+	int i;
+
+	CRYPTO_set_locking_callback(NULL);
+	for (i = 0; i < CRYPTO_num_locks(); i++)
+		pthread_mutex_destroy(&lock_cs[i]);
+	OPENSSL_free(lock_cs);
+	}
+
+#define MAX_THREADS	64
+
+struct thread_args
+	{
+	pthread_t thread;
+	int (*fn)(int n);
+	int n;
+	int errors;
+	};
+
+static pthread_mutex_t gate_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gate_cond = PTHREAD_COND_INITIALIZER;
+static int gate_open;
+
+static void *run_thread(void *arg)
+	{
+	struct thread_args *t = arg;
+
+	pthread_mutex_lock(&gate_lock);
+	while (!gate_open)
+		pthread_cond_wait(&gate_cond, &gate_lock);
+	pthread_mutex_unlock(&gate_lock);
+	t->errors = t->fn(t->n);
+	ERR_remove_thread_state(NULL);
+	return NULL;
+	}
+
+/* Runs fn(first), fn(first + 1), ... in 'nthreads' threads released
+ * together, and returns the number of threads that failed */
+static int run_threads(int nthreads, int first, int (*fn)(int n))
+	{
+	struct thread_args threads[MAX_THREADS];
+	int i, n, failed = 0;
+
+	if (nthreads > MAX_THREADS)
+		nthreads = MAX_THREADS;
+	gate_open = 0;
+	for (n = 0; n < nthreads; n++)
+		{
+		threads[n].fn = fn;
+		threads[n].n = first + n;
+		threads[n].errors = 0;
+		if (pthread_create(&threads[n].thread, NULL, run_thread,
+				&threads[n]) != 0)
+			{
+			fprintf(stderr, "cannot create thread\n");
+			failed++;
+			break;
+			}
+		}
+	pthread_mutex_lock(&gate_lock);
+	gate_open = 1;
+	pthread_cond_broadcast(&gate_cond);
+	pthread_mutex_unlock(&gate_lock);
+	for (i = 0; i < n; i++)
+		{
+		pthread_join(threads[i].thread, NULL);
+		if (threads[i].errors)
+			failed++;
+		}
+	return failed;
+	}
+
+static X509_STORE *shared_store;
+static X509 **shared_certs;
+static int shared_first, shared_n;
+
+/* The certificates of 'shared_certs' named like the i-th, next to it */
+static int shared_count(int i)
+	{
+	X509_NAME *name = X509_get_subject_name(shared_certs[i]);
+	int n = 1;
+
+	if (i > 0 && X509_NAME_cmp(name,
+			X509_get_subject_name(shared_certs[i - 1])) == 0)
+		n++;
+	if (i + 1 < shared_n && X509_NAME_cmp(name,
+			X509_get_subject_name(shared_certs[i + 1])) == 0)
+		n++;
+	return n;
+	}
+
+/* Thread 0 adds the certificates from 'shared_first' on while the others
+ * look up those before, as the index grows under them */
+static int check_lookups(int n)
+	{
+	X509_STORE_CTX *ctx;
+	int i, k, errors = 0;
+
+	if (n == 0)
+		return add_certs(shared_store, shared_certs + shared_first,
+			shared_n - shared_first);
+	if ((ctx = X509_STORE_CTX_new()) == NULL)
+		return 1;
+	if (!X509_STORE_CTX_init(ctx, shared_store, NULL, NULL))
+		errors++;
+	for (k = 0; k < 4 && errors == 0; k++)
+		for (i = 0; i < shared_first && errors == 0; i++)
+			errors += check_name(ctx,
+				X509_get_subject_name(shared_certs[i]),
+				shared_count(i), 0);
+	X509_STORE_CTX_free(ctx);
+	return errors;
+	}
+
+static int test_store_threads(int nca, int nthreads)
+	{
+	X509_STORE_CTX *ctx = NULL;
+	int i, failed, errors = 0;
+
+	if ((shared_certs = make_certs(nca, &shared_n)) == NULL
+		|| (shared_store = X509_STORE_new()) == NULL
+		|| (ctx = X509_STORE_CTX_new()) == NULL
+		|| !X509_STORE_CTX_init(ctx, shared_store, NULL, NULL))
+		{
+		errors++;
+		goto end;
+		}
+	/* the position of the first certificate of "CA <nca / 2>" */
+	shared_first = nca / 2 + (nca / 2 + 2) / 3;
+	if (add_certs(shared_store, shared_certs, shared_first))
+		{
+		errors++;
+		goto end;
+		}
+	if ((failed = run_threads(nthreads, 0, check_lookups)) != 0)
+		{
+		fprintf(stderr, "%d threads went wrong looking up\n", failed);
+		errors++;
+		}
+	for (i = 0; i < shared_n; i++)
+		{
+		if (check_name(ctx, X509_get_subject_name(shared_certs[i]),
+				shared_count(i), 0))
+			{
+			fprintf(stderr, "certificate %d not found\n", i);
+			errors++;
+			break;
+			}
+		}
+ end:
+	if (ctx != NULL)
+		X509_STORE_CTX_free(ctx);
+	if (shared_store != NULL)
+		X509_STORE_free(shared_store);
+	if (shared_certs != NULL)
+		free_certs(shared_certs, shared_n);
+	shared_store = NULL;
+	shared_certs = NULL;
+	if (errors == 0)
+		printf("store of %d certificates in %d threads: ok\n",
+			shared_n, nthreads);
+	return errors;
+	}
+
+static int add_ext(X509 *x, int nid, char *value)
+	{
+	X509_EXTENSION *ex;
+	int ok;
+
+	if ((ex = X509V3_EXT_conf_nid(NULL, NULL, nid, value)) == NULL)
+		return 0;
+	ok = X509_add_ext(x, ex, -1);
+	X509_EXTENSION_free(ex);
+	return ok;
+	}
+
+/* The encoding of a CA or client certificate named "<cn> <i>", issued by
+ * "CA <ca>" */
+static int make_ext_der(const char *cn, int i, int ca, int is_ca,
+	unsigned char **der)
+	{
+	X509 *x;
+	X509_NAME *subject = NULL, *issuer = NULL;
+	int len = 0;
+
+	if ((x = X509_new()) == NULL)
+		return 0;
+	if ((subject = make_name(cn, i)) == NULL
+		|| (issuer = make_name("CA %d", ca)) == NULL
+		|| !X509_set_version(x, 2)
+		|| !ASN1_INTEGER_set(X509_get_serialNumber(x), 1)
+		|| !X509_set_subject_name(x, subject)
+		|| !X509_set_issuer_name(x, issuer)
+		|| !X509_gmtime_adj(X509_get_notBefore(x), 0)
+		|| !X509_gmtime_adj(X509_get_notAfter(x), 86400)
+		|| !X509_set_pubkey(x, key))
+		goto end;
+	if (is_ca && (!add_ext(x, NID_basic_constraints,
+				"critical,CA:TRUE,pathlen:1")
+			|| !add_ext(x, NID_key_usage,
+				"critical,keyCertSign,cRLSign")))
+		goto end;
+	if (!is_ca && (!add_ext(x, NID_key_usage, "critical,digitalSignature")
+			|| !add_ext(x, NID_ext_key_usage, "clientAuth")))
+		goto end;
+	if (X509_sign(x, key, EVP_sha256()))
+		len = i2d_X509(x, der);
+ end:
+	if (subject != NULL)
+		X509_NAME_free(subject);
+	if (issuer != NULL)
+		X509_NAME_free(issuer);
+	X509_free(x);
+	return len > 0 ? len : 0;
+	}
+
+static STACK_OF(X509) *ext_untrusted;
+static X509 *ext_ca, *ext_leaf;
+
+/* What a thread saw of the certificates of a round */
+static int check_ext(int n)
+	{
+	X509_STORE_CTX *ctx;
+	X509 *ca = ext_ca, *leaf = ext_leaf;
+	int errors = 0;
+
+	/* each thread gets to the extensions in another way first */
+	switch (n % 3)
+		{
+	case 0:
+		if ((ctx = X509_STORE_CTX_new()) == NULL)
+			return 1;
+		if (!X509_STORE_CTX_init(ctx, shared_store, leaf,
+				ext_untrusted)
+			|| !X509_STORE_CTX_set_purpose(ctx,
+				X509_PURPOSE_SSL_CLIENT)
+			|| X509_verify_cert(ctx) <= 0)
+			errors++;
+		X509_STORE_CTX_free(ctx);
+		break;
+	case 1:
+		if (X509_check_issued(ca, leaf) != X509_V_OK)
+			errors++;
+		break;
+	case 2:
+		if (X509_check_purpose(leaf, X509_PURPOSE_SSL_CLIENT, 0) != 1)
+			errors++;
+		break;
+		}
+
+	if (X509_check_ca(ca) != 1 || X509_check_ca(leaf) != 0
+		|| X509_check_purpose(ca, X509_PURPOSE_SSL_CLIENT, 1) != 1
+		|| X509_check_purpose(leaf, X509_PURPOSE_SSL_CLIENT, 0) != 1
+		|| X509_check_purpose(leaf, X509_PURPOSE_SSL_SERVER, 0) != 0
+		|| !(ca->ex_flags & EXFLAG_CA) || ca->ex_pathlen != 1
+		|| !(ca->ex_flags & EXFLAG_KUSAGE)
+		|| !(leaf->ex_flags & EXFLAG_XKUSAGE)
+		|| leaf->ex_xkusage != XKU_SSL_CLIENT)
+		errors++;
+	return errors;
+	}
+
+static X509 *reread(unsigned char *der, int len)
+	{
+	const unsigned char *p = der;
+
+	return d2i_X509(NULL, &p, len);
+	}
+
+/* Threads are released together on an intermediate CA and a leaf just
+ * read, whose extensions none of them has looked at yet */
+static int test_ext_threads(int rounds, int nthreads)
+	{
+	X509 *root = NULL;
+	unsigned char *ca_der = NULL, *leaf_der = NULL;
+	int r, ca_len, leaf_len, failed = 0, errors = 0;
+
+	if ((root = make_cert(0, 1)) == NULL
+		|| (ca_len = make_ext_der("CA %d", 1, 0, 1, &ca_der)) == 0
+		|| (leaf_len = make_ext_der("leaf %d", 0, 1, 0,
+			&leaf_der)) == 0
+		|| (shared_store = X509_STORE_new()) == NULL
+		|| !X509_STORE_add_cert(shared_store, root)
+		|| (ext_untrusted = sk_X509_new_null()) == NULL)
+		{
+		fprintf(stderr, "cannot make certificates\n");
+		errors++;
+		goto end;
+		}
+
+	for (r = 0; r < rounds && failed == 0; r++)
+		{
+		/* certificates nobody has looked at */
+		if ((ext_ca = reread(ca_der, ca_len)) == NULL
+			|| (ext_leaf = reread(leaf_der, leaf_len)) == NULL
+			|| !sk_X509_push(ext_untrusted, ext_ca))
+			{
+			errors++;
+			break;
+			}
+		failed = run_threads(nthreads, r, check_ext);
+		sk_X509_pop(ext_untrusted);
+		X509_free(ext_ca);
+		X509_free(ext_leaf);
+		ext_ca = ext_leaf = NULL;
+		}
+	if (failed)
+		{
+		fprintf(stderr, "%d threads saw wrong extensions\n", failed);
+		errors++;
+		}
+ end:
+	if (ext_ca != NULL)
+		X509_free(ext_ca);
+	if (ext_leaf != NULL)
+		X509_free(ext_leaf);
+	ext_ca = ext_leaf = NULL;
+	if (ext_untrusted != NULL)
+		sk_X509_free(ext_untrusted);
+	ext_untrusted = NULL;
+	if (shared_store != NULL)
+		X509_STORE_free(shared_store);
+	shared_store = NULL;
+	if (root != NULL)
+		X509_free(root);
+	if (ca_der != NULL)
+		OPENSSL_free(ca_der);
+	if (leaf_der != NULL)
+		OPENSSL_free(leaf_der);
+	if (errors == 0)
+		printf("extensions in %d rounds of %d threads: ok\n",
+			rounds, nthreads);
+	return errors;
+	}
+
+#endif
+
+int main(int argc, char *argv[])
+	{
+	int n = 150000, nfiles = 10000, do_bench = 0, errors = 0;
+	EC_KEY *ec = NULL;
+
+	for (argc--, argv++; argc > 0; argc--, argv++)
+		{
+		if (strcmp(*argv, "-bench") == 0)
+			do_bench = 1;
+		else if (strcmp(*argv, "-n") == 0 && argc > 1)
+			{
+			n = atoi(*(++argv));
+			argc--;
+			}
+		else if (strcmp(*argv, "-d") == 0 && argc > 1)
+			{
+			nfiles = atoi(*(++argv));
+			argc--;
+			}
+		else
+			{
+			fprintf(stderr, "usage: x509storetest [-bench] "
+				"[-n certificates] [-d files]\n");
+			return 1;
+			}
+		}
+	if (n <= 0)
+		n = 1;
+	if (nfiles <= 0)
+		nfiles = 1;
+
+#ifdef TEST_THREADS
+	if (!thread_setup())
+		return 1;
+#endif
+	ERR_load_crypto_strings();
+	OpenSSL_add_all_digests();
+
+	if ((ec = EC_KEY_new_by_curve_name(NID_X9_62_prime256v1)) == NULL
+		|| !EC_KEY_generate_key(ec)
+		|| (key = EVP_PKEY_new()) == NULL
+		|| !EVP_PKEY_assign_EC_KEY(key, ec))
+		{
+		fprintf(stderr, "cannot make a key\n");
+		errors++;
+		goto end;
+		}
+	ec = NULL;
+
+	errors += test_store(10);
+	errors += test_store(1000);
+#ifdef TEST_HASH_DIR
+	errors += test_dir(30);
+#endif
+	errors += test_chain_cache();
+#ifdef TEST_SIG_MEMO
+	errors += test_sig_memo();
+#endif
+#ifdef TEST_THREADS
+	errors += test_store_threads(1000, 8);
+	errors += test_ext_threads(200, 8);
+#endif
+
+	if (do_bench)
+		{
+		bench(n);
+		bench_chain_cache(10000);
+#ifdef TEST_HASH_DIR
+		bench_dir(nfiles);
+#endif
+		}
+ end:
+	if (ec != NULL)
+		EC_KEY_free(ec);
+	if (key != NULL)
+		EVP_PKEY_free(key);
+	if (errors)
+		ERR_print_errors_fp(stderr);
+	ERR_free_strings();
+	EVP_cleanup();
+	CRYPTO_cleanup_all_ex_data();
+	ERR_remove_thread_state(NULL);
+#ifdef TEST_THREADS
+	thread_cleanup();
+#endif
+	return errors > 0 ? 1 : 0;
+	}
+#endif
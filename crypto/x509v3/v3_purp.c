@@ -61,6 +61,22 @@
 #include <openssl/x509v3.h>
 #include <openssl/x509_vfy.h>
 
+/* The extension values of a certificate are cached by the first thread
+ * to need them, with 'ex_cached' going from X509V3_EX_NONE to
+ * X509V3_EX_CACHING by compare-and-swap, and set to X509V3_EX_CACHED once
+ * they are complete.  Other threads yield to the one caching meanwhile,
+ * so no global lock is taken.  Without atomic operations or a way to
+ * yield, 'ex_cached' is read and set under CRYPTO_LOCK_X509. */
+#if defined(__GNUC__) && defined(OPENSSL_SYS_UNIX) \
+	&& !defined(OPENSSL_NO_X509_STORE_LOCKLESS)
+# define X509V3_EX_LOCKLESS
+# include <sched.h>
+#endif
+
+#define X509V3_EX_NONE		0
+#define X509V3_EX_CACHING	1
+#define X509V3_EX_CACHED	2
+
 static void x509v3_cache_extensions(X509 *x);
 
 static int check_ssl_ca(const X509 *x);
@@ -110,11 +126,7 @@ int X509_check_purpose(X509 *x, int id, int ca)
 {
 	int idx;
 	const X509_PURPOSE *pt;
-	if(!(x->ex_flags & EXFLAG_SET)) {
-		CRYPTO_w_lock(CRYPTO_LOCK_X509);
-		x509v3_cache_extensions(x);
-		CRYPTO_w_unlock(CRYPTO_LOCK_X509);
-	}
+	x509v3_cache_extensions(x);
 	if(id == -1) return 1;
 	idx = X509_PURPOSE_get_by_id(id);
 	if(idx == -1) return -1;
@@ -354,7 +366,7 @@ static void setup_crldp(X509 *x)
 		setup_dp(x, sk_DIST_POINT_value(x->crldp, i));
 	}
 
-static void x509v3_cache_extensions(X509 *x)
+static void x509v3_set_extensions(X509 *x)
 {
 	BASIC_CONSTRAINTS *bs;
 	PROXY_CERT_INFO_EXTENSION *pci;
@@ -364,7 +376,6 @@ static void x509v3_cache_extensions(X509 *x)
 	X509_EXTENSION *ex;
 	
 	int i;
-	if(x->ex_flags & EXFLAG_SET) return;
 #ifndef OPENSSL_NO_SHA
 	X509_digest(x, EVP_sha1(), x->sha1_hash, NULL);
 #endif
@@ -497,6 +508,44 @@ static void x509v3_cache_extensions(X509 *x)
 	x->ex_flags |= EXFLAG_SET;
 }
 
+static void x509v3_cache_extensions(X509 *x)
+{
+#ifdef X509V3_EX_LOCKLESS
+	int state;
+
+	for (;;) {
+		state = *(volatile int *)&x->ex_cached;
+		if (state == X509V3_EX_CACHED) {
+			/* for the values to be seen as they were set */
+			__sync_synchronize();
+			return;
+		}
+		if (state == X509V3_EX_NONE &&
+		    __sync_bool_compare_and_swap(&x->ex_cached,
+				X509V3_EX_NONE, X509V3_EX_CACHING))
+			break;
+		/* another thread is caching them */
+		sched_yield();
+	}
+	x509v3_set_extensions(x);
+	__sync_synchronize();
+	*(volatile int *)&x->ex_cached = X509V3_EX_CACHED;
+#else
+	int cached;
+
+	CRYPTO_r_lock(CRYPTO_LOCK_X509);
+	cached = x->ex_cached == X509V3_EX_CACHED;
+	CRYPTO_r_unlock(CRYPTO_LOCK_X509);
+	if (cached) return;
+	CRYPTO_w_lock(CRYPTO_LOCK_X509);
+	if (x->ex_cached != X509V3_EX_CACHED) {
+		x509v3_set_extensions(x);
+		x->ex_cached = X509V3_EX_CACHED;
+	}
+	CRYPTO_w_unlock(CRYPTO_LOCK_X509);
+#endif
+}
+
 /* CA checks common to all purposes
  * return codes:
  * 0 not a CA
@@ -537,11 +586,7 @@ static int check_ca(const X509 *x)
 
 int X509_check_ca(X509 *x)
 {
-	if(!(x->ex_flags & EXFLAG_SET)) {
-		CRYPTO_w_lock(CRYPTO_LOCK_X509);
-		x509v3_cache_extensions(x);
-		CRYPTO_w_unlock(CRYPTO_LOCK_X509);
-	}
+	x509v3_cache_extensions(x);
 
 	return check_ca(x);
 }
@@ -237,6 +237,12 @@ int dtls1_connect(SSL *s)
 			/* s->version=SSL3_VERSION; */
 			s->type=SSL_ST_CONNECT;
 
+			if (!ssl_cert_unshare(s, 1))
+				{
+				ret= -1;
+				goto end;
+				}
+
 			if (s->init_buf == NULL)
 				{
 				if ((buf=BUF_MEM_new()) == NULL)
@@ -311,7 +317,11 @@ int dtls1_connect(SSL *s)
 			s->shutdown=0;
 
 			/* every DTLS ClientHello resets Finished MAC */
-			ssl3_init_finished_mac(s);
+			if (!ssl3_init_finished_mac(s))
+				{
+				ret= -1;
+				goto end;
+				}
 
 			dtls1_start_timer(s);
 			ret=ssl3_client_hello(s);
@@ -733,6 +743,7 @@ int dtls1_connect(SSL *s)
 			/* else do it later in ssl3_write */
 
 			s->init_num=0;
+			ssl3_release_handshake_state(s);
 			s->renegotiate=0;
 			s->new_session=0;
 
@@ -167,7 +167,7 @@ static void dtls1_clear_queues(SSL *s)
 		rdata = (DTLS1_RECORD_DATA *) item->data;
 		if (rdata->rbuf.buf)
 			{
-			OPENSSL_free(rdata->rbuf.buf);
+			ssl_buf_release(s->initial_ctx, rdata->rbuf.buf, rdata->rbuf.len);
 			}
         OPENSSL_free(item->data);
         pitem_free(item);
@@ -178,7 +178,7 @@ static void dtls1_clear_queues(SSL *s)
 		rdata = (DTLS1_RECORD_DATA *) item->data;
 		if (rdata->rbuf.buf)
 			{
-			OPENSSL_free(rdata->rbuf.buf);
+			ssl_buf_release(s->initial_ctx, rdata->rbuf.buf, rdata->rbuf.len);
 			}
         OPENSSL_free(item->data);
         pitem_free(item);
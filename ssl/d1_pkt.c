@@ -189,7 +189,7 @@ dtls1_copy_record(SSL *s, pitem *item)
     rdata = (DTLS1_RECORD_DATA *)item->data;
     
     if (s->s3->rbuf.buf != NULL)
-        OPENSSL_free(s->s3->rbuf.buf);
+        ssl_buf_release(s->initial_ctx, s->s3->rbuf.buf, s->s3->rbuf.len);
     
     s->packet = rdata->packet;
     s->packet_length = rdata->packet_length;
@@ -353,7 +353,7 @@ dtls1_get_buffered_record(SSL *s)
 		rdata = (DTLS1_RECORD_DATA *)item->data;
 		
 		if (s->s3->rbuf.buf != NULL)
-			OPENSSL_free(s->s3->rbuf.buf);
+			ssl_buf_release(s->initial_ctx, s->s3->rbuf.buf, s->s3->rbuf.len);
 		
 		s->packet = rdata->packet;
 		s->packet_length = rdata->packet_length;
@@ -242,6 +242,12 @@ int dtls1_accept(SSL *s)
 				}
 			s->type=SSL_ST_ACCEPT;
 
+			if (!ssl_cert_unshare(s, 1))
+				{
+				ret= -1;
+				goto end;
+				}
+
 			if (s->init_buf == NULL)
 				{
 				if ((buf=BUF_MEM_new()) == NULL)
@@ -276,7 +282,11 @@ int dtls1_accept(SSL *s)
 #endif
 					if (!ssl_init_wbio_buffer(s,1)) { ret= -1; goto end; }
 
-				ssl3_init_finished_mac(s);
+				if (!ssl3_init_finished_mac(s))
+					{
+					ret= -1;
+					goto end;
+					}
 				s->state=SSL3_ST_SR_CLNT_HELLO_A;
 				s->ctx->stats.sess_accept++;
 				}
@@ -302,7 +312,11 @@ int dtls1_accept(SSL *s)
 			s->state=SSL3_ST_SW_FLUSH;
 			s->init_num=0;
 
-			ssl3_init_finished_mac(s);
+			if (!ssl3_init_finished_mac(s))
+				{
+				ret= -1;
+				goto end;
+				}
 			break;
 
 		case SSL3_ST_SW_HELLO_REQ_C:
@@ -356,8 +370,12 @@ int dtls1_accept(SSL *s)
 			s->s3->tmp.next_state=SSL3_ST_SR_CLNT_HELLO_A;
 
 			/* HelloVerifyRequest resets Finished MAC */
-			if (s->version != DTLS1_BAD_VER)
-				ssl3_init_finished_mac(s);
+			if (s->version != DTLS1_BAD_VER &&
+			    !ssl3_init_finished_mac(s))
+				{
+				ret= -1;
+				goto end;
+				}
 			break;
 			
 #ifndef OPENSSL_NO_SCTP
@@ -663,16 +681,10 @@ int dtls1_accept(SSL *s)
 				s->init_num=0;
 				if (!s->session->peer)
 					break;
-				/* For sigalgs freeze the handshake buffer
-				 * at this point and digest cached records.
+				/* For sigalgs freeze the handshake hashes
+				 * the CertificateVerify may be signed with.
 				 */
-				if (!s->s3->handshake_buffer)
-					{
-					SSLerr(SSL_F_DTLS1_ACCEPT,ERR_R_INTERNAL_ERROR);
-					return -1;
-					}
-				s->s3->flags |= TLS1_FLAGS_KEEP_HANDSHAKE;
-				if (!ssl3_digest_cached_records(s))
+				if (!ssl3_freeze_handshake_dgst(s))
 					return -1;
 				}
 			else
@@ -826,6 +838,7 @@ int dtls1_accept(SSL *s)
 			ssl_free_wbio_buffer(s);
 
 			s->init_num=0;
+			ssl3_release_handshake_state(s);
 
 			if (s->renegotiate == 2) /* skipped if we just sent a HelloRequest */
 				{
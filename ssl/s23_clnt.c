@@ -185,6 +185,12 @@ int ssl23_connect(SSL *s)
 			/* s->version=TLS1_VERSION; */
 			s->type=SSL_ST_CONNECT;
 
+			if (!ssl_cert_unshare(s, 1))
+				{
+				ret= -1;
+				goto end;
+				}
+
 			if (s->init_buf == NULL)
 				{
 				if ((buf=BUF_MEM_new()) == NULL)
@@ -203,7 +209,11 @@ int ssl23_connect(SSL *s)
 
 			if (!ssl3_setup_buffers(s)) { ret= -1; goto end; }
 
-			ssl3_init_finished_mac(s);
+			if (!ssl3_init_finished_mac(s))
+				{
+				ret= -1;
+				goto end;
+				}
 
 			s->state=SSL23_ST_CW_CLNT_HELLO_A;
 			s->ctx->stats.sess_connect++;
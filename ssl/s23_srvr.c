@@ -181,6 +181,12 @@ int ssl23_accept(SSL *s)
 			/* s->version=SSL3_VERSION; */
 			s->type=SSL_ST_ACCEPT;
 
+			if (!ssl_cert_unshare(s, 1))
+				{
+				ret= -1;
+				goto end;
+				}
+
 			if (s->init_buf == NULL)
 				{
 				if ((buf=BUF_MEM_new()) == NULL)
@@ -196,7 +202,11 @@ int ssl23_accept(SSL *s)
 				s->init_buf=buf;
 				}
 
-			ssl3_init_finished_mac(s);
+			if (!ssl3_init_finished_mac(s))
+				{
+				ret= -1;
+				goto end;
+				}
 
 			s->state=SSL23_ST_SR_CLNT_HELLO_A;
 			s->ctx->stats.sess_accept++;
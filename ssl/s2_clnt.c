@@ -180,6 +180,12 @@ int ssl2_connect(SSL *s)
 			s->version=SSL2_VERSION;
 			s->type=SSL_ST_CONNECT;
 
+			if (!ssl_cert_unshare(s, 1))
+				{
+				ret= -1;
+				goto end;
+				}
+
 			buf=s->init_buf;
 			if ((buf == NULL) && ((buf=BUF_MEM_new()) == NULL))
 				{
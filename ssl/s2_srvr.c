@@ -188,6 +188,12 @@ int ssl2_accept(SSL *s)
 			s->version=SSL2_VERSION;
 			s->type=SSL_ST_ACCEPT;
 
+			if (!ssl_cert_unshare(s, 1))
+				{
+				ret= -1;
+				goto end;
+				}
+
 			buf=s->init_buf;
 			if ((buf == NULL) && ((buf=BUF_MEM_new()) == NULL))
 				{ ret= -1; goto end; }
@@ -419,7 +419,8 @@ long ssl3_get_message(SSL *s, int st1, int stn, int mt, long max, int *ok)
 			 * start a new handshake?). We need to restart the mac.
 			 * Don't increment {num,total}_renegotiations because
 			 * we have not completed the handshake. */
-			ssl3_init_finished_mac(s);
+			if (!ssl3_init_finished_mac(s))
+				goto err;
 			}
 
 		s->s3->tmp.message_type= *(p++);
@@ -596,80 +597,6 @@ int ssl_verify_alarm_type(long type)
 	return(al);
 	}
 
-#ifndef OPENSSL_NO_BUF_FREELISTS
-/* On some platforms, malloc() performance is bad enough that you can't just
- * free() and malloc() buffers all the time, so we need to use freelists from
- * unused buffers.  Currently, each freelist holds memory chunks of only a
- * given size (list->chunklen); other sized chunks are freed and malloced.
- * This doesn't help much if you're using many different SSL option settings
- * with a given context.  (The options affecting buffer size are
- * max_send_fragment, read buffer vs write buffer,
- * SSL_OP_MICROSOFT_BIG_WRITE_BUFFER, SSL_OP_NO_COMPRESSION, and
- * SSL_OP_DONT_INSERT_EMPTY_FRAGMENTS.)  Using a separate freelist for every
- * possible size is not an option, since max_send_fragment can take on many
- * different values.
- *
- * If you are on a platform with a slow malloc(), and you're using SSL
- * connections with many different settings for these options, and you need to
- * use the SSL_MOD_RELEASE_BUFFERS feature, you have a few options:
- *    - Link against a faster malloc implementation.
- *    - Use a separate SSL_CTX for each option set.
- *    - Improve this code.
- */
-static void *
-freelist_extract(SSL_CTX *ctx, int for_read, int sz)
-	{
-	SSL3_BUF_FREELIST *list;
-	SSL3_BUF_FREELIST_ENTRY *ent = NULL;
-	void *result = NULL;
-
-	CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
-	list = for_read ? ctx->rbuf_freelist : ctx->wbuf_freelist;
-	if (list != NULL && sz == (int)list->chunklen)
-		ent = list->head;
-	if (ent != NULL)
-		{
-		list->head = ent->next;
-		result = ent;
-		if (--list->len == 0)
-			list->chunklen = 0;
-		}
-	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
-	if (!result)
-		result = OPENSSL_malloc(sz);
-	return result;
-}
-
-static void
-freelist_insert(SSL_CTX *ctx, int for_read, size_t sz, void *mem)
-	{
-	SSL3_BUF_FREELIST *list;
-	SSL3_BUF_FREELIST_ENTRY *ent;
-
-	CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
-	list = for_read ? ctx->rbuf_freelist : ctx->wbuf_freelist;
-	if (list != NULL &&
-	    (sz == list->chunklen || list->chunklen == 0) &&
-	    list->len < ctx->freelist_max_len &&
-	    sz >= sizeof(*ent))
-		{
-		list->chunklen = sz;
-		ent = mem;
-		ent->next = list->head;
-		list->head = ent;
-		++list->len;
-		mem = NULL;
-		}
-
-	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
-	if (mem)
-		OPENSSL_free(mem);
-	}
-#else
-#define freelist_extract(c,fr,sz) OPENSSL_malloc(sz)
-#define freelist_insert(c,fr,sz,m) OPENSSL_free(m)
-#endif
-
 int ssl3_setup_read_buffer(SSL *s)
 	{
 	unsigned char *p;
@@ -698,7 +625,11 @@ int ssl3_setup_read_buffer(SSL *s)
 		if (ssl_allow_compression(s))
 			len += SSL3_RT_MAX_COMPRESSED_OVERHEAD;
 #endif
-		if ((p=freelist_extract(s->ctx, 1, len)) == NULL)
+		/* A larger buffer lets read_ahead fetch several records at
+		 * once */
+		if (!SSL_IS_DTLS(s) && s->default_read_buf_len > len)
+			len = s->default_read_buf_len;
+		if ((p=ssl_buf_get(s->initial_ctx, len)) == NULL)
 			goto err;
 		s->s3->rbuf.buf = p;
 		s->s3->rbuf.len = len;
@@ -739,7 +670,7 @@ int ssl3_setup_write_buffer(SSL *s)
 			len += headerlen + align
 				+ SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD;
 
-		if ((p=freelist_extract(s->ctx, 0, len)) == NULL)
+		if ((p=ssl_buf_get(s->initial_ctx, len)) == NULL)
 			goto err;
 		s->s3->wbuf.buf = p;
 		s->s3->wbuf.len = len;
@@ -766,7 +697,7 @@ int ssl3_release_write_buffer(SSL *s)
 	{
 	if (s->s3->wbuf.buf != NULL)
 		{
-		freelist_insert(s->ctx, 0, s->s3->wbuf.len, s->s3->wbuf.buf);
+		ssl_buf_release(s->initial_ctx, s->s3->wbuf.buf, s->s3->wbuf.len);
 		s->s3->wbuf.buf = NULL;
 		}
 	return 1;
@@ -776,12 +707,36 @@ int ssl3_release_read_buffer(SSL *s)
 	{
 	if (s->s3->rbuf.buf != NULL)
 		{
-		freelist_insert(s->ctx, 1, s->s3->rbuf.len, s->s3->rbuf.buf);
+		ssl_buf_release(s->initial_ctx, s->s3->rbuf.buf, s->s3->rbuf.len);
 		s->s3->rbuf.buf = NULL;
 		}
 	return 1;
 	}
 
+/* Frees what only the handshake needed once it has completed, in
+ * SSL_MODE_RELEASE_HANDSHAKE_STATE */
+void ssl3_release_handshake_state(SSL *s)
+	{
+	if (!(s->mode & SSL_MODE_RELEASE_HANDSHAKE_STATE))
+		return;
+	ssl3_free_digest_list(s);
+	if (s->s3->tmp.ca_names != NULL)
+		{
+		sk_X509_NAME_pop_free(s->s3->tmp.ca_names, X509_NAME_free);
+		s->s3->tmp.ca_names = NULL;
+		}
+#ifndef OPENSSL_NO_TLSEXT
+	/* A client keeps the OCSP response for the application */
+	if (s->server && s->tlsext_ocsp_resp != NULL)
+		{
+		OPENSSL_free(s->tlsext_ocsp_resp);
+		s->tlsext_ocsp_resp = NULL;
+		s->tlsext_ocsp_resplen = -1;
+		}
+#endif
+	ssl_cert_share(s);
+	}
+
 int ssl_allow_compression(SSL *s)
 	{
 	if (s->options & SSL_OP_NO_COMPRESSION)
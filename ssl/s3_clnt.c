@@ -251,6 +251,12 @@ int ssl3_connect(SSL *s)
 			/* s->version=SSL3_VERSION; */
 			s->type=SSL_ST_CONNECT;
 
+			if (!ssl_cert_unshare(s, 1))
+				{
+				ret= -1;
+				goto end;
+				}
+
 			if (s->init_buf == NULL)
 				{
 				if ((buf=BUF_MEM_new()) == NULL)
@@ -274,7 +280,11 @@ int ssl3_connect(SSL *s)
 
 			/* don't push the buffering BIO quite yet */
 
-			ssl3_init_finished_mac(s);
+			if (!ssl3_init_finished_mac(s))
+				{
+				ret= -1;
+				goto end;
+				}
 
 			s->state=SSL3_ST_CW_CLNT_HELLO_A;
 			s->ctx->stats.sess_connect++;
@@ -638,6 +648,7 @@ int ssl3_connect(SSL *s)
 			/* else do it later in ssl3_write */
 
 			s->init_num=0;
+			ssl3_release_handshake_state(s);
 			s->renegotiate=0;
 			s->new_session=0;
 
@@ -1122,10 +1133,10 @@ int ssl3_get_server_hello(SSL *s)
 			}
 		}
 	s->s3->tmp.new_cipher=c;
-	/* Don't digest cached records if no sigalgs: we may need them for
-	 * client authentication.
+	/* Keep hashing the handshake in the digests our CertificateVerify
+	 * may need, if we may send one.
 	 */
-	if (!SSL_USE_SIGALGS(s) && !ssl3_digest_cached_records(s))
+	if (!ssl3_select_handshake_dgst(s, tls12_cert_verify_hashes(s, 0)))
 		goto f_err;
 	/* lets get the compression algorithm */
 	/* COMPRESSION */
@@ -2027,14 +2038,11 @@ int ssl3_get_certificate_request(SSL *s)
 	if (s->s3->tmp.message_type == SSL3_MT_SERVER_DONE)
 		{
 		s->s3->tmp.reuse_message=1;
-		/* If we get here we don't need any cached handshake records
-		 * as we wont be doing client auth.
+		/* If we get here we don't need the handshake hashes kept
+		 * for a CertificateVerify as we wont be doing client auth.
 		 */
-		if (s->s3->handshake_buffer)
-			{
-			if (!ssl3_digest_cached_records(s))
-				goto err;
-			}
+		if (!ssl3_select_handshake_dgst(s, 0))
+			goto err;
 		return(1);
 		}
 
@@ -2064,7 +2072,9 @@ int ssl3_get_certificate_request(SSL *s)
 		goto err;
 		}
 
-	/* get the certificate types */
+	/* get the certificate types, which are kept in s->cert */
+	if (!ssl_cert_unshare(s, 1))
+		goto err;
 	ctype_num= *(p++);
 	if (s->cert->ctypes)
 		{
@@ -2106,6 +2116,10 @@ int ssl3_get_certificate_request(SSL *s)
 			SSLerr(SSL_F_SSL3_GET_CERTIFICATE_REQUEST,SSL_R_SIGNATURE_ALGORITHMS_ERROR);
 			goto err;
 			}
+		/* Only the digests of the signature algorithms we share
+		 * with the server remain possible */
+		if (!ssl3_select_handshake_dgst(s, tls12_cert_verify_hashes(s, 1)))
+			goto err;
 		p += llen;
 		}
 
@@ -3156,12 +3170,11 @@ int ssl3_send_client_verify(SSL *s)
 		 */
 		if (SSL_USE_SIGALGS(s))
 			{
-			long hdatalen = 0;
-			void *hdata;
 			const EVP_MD *md = s->cert->key->digest;
-			hdatalen = BIO_get_mem_data(s->s3->handshake_buffer,
-								&hdata);
-			if (hdatalen <= 0 || !tls12_get_sigandhash(p, pkey, md))
+			EVP_MD_CTX *hdgst = NULL;
+			if (md != NULL)
+				hdgst = ssl3_get_handshake_dgst(s, EVP_MD_type(md));
+			if (hdgst == NULL || !tls12_get_sigandhash(p, pkey, md))
 				{
 				SSLerr(SSL_F_SSL3_SEND_CLIENT_VERIFY,
 						ERR_R_INTERNAL_ERROR);
@@ -3172,8 +3185,7 @@ int ssl3_send_client_verify(SSL *s)
 			fprintf(stderr, "Using TLS 1.2 with client alg %s\n",
 							EVP_MD_name(md));
 #endif
-			if (!EVP_SignInit_ex(&mctx, md, NULL)
-				|| !EVP_SignUpdate(&mctx, hdata, hdatalen)
+			if (!EVP_MD_CTX_copy_ex(&mctx, hdgst)
 				|| !EVP_SignFinal(&mctx, p + 2, &u, pkey))
 				{
 				SSLerr(SSL_F_SSL3_SEND_CLIENT_VERIFY,
@@ -3182,7 +3194,7 @@ int ssl3_send_client_verify(SSL *s)
 				}
 			s2n(u,p);
 			n = u + 4;
-			if (!ssl3_digest_cached_records(s))
+			if (!ssl3_select_handshake_dgst(s, 0))
 				goto err;
 			}
 		else
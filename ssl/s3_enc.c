@@ -566,94 +566,212 @@ int ssl3_enc(SSL *s, int send)
 	return(1);
 	}
 
-void ssl3_init_finished_mac(SSL *s)
+/* The handshake messages are hashed as they go. Until the cipher is known
+ * they are hashed in every digest available; ssl3_select_handshake_dgst()
+ * then keeps only those of the PRF and those a TLS 1.2 CertificateVerify
+ * may be signed with, and drops the latter once they are no longer
+ * needed. */
+
+static const EVP_MD *ssl3_handshake_dgst_md(int idx, long *mask)
 	{
-	if (s->s3->handshake_buffer) BIO_free(s->s3->handshake_buffer);
-	if (s->s3->handshake_dgst) ssl3_free_digest_list(s);
-    s->s3->handshake_buffer=BIO_new(BIO_s_mem());	
-	(void)BIO_set_close(s->s3->handshake_buffer,BIO_CLOSE);
+	const EVP_MD *md = NULL;
+
+	*mask = 0;
+	if (idx < SSL_MAX_DIGEST)
+		ssl_get_handshake_digest(idx, mask, &md);
+#ifndef OPENSSL_NO_SHA256
+	else if (idx == SSL3_HANDSHAKE_DGST_SHA224)
+		md = EVP_sha224();
+#endif
+#ifndef OPENSSL_NO_SHA512
+	else if (idx == SSL3_HANDSHAKE_DGST_SHA512)
+		md = EVP_sha512();
+#endif
+	return md;
 	}
 
-void ssl3_free_digest_list(SSL *s) 
+static void ssl3_free_dgst_array(EVP_MD_CTX **dgst)
 	{
 	int i;
-	if (!s->s3->handshake_dgst) return;
-	for (i=0;i<SSL_MAX_DIGEST;i++) 
+
+	for (i = 0; i < SSL3_NUM_HANDSHAKE_DGST; i++)
 		{
-		if (s->s3->handshake_dgst[i])
-			EVP_MD_CTX_destroy(s->s3->handshake_dgst[i]);
+		if (dgst[i] != NULL)
+			EVP_MD_CTX_destroy(dgst[i]);
 		}
-	OPENSSL_free(s->s3->handshake_dgst);
-	s->s3->handshake_dgst=NULL;
-	}	
+	OPENSSL_free(dgst);
+	}
 
+static EVP_MD_CTX **ssl3_new_dgst_array(void)
+	{
+	EVP_MD_CTX **dgst;
 
+	dgst = OPENSSL_malloc(SSL3_NUM_HANDSHAKE_DGST * sizeof(EVP_MD_CTX *));
+	if (dgst != NULL)
+		memset(dgst, 0, SSL3_NUM_HANDSHAKE_DGST * sizeof(EVP_MD_CTX *));
+	return dgst;
+	}
 
-void ssl3_finish_mac(SSL *s, const unsigned char *buf, int len)
+int ssl3_init_finished_mac(SSL *s)
 	{
-	if (s->s3->handshake_buffer && !(s->s3->flags & TLS1_FLAGS_KEEP_HANDSHAKE)) 
+	int i;
+	long mask;
+	const EVP_MD *md;
+	EVP_MD_CTX *d;
+
+	ssl3_free_digest_list(s);
+	if ((s->s3->handshake_dgst = ssl3_new_dgst_array()) == NULL)
 		{
-		BIO_write (s->s3->handshake_buffer,(void *)buf,len);
-		} 
-	else 
+		SSLerr(SSL_F_SSL3_INIT_FINISHED_MAC,ERR_R_MALLOC_FAILURE);
+		return 0;
+		}
+	for (i = 0; i < SSL3_NUM_HANDSHAKE_DGST; i++)
 		{
-		int i;
-		for (i=0;i< SSL_MAX_DIGEST;i++) 
+		if ((md = ssl3_handshake_dgst_md(i, &mask)) == NULL)
+			continue;
+		if ((d = EVP_MD_CTX_create()) == NULL)
 			{
-			if (s->s3->handshake_dgst[i]!= NULL)
-			EVP_DigestUpdate(s->s3->handshake_dgst[i],buf,len);
+			ssl3_free_digest_list(s);
+			SSLerr(SSL_F_SSL3_INIT_FINISHED_MAC,ERR_R_MALLOC_FAILURE);
+			return 0;
 			}
-		}	
+#ifdef OPENSSL_FIPS
+		if (EVP_MD_nid(md) == NID_md5)
+			EVP_MD_CTX_set_flags(d, EVP_MD_CTX_FLAG_NON_FIPS_ALLOW);
+#endif
+		if (!EVP_DigestInit_ex(d, md, NULL))
+			{
+			EVP_MD_CTX_destroy(d);
+			continue;
+			}
+		s->s3->handshake_dgst[i] = d;
+		}
+	return 1;
+	}
+
+void ssl3_free_digest_list(SSL *s) 
+	{
+	if (s->s3->handshake_dgst != NULL)
+		{
+		ssl3_free_dgst_array(s->s3->handshake_dgst);
+		s->s3->handshake_dgst = NULL;
+		}
+	if (s->s3->handshake_sig_dgst != NULL)
+		{
+		ssl3_free_dgst_array(s->s3->handshake_sig_dgst);
+		s->s3->handshake_sig_dgst = NULL;
+		}
 	}
 
-int ssl3_digest_cached_records(SSL *s)
+void ssl3_finish_mac(SSL *s, const unsigned char *buf, int len)
 	{
 	int i;
-	long mask;
+
+	if (s->s3->handshake_dgst == NULL)
+		return;
+	for (i = 0; i < SSL3_NUM_HANDSHAKE_DGST; i++)
+		{
+		if (s->s3->handshake_dgst[i] != NULL)
+			EVP_DigestUpdate(s->s3->handshake_dgst[i], buf, len);
+		}
+	}
+
+/* Once the cipher is known, frees the running hashes that neither its PRF
+ * nor a TLS 1.2 CertificateVerify signed with one of |sig_hashes|, a mask
+ * of 1 << TLSEXT_hash_*, can use. With no |sig_hashes| this also frees the
+ * hashes kept by ssl3_freeze_handshake_dgst(). */
+int ssl3_select_handshake_dgst(SSL *s, unsigned int sig_hashes)
+	{
+	int i, id;
+	long mask, alg2;
 	const EVP_MD *md;
-	long hdatalen;
-	void *hdata;
 
-	/* Allocate handshake_dgst array */
-	ssl3_free_digest_list(s);
-	s->s3->handshake_dgst = OPENSSL_malloc(SSL_MAX_DIGEST * sizeof(EVP_MD_CTX *));
-	memset(s->s3->handshake_dgst,0,SSL_MAX_DIGEST *sizeof(EVP_MD_CTX *));
-	hdatalen = BIO_get_mem_data(s->s3->handshake_buffer,&hdata);
-	if (hdatalen <= 0)
+	if (s->s3->handshake_dgst == NULL)
 		{
-		SSLerr(SSL_F_SSL3_DIGEST_CACHED_RECORDS, SSL_R_BAD_HANDSHAKE_LENGTH);
+		SSLerr(SSL_F_SSL3_SELECT_HANDSHAKE_DGST, ERR_R_INTERNAL_ERROR);
 		return 0;
 		}
+	alg2 = ssl_get_algorithm2(s);
+	for (i = 0; i < SSL3_NUM_HANDSHAKE_DGST; i++)
+		{
+		if (s->s3->handshake_dgst[i] == NULL)
+			continue;
+		md = ssl3_handshake_dgst_md(i, &mask);
+		if (mask & alg2)
+			continue;
+		id = tls12_get_hash_id(md);
+		if (id > 0 && (sig_hashes & (1U << id)))
+			continue;
+		EVP_MD_CTX_destroy(s->s3->handshake_dgst[i]);
+		s->s3->handshake_dgst[i] = NULL;
+		}
+	if (sig_hashes == 0 && s->s3->handshake_sig_dgst != NULL)
+		{
+		ssl3_free_dgst_array(s->s3->handshake_sig_dgst);
+		s->s3->handshake_sig_dgst = NULL;
+		}
+	return 1;
+	}
+
+/* A server that is to receive a TLS 1.2 CertificateVerify keeps the
+ * hashes of the handshake messages so far in handshake_sig_dgst, as the
+ * CertificateVerify is hashed before it is processed. Those the PRF still
+ * needs are forked, the others are no longer updated. */
+int ssl3_freeze_handshake_dgst(SSL *s)
+	{
+	int i;
+	long mask, alg2;
+	const EVP_MD *md;
+	EVP_MD_CTX *d;
 
-	/* Loop through bitso of algorithm2 field and create MD_CTX-es */
-	for (i=0;ssl_get_handshake_digest(i,&mask,&md); i++) 
+	if (s->s3->handshake_dgst == NULL)
+		{
+		SSLerr(SSL_F_SSL3_FREEZE_HANDSHAKE_DGST, ERR_R_INTERNAL_ERROR);
+		return 0;
+		}
+	if (s->s3->handshake_sig_dgst != NULL)
+		ssl3_free_dgst_array(s->s3->handshake_sig_dgst);
+	if ((s->s3->handshake_sig_dgst = ssl3_new_dgst_array()) == NULL)
+		goto err;
+	alg2 = ssl_get_algorithm2(s);
+	for (i = 0; i < SSL3_NUM_HANDSHAKE_DGST; i++)
 		{
-		if ((mask & ssl_get_algorithm2(s)) && md) 
+		if ((d = s->s3->handshake_dgst[i]) == NULL)
+			continue;
+		md = ssl3_handshake_dgst_md(i, &mask);
+		if (tls12_get_hash_id(md) <= 0)
+			continue;
+		if (!(mask & alg2))
 			{
-			s->s3->handshake_dgst[i]=EVP_MD_CTX_create();
-#ifdef OPENSSL_FIPS
-			if (EVP_MD_nid(md) == NID_md5)
-				{
-				EVP_MD_CTX_set_flags(s->s3->handshake_dgst[i],
-						EVP_MD_CTX_FLAG_NON_FIPS_ALLOW);
-				}
-#endif
-			EVP_DigestInit_ex(s->s3->handshake_dgst[i],md,NULL);
-			EVP_DigestUpdate(s->s3->handshake_dgst[i],hdata,hdatalen);
-			} 
-		else 
-			{	
-			s->s3->handshake_dgst[i]=NULL;
+			s->s3->handshake_dgst[i] = NULL;
+			s->s3->handshake_sig_dgst[i] = d;
+			continue;
 			}
+		if ((s->s3->handshake_sig_dgst[i] = EVP_MD_CTX_create()) == NULL ||
+		    !EVP_MD_CTX_copy_ex(s->s3->handshake_sig_dgst[i], d))
+			goto err;
 		}
-	if (!(s->s3->flags & TLS1_FLAGS_KEEP_HANDSHAKE))
+	return 1;
+ err:
+	SSLerr(SSL_F_SSL3_FREEZE_HANDSHAKE_DGST, ERR_R_MALLOC_FAILURE);
+	return 0;
+	}
+
+/* Returns the hash of the handshake messages in the digest |md_nid| for a
+ * CertificateVerify, or NULL if there is none */
+EVP_MD_CTX *ssl3_get_handshake_dgst(SSL *s, int md_nid)
+	{
+	EVP_MD_CTX **dgst = s->s3->handshake_sig_dgst;
+	int i;
+
+	if (dgst == NULL && (dgst = s->s3->handshake_dgst) == NULL)
+		return NULL;
+	for (i = 0; i < SSL3_NUM_HANDSHAKE_DGST; i++)
 		{
-		/* Free handshake_buffer BIO */
-		BIO_free(s->s3->handshake_buffer);
-		s->s3->handshake_buffer = NULL;
+		if (dgst[i] != NULL && EVP_MD_CTX_type(dgst[i]) == md_nid)
+			return dgst[i];
 		}
-
-	return 1;
+	return NULL;
 	}
 
 int ssl3_cert_verify_mac(SSL *s, int md_nid, unsigned char *p)
@@ -678,21 +796,10 @@ static int ssl3_handshake_mac(SSL *s, int md_nid,
 	unsigned char md_buf[EVP_MAX_MD_SIZE];
 	EVP_MD_CTX ctx,*d=NULL;
 
-	if (s->s3->handshake_buffer) 
-		if (!ssl3_digest_cached_records(s))
-			return 0;
+	if (!ssl3_select_handshake_dgst(s, 0))
+		return 0;
 
-	/* Search for digest of specified type in the handshake_dgst
-	 * array*/
-	for (i=0;i<SSL_MAX_DIGEST;i++) 
-		{
-		  if (s->s3->handshake_dgst[i]&&EVP_MD_CTX_type(s->s3->handshake_dgst[i])==md_nid) 
-		  	{
-		  	d=s->s3->handshake_dgst[i];
-			break;
-			}
-		}
-	if (!d) {
+	if ((d = ssl3_get_handshake_dgst(s, md_nid)) == NULL) {
 		SSLerr(SSL_F_SSL3_HANDSHAKE_MAC,SSL_R_NO_REQUIRED_DIGEST);
 		return 0;
 	}	
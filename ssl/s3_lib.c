@@ -3005,6 +3005,8 @@ void ssl3_free(SSL *s)
 		ssl3_release_write_buffer(s);
 	if (s->s3->rrec.comp != NULL)
 		OPENSSL_free(s->s3->rrec.comp);
+	if (s->s3->wrec.comp != NULL)
+		OPENSSL_free(s->s3->wrec.comp);
 #ifndef OPENSSL_NO_DH
 	if (s->s3->tmp.dh != NULL)
 		DH_free(s->s3->tmp.dh);
@@ -3016,10 +3018,7 @@ void ssl3_free(SSL *s)
 
 	if (s->s3->tmp.ca_names != NULL)
 		sk_X509_NAME_pop_free(s->s3->tmp.ca_names,X509_NAME_free);
-	if (s->s3->handshake_buffer) {
-		BIO_free(s->s3->handshake_buffer);
-	}
-	if (s->s3->handshake_dgst) ssl3_free_digest_list(s);
+	ssl3_free_digest_list(s);
 #ifndef OPENSSL_NO_TLSEXT
 	if (s->s3->alpn_selected)
 		OPENSSL_free(s->s3->alpn_selected);
@@ -3031,6 +3030,8 @@ void ssl3_free(SSL *s)
 #ifndef OPENSSL_NO_TLSEXT
 	if (s->s3->serverinfo_client_tlsext_custom_types != NULL)
 		OPENSSL_free(s->s3->serverinfo_client_tlsext_custom_types);
+	if (s->s3->client_exts != NULL)
+		OPENSSL_free(s->s3->client_exts);
 #endif
 	OPENSSL_cleanse(s->s3,sizeof *s->s3);
 	OPENSSL_free(s->s3);
@@ -3061,6 +3062,11 @@ void ssl3_clear(SSL *s)
 		OPENSSL_free(s->s3->rrec.comp);
 		s->s3->rrec.comp=NULL;
 		}
+	if (s->s3->wrec.comp != NULL)
+		{
+		OPENSSL_free(s->s3->wrec.comp);
+		s->s3->wrec.comp=NULL;
+		}
 #ifndef OPENSSL_NO_DH
 	if (s->s3->tmp.dh != NULL)
 		{
@@ -3082,6 +3088,11 @@ void ssl3_clear(SSL *s)
 		s->s3->serverinfo_client_tlsext_custom_types = NULL;
 		}
 	s->s3->serverinfo_client_tlsext_custom_types_count = 0;
+	if (s->s3->client_exts != NULL)
+		{
+		OPENSSL_free(s->s3->client_exts);
+		s->s3->client_exts = NULL;
+		}
 #ifndef OPENSSL_NO_EC
 	s->s3->is_probably_safari = 0;
 #endif /* !OPENSSL_NO_EC */
@@ -3092,13 +3103,7 @@ void ssl3_clear(SSL *s)
 	rlen = s->s3->rbuf.len;
  	wlen = s->s3->wbuf.len;
 	init_extra = s->s3->init_extra;
-	if (s->s3->handshake_buffer) {
-		BIO_free(s->s3->handshake_buffer);
-		s->s3->handshake_buffer = NULL;
-	}
-	if (s->s3->handshake_dgst) {
-		ssl3_free_digest_list(s);
-	}	
+	ssl3_free_digest_list(s);
 
 #if !defined(OPENSSL_NO_TLSEXT)
 	if (s->s3->alpn_selected)
@@ -3142,10 +3147,43 @@ static char * MS_CALLBACK srp_password_from_info_cb(SSL *s, void *arg)
 
 static int ssl3_set_req_cert_type(CERT *c, const unsigned char *p, size_t len);
 
+/* Whether ssl3_ctrl() changes s->cert for |cmd| */
+static int ssl3_ctrl_sets_cert(int cmd, long larg)
+	{
+	switch (cmd)
+		{
+	case SSL_CTRL_SET_TMP_RSA:
+	case SSL_CTRL_SET_TMP_DH:
+	case SSL_CTRL_SET_DH_AUTO:
+	case SSL_CTRL_SET_TMP_ECDH:
+	case SSL_CTRL_SET_ECDH_AUTO:
+	case SSL_CTRL_CHAIN:
+	case SSL_CTRL_CHAIN_CERT:
+	case SSL_CTRL_SELECT_CURRENT_CERT:
+	case SSL_CTRL_SET_SIGALGS:
+	case SSL_CTRL_SET_SIGALGS_LIST:
+	case SSL_CTRL_SET_CLIENT_SIGALGS:
+	case SSL_CTRL_SET_CLIENT_SIGALGS_LIST:
+	case SSL_CTRL_SET_CLIENT_CERT_TYPES:
+	case SSL_CTRL_BUILD_CERT_CHAIN:
+	case SSL_CTRL_SET_VERIFY_CERT_STORE:
+	case SSL_CTRL_SET_CHAIN_CERT_STORE:
+		return 1;
+	case SSL_CTRL_SET_CURRENT_CERT:
+		/* The server certificate is chosen for each handshake */
+		return larg != SSL_CERT_SET_SERVER;
+	default:
+		return 0;
+		}
+	}
+
 long ssl3_ctrl(SSL *s, int cmd, long larg, void *parg)
 	{
 	int ret=0;
 
+	if (ssl3_ctrl_sets_cert(cmd, larg) && !ssl_cert_unshare(s, 0))
+		return 0;
+
 #if !defined(OPENSSL_NO_DSA) || !defined(OPENSSL_NO_RSA)
 	if (
 #ifndef OPENSSL_NO_RSA
@@ -3445,7 +3483,7 @@ long ssl3_ctrl(SSL *s, int cmd, long larg, void *parg)
 			{
 			CERT_PKEY *cpk;
 			const SSL_CIPHER *cipher;
-			if (!s->server)
+			if (!s->server || !ssl_cert_unshare(s, 1))
 				return 0;
 			cipher = s->s3->tmp.new_cipher;
 			if (!cipher)
@@ -3625,6 +3663,10 @@ long ssl3_callback_ctrl(SSL *s, int cmd, void (*fp)(void))
 	{
 	int ret=0;
 
+	if ((cmd == SSL_CTRL_SET_TMP_RSA_CB || cmd == SSL_CTRL_SET_TMP_DH_CB ||
+	     cmd == SSL_CTRL_SET_TMP_ECDH_CB) && !ssl_cert_unshare(s, 0))
+		return 0;
+
 #if !defined(OPENSSL_NO_DSA) || !defined(OPENSSL_NO_RSA)
 	if (
 #ifndef OPENSSL_NO_RSA
@@ -4101,11 +4143,17 @@ SSL_CIPHER *ssl3_choose_cipher(SSL *s, STACK_OF(SSL_CIPHER) *clnt,
 	{
 	SSL_CIPHER *c,*ret=NULL;
 	STACK_OF(SSL_CIPHER) *prio, *allow;
-	int i,ii,ok;
+	int i,ii,ok,kl,masks_kl= -1;
 	CERT *cert;
-	unsigned long alg_k,alg_a,mask_k,mask_a,emask_k,emask_a;
-
-	/* Let's see which ciphers we can support */
+	unsigned long alg_k,alg_a,mask_k=0,mask_a=0,emask_k=0,emask_a=0;
+	/* Position + 1 in |allow| of each of ssl3_ciphers, 0 if not there */
+	unsigned short allow_pos[SSL3_NUM_CIPHERS];
+
+	/* Let's see which ciphers we can support. The masks and the
+	 * validity of the chains are worked out in s->cert, which must not
+	 * be the CERT of the SSL_CTX. */
+	if (!ssl_cert_unshare(s, 1))
+		return NULL;
 	cert=s->cert;
 
 #if 0
@@ -4146,24 +4194,50 @@ SSL_CIPHER *ssl3_choose_cipher(SSL *s, STACK_OF(SSL_CIPHER) *clnt,
 
 	tls1_set_cert_validity(s);
 
+	/* Index |allow| by position in ssl3_ciphers, where the ciphers of
+	 * both lists come from, so that each cipher of |prio| is looked up
+	 * in constant time rather than by a search of |allow|. */
+	memset(allow_pos, 0, sizeof(allow_pos));
+	for (i=sk_SSL_CIPHER_num(allow)-1; i >= 0; i--)
+		{
+		c=sk_SSL_CIPHER_value(allow,i);
+		if (c >= ssl3_ciphers && c < ssl3_ciphers + SSL3_NUM_CIPHERS
+			&& i < 0xffff)
+			allow_pos[c - ssl3_ciphers] = i + 1;
+		}
+
 	for (i=0; i<sk_SSL_CIPHER_num(prio); i++)
 		{
 		c=sk_SSL_CIPHER_value(prio,i);
 
+		if (c < ssl3_ciphers || c >= ssl3_ciphers + SSL3_NUM_CIPHERS)
+			continue;
+		ii=allow_pos[c - ssl3_ciphers] - 1;
+		if (ii < 0)
+			continue;
+
 		/* Skip TLS v1.2 only ciphersuites if not supported */
 		if ((c->algorithm_ssl & SSL_TLSV1_2) && 
 			!SSL_USE_TLS1_2_CIPHERS(s))
 			continue;
 
-		ssl_set_cert_masks(cert,c);
-		mask_k = cert->mask_k;
-		mask_a = cert->mask_a;
-		emask_k = cert->export_mask_k;
-		emask_a = cert->export_mask_a;
+		/* The masks only depend on the cipher through the key
+		 * length limit of export ciphers: work them out again only
+		 * when that changes. */
+		kl=SSL_C_EXPORT_PKEYLENGTH(c);
+		if (kl != masks_kl)
+			{
+			ssl_set_cert_masks(cert,c);
+			masks_kl = kl;
+			mask_k = cert->mask_k;
+			mask_a = cert->mask_a;
+			emask_k = cert->export_mask_k;
+			emask_a = cert->export_mask_a;
 #ifndef OPENSSL_NO_SRP
-		mask_k=cert->mask_k | s->srp_ctx.srp_Mask;
-		emask_k=cert->export_mask_k | s->srp_ctx.srp_Mask;
+			mask_k=cert->mask_k | s->srp_ctx.srp_Mask;
+			emask_k=cert->export_mask_k | s->srp_ctx.srp_Mask;
 #endif
+			}
 			
 #ifdef KSSL_DEBUG
 /*		printf("ssl3_choose_cipher %d alg= %lx\n", i,c->algorithms);*/
@@ -4212,23 +4286,19 @@ SSL_CIPHER *ssl3_choose_cipher(SSL *s, STACK_OF(SSL_CIPHER) *clnt,
 #endif /* OPENSSL_NO_TLSEXT */
 
 		if (!ok) continue;
-		ii=sk_SSL_CIPHER_find(allow,c);
-		if (ii >= 0)
-			{
-			/* Check security callback permits this cipher */
-			if (!ssl_security(s, SSL_SECOP_CIPHER_SHARED,
-						c->strength_bits, 0, c))
-				continue;
+		/* Check security callback permits this cipher */
+		if (!ssl_security(s, SSL_SECOP_CIPHER_SHARED,
+					c->strength_bits, 0, c))
+			continue;
 #if !defined(OPENSSL_NO_EC) && !defined(OPENSSL_NO_TLSEXT)
-			if ((alg_k & SSL_kECDHE) && (alg_a & SSL_aECDSA) && s->s3->is_probably_safari)
-				{
-				if (!ret) ret=sk_SSL_CIPHER_value(allow,ii);
-				continue;
-				}
-#endif
-			ret=sk_SSL_CIPHER_value(allow,ii);
-			break;
+		if ((alg_k & SSL_kECDHE) && (alg_a & SSL_aECDSA) && s->s3->is_probably_safari)
+			{
+			if (!ret) ret=sk_SSL_CIPHER_value(allow,ii);
+			continue;
 			}
+#endif
+		ret=sk_SSL_CIPHER_value(allow,ii);
+		break;
 		}
 	return(ret);
 	}
@@ -4395,7 +4465,10 @@ int ssl3_shutdown(SSL *s)
 		return(0);
 	}
 
-int ssl3_write(SSL *s, const void *buf, int len)
+/* Writes |len| bytes from |buf| or, if |iov| is not NULL, the |len| buffers
+ * at |iov| as application data */
+static int ssl3_write_internal(SSL *s, const void *buf, const SSL_IOVEC *iov,
+			       int len)
 	{
 	int ret,n;
 
@@ -4419,8 +4492,12 @@ int ssl3_write(SSL *s, const void *buf, int len)
 		/* First time through, we write into the buffer */
 		if (s->s3->delay_buf_pop_ret == 0)
 			{
-			ret=ssl3_write_bytes(s,SSL3_RT_APPLICATION_DATA,
-					     buf,len);
+			if (iov != NULL)
+				ret=ssl3_writev_bytes(s,SSL3_RT_APPLICATION_DATA,
+						      iov,len);
+			else
+				ret=ssl3_write_bytes(s,SSL3_RT_APPLICATION_DATA,
+						     buf,len);
 			if (ret <= 0) return(ret);
 
 			s->s3->delay_buf_pop_ret=ret;
@@ -4438,6 +4515,11 @@ int ssl3_write(SSL *s, const void *buf, int len)
 		ret=s->s3->delay_buf_pop_ret;
 		s->s3->delay_buf_pop_ret=0;
 		}
+	else if (iov != NULL)
+		{
+		ret=ssl3_writev_bytes(s,SSL3_RT_APPLICATION_DATA,iov,len);
+		if (ret <= 0) return(ret);
+		}
 	else
 		{
 		ret=s->method->ssl_write_bytes(s,SSL3_RT_APPLICATION_DATA,
@@ -4448,6 +4530,16 @@ int ssl3_write(SSL *s, const void *buf, int len)
 	return(ret);
 	}
 
+int ssl3_write(SSL *s, const void *buf, int len)
+	{
+	return ssl3_write_internal(s, buf, NULL, len);
+	}
+
+int ssl3_writev(SSL *s, const SSL_IOVEC *iov, int iovcnt)
+	{
+	return ssl3_write_internal(s, NULL, iov, iovcnt);
+	}
+
 static int ssl3_read_internal(SSL *s, void *buf, int len, int peek)
 	{
 	int ret;
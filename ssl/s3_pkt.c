@@ -110,6 +110,7 @@
  */
 
 #include <stdio.h>
+#include <limits.h>
 #include <errno.h>
 #define USE_SOCKETS
 #include "ssl_locl.h"
@@ -131,9 +132,25 @@
 # define EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK 0
 #endif
 
+/* Most records a scatter/gather write passes to the BIO at once */
+#define SSL3_WRITEV_MAX_RECORDS	8
+
+/* Most records a multi-record cipher opens at once */
+#define SSL3_READ_MAX_RECORDS	8
+
 static int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
 			 unsigned int len, int create_empty_fragment);
+static int ssl3_seal_record(SSL *s, int type, unsigned char *p,
+			    const unsigned char *buf, const SSL_IOVEC *iov,
+			    size_t off, unsigned int len);
 static int ssl3_get_record(SSL *s);
+static int ssl3_record_buffered(SSL *s);
+static unsigned int ssl3_read_batch(SSL *s, unsigned char *buf,
+				    unsigned int len);
+#if !defined(OPENSSL_NO_MULTIBLOCK) && EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK
+static int ssl3_open_records(SSL *s);
+static int ssl3_take_opened_record(SSL *s);
+#endif
 
 int ssl3_read_n(SSL *s, int n, int max, int extend)
 	{
@@ -286,6 +303,133 @@ int ssl3_read_n(SSL *s, int n, int max, int extend)
 	return(n);
 	}
 
+#if !defined(OPENSSL_NO_MULTIBLOCK) && EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK
+/* Accounts for the record in s->s3->rrec having been decrypted and verified
+ * in place, as tls1_enc() would have done it */
+static void ssl3_opened_record(SSL *s)
+	{
+	SSL3_RECORD *rr= &(s->s3->rrec);
+	int i;
+
+	rr->data += s->s3->rrec_eiv_len;
+	rr->input += s->s3->rrec_eiv_len;
+	rr->length -= s->s3->rrec_eiv_len+s->s3->rrec_tag_len;
+	for (i=7; i>=0; i--)
+		{
+		if (++s->s3->read_sequence[i] != 0)
+			break;
+		}
+	}
+
+/* Opens the application data record in s->packet together with the
+ * complete application data records that follow it in rbuf, in one call to
+ * a cipher that supports EVP_CTRL_TLS1_1_MULTIBLOCK_DECRYPT, if
+ * SSL_MODE_AEAD_MULTI_RECORD is set. Returns 1 if the record in s->packet
+ * verified, -1 if it did not and 0 if the records could not be opened
+ * together, in which case nothing was changed. The records after the first
+ * are taken with ssl3_take_opened_record(). */
+static int ssl3_open_records(SSL *s)
+	{
+	SSL3_RECORD *rr= &(s->s3->rrec);
+	SSL3_BUFFER *rb= &(s->s3->rbuf);
+	EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM mb_param;
+	unsigned char aad[13],*p,*end;
+	unsigned int n,len;
+	int i,eiv_len,overhead;
+
+	if (rr->type != SSL3_RT_APPLICATION_DATA ||
+	    !(s->mode & SSL_MODE_AEAD_MULTI_RECORD) ||
+	    s->expand != NULL || SSL_USE_ETM(s) || !SSL_USE_EXPLICIT_IV(s) ||
+	    s->enc_read_ctx == NULL ||
+	    !(EVP_CIPHER_flags(s->enc_read_ctx->cipher)&EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK))
+		return 0;
+
+	/* Count the complete records queued right behind this one */
+	p=s->packet+s->packet_length;
+	end=rb->buf+rb->offset+rb->left;
+	if (p != rb->buf+rb->offset)
+		return 0;
+	for (n=1; n < SSL3_READ_MAX_RECORDS; n++)
+		{
+		if (end-p < SSL3_RT_HEADER_LENGTH)
+			break;
+		len=p[3]<<8|p[4];
+		if (p[0] != SSL3_RT_APPLICATION_DATA ||
+		    (p[1]<<8|p[2]) != s->version ||
+		    len > SSL3_RT_MAX_ENCRYPTED_LENGTH ||
+		    end-p < SSL3_RT_HEADER_LENGTH+(long)len)
+			break;
+		p+=SSL3_RT_HEADER_LENGTH+len;
+		}
+	if (n < 2)
+		return 0;
+
+	memcpy(aad,s->s3->read_sequence,8);
+	aad[8]=SSL3_RT_APPLICATION_DATA;
+	aad[9]=(unsigned char)(s->version>>8);
+	aad[10]=(unsigned char)(s->version);
+	aad[11]=0;
+	aad[12]=0;
+	mb_param.out=NULL;
+	mb_param.inp=aad;
+	mb_param.len=0;
+	mb_param.interleave=n;
+	/* For opening the cipher tells the length of the explicit IV in
+	 * front of the payload, and the length of a record of no payload
+	 * gives the tag after it */
+	eiv_len=EVP_CIPHER_CTX_ctrl(s->enc_read_ctx,
+			EVP_CTRL_TLS1_1_MULTIBLOCK_AAD,
+			sizeof(mb_param),&mb_param);
+	overhead=EVP_CIPHER_CTX_ctrl(s->enc_read_ctx,
+			EVP_CTRL_TLS1_1_MULTIBLOCK_MAX_BUFSIZE,0,NULL)
+		- SSL3_RT_HEADER_LENGTH;
+	if (eiv_len < 0 || overhead < eiv_len ||
+	    rr->length < (unsigned int)overhead)
+		return 0;
+	s->s3->rrec_eiv_len=eiv_len;
+	s->s3->rrec_tag_len=overhead-eiv_len;
+
+	mb_param.out=s->packet;
+	mb_param.inp=s->packet;
+	mb_param.len=p-s->packet;
+	i=EVP_CIPHER_CTX_ctrl(s->enc_read_ctx,
+			EVP_CTRL_TLS1_1_MULTIBLOCK_DECRYPT,
+			sizeof(mb_param),&mb_param);
+	if (i < 0)
+		return 0;
+	if (i == 0)
+		return -1;
+	s->s3->rrec_ready=i-1;
+	s->s3->rrec_bad=(unsigned int)i < n;
+	ssl3_opened_record(s);
+	return 1;
+	}
+
+/* Takes the next record opened by ssl3_open_records(), returning 1 if it
+ * verified and -1 if not */
+static int ssl3_take_opened_record(SSL *s)
+	{
+	if (s->s3->rrec_ready == 0)
+		{
+		s->s3->rrec_bad=0;
+		return -1;
+		}
+	s->s3->rrec_ready--;
+	ssl3_opened_record(s);
+	return 1;
+	}
+#endif
+
+/* Whether rbuf holds a complete record that has not been read yet */
+static int ssl3_record_buffered(SSL *s)
+	{
+	SSL3_BUFFER *rb= &(s->s3->rbuf);
+	const unsigned char *p=rb->buf+rb->offset;
+
+	return rb->left >= SSL3_RT_HEADER_LENGTH &&
+		rb->left >= SSL3_RT_HEADER_LENGTH+(p[3]<<8|p[4]);
+	}
+
 /* MAX_EMPTY_RECORDS defines the number of consecutive, empty records that will
  * be processed per call to ssl3_get_record. Without this limit an attacker
  * could send empty records at a faster rate than we can process and cause
@@ -330,6 +474,13 @@ static int ssl3_get_record(SSL *s)
 		}
 
 again:
+	/* A batched read only takes records that are already buffered */
+	if (s->s3->read_batch && !ssl3_record_buffered(s))
+		{
+		s->rwstate=SSL_READING;
+		return -1;
+		}
+
 	/* check if we have the header */
 	if (	(s->rstate != SSL_ST_READ_BODY) ||
 		(s->packet_length < SSL3_RT_HEADER_LENGTH)) 
@@ -447,6 +598,12 @@ fprintf(stderr, "Record type=%d, Length=%d\n", rr->type, rr->length);
 			}
 		}
 
+#if !defined(OPENSSL_NO_MULTIBLOCK) && EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK
+	/* Records queued behind this one may be opened along with it */
+	if (s->s3->rrec_ready != 0 || s->s3->rrec_bad)
+		enc_err = ssl3_take_opened_record(s);
+	else if ((enc_err = ssl3_open_records(s)) == 0)
+#endif
 	enc_err = s->method->ssl3_enc->enc(s,0);
 	/* enc_err is:
 	 *    0: (in non-constant time) if the record is publically invalid.
@@ -683,7 +840,8 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
 	    len >= 4*(max_send_fragment=s->max_send_fragment) &&
 	    s->compress==NULL && s->msg_callback==NULL &&
 	    !SSL_USE_ETM(s) && SSL_USE_EXPLICIT_IV(s) &&
-	    EVP_CIPHER_flags(s->enc_write_ctx->cipher)&EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK)
+	    EVP_CIPHER_flags(s->enc_write_ctx->cipher)&EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK &&
+	    s->mode & SSL_MODE_AEAD_MULTI_RECORD)
 		{
 		unsigned char aad[13];
 		EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM mb_param;
@@ -704,12 +862,12 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
 			if (len>=8*max_send_fragment)	packlen *= 8;
 			else				packlen *= 4;
 
-			wb->buf=OPENSSL_malloc(packlen);
+			wb->buf=ssl_buf_get(s->initial_ctx, packlen);
 			wb->len=packlen;
 			}
 		else if (tot==len)		/* done? */
 			{
-			OPENSSL_free(wb->buf);	/* free jumbo buffer */
+			ssl_buf_release(s->initial_ctx, wb->buf, wb->len);	/* free jumbo buffer */
 			wb->buf = NULL;
 			return tot;
 			}
@@ -719,7 +877,7 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
 			{
 			if (n < 4*max_send_fragment)
 				{
-				OPENSSL_free(wb->buf);	/* free jumbo buffer */
+				ssl_buf_release(s->initial_ctx, wb->buf, wb->len);	/* free jumbo buffer */
 				wb->buf = NULL;
 				break;
 				}
@@ -755,7 +913,7 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
 
 			if (packlen<=0 || packlen>wb->len)	/* never happens */
 				{
-				OPENSSL_free(wb->buf);	/* free jumbo buffer */
+				ssl_buf_release(s->initial_ctx, wb->buf, wb->len);	/* free jumbo buffer */
 				wb->buf = NULL;
 				break;
 				}
@@ -789,7 +947,7 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
 				{
 				if (i<0)
 					{
-					OPENSSL_free(wb->buf);
+					ssl_buf_release(s->initial_ctx, wb->buf, wb->len);
 					wb->buf = NULL;
 					}
 				s->s3->wnum=tot;
@@ -797,7 +955,7 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
 				}
 			if (i==(int)n)
 				{
-				OPENSSL_free(wb->buf);	/* free jumbo buffer */
+				ssl_buf_release(s->initial_ctx, wb->buf, wb->len);	/* free jumbo buffer */
 				wb->buf = NULL;
 				return tot+i;
 				}
@@ -852,17 +1010,214 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
 		}
 	}
 
+/* Call this to write the concatenation of the |iovcnt| buffers at |iov| in
+ * records of type 'type'. Records are filled up to max_send_fragment
+ * whatever the buffer boundaries and up to SSL3_WRITEV_MAX_RECORDS of them
+ * are passed to the BIO in a single write. Returns as ssl3_write_bytes();
+ * a retry has to pass the same array.
+ */
+int ssl3_writev_bytes(SSL *s, int type, const SSL_IOVEC *iov, int iovcnt)
+	{
+	const unsigned char *id=(const unsigned char *)iov;
+	unsigned char *p;
+	size_t off,total=0,packlen;
+	unsigned int n,nw,sent,nrec,max_recs;
+	unsigned int max_send_fragment=s->max_send_fragment;
+	int i,len,tot,seg,jumbo;
+	long align=0;
+	SSL3_BUFFER *wb=&(s->s3->wbuf);
+
+	for (i=0; i<iovcnt; i++)
+		{
+		if (iov[i].len > (size_t)INT_MAX - total)
+			{
+			SSLerr(SSL_F_SSL3_WRITEV_BYTES,SSL_R_BAD_LENGTH);
+			return -1;
+			}
+		total+=iov[i].len;
+		}
+	len=(int)total;
+
+	s->rwstate=SSL_NOTHING;
+	tot=s->s3->wnum;
+	s->s3->wnum=0;
+
+	if (SSL_in_init(s) && !s->in_handshake)
+		{
+		i=s->handshake_func(s);
+		if (i < 0) return(i);
+		if (i == 0)
+			{
+			SSLerr(SSL_F_SSL3_WRITEV_BYTES,SSL_R_SSL_HANDSHAKE_FAILURE);
+			return -1;
+			}
+		}
+
+	/* A write still pending was sealed in a buffer of several records if
+	 * it was longer than one */
+	jumbo=wb->left != 0 && s->s3->wpend_tot > (int)max_send_fragment;
+
+	/* first check if there is a SSL3_BUFFER still being written
+	 * out.  This will happen with non blocking IO */
+	if (wb->left != 0)
+		{
+		i=ssl3_write_pending(s,type,id,s->s3->wpend_tot);
+		if (i<=0)
+			{
+			s->s3->wnum=tot;
+			return i;
+			}
+		tot+=i;
+		}
+
+	if (tot==len)		/* done? */
+		goto done;
+
+	/* Find the buffer the data still to be written starts in */
+	for (seg=0, off=tot; seg < iovcnt && off >= iov[seg].len; seg++)
+		off-=iov[seg].len;
+
+	for (;;)
+		{
+		if (s->s3->alert_dispatch)
+			{
+			i=s->method->ssl_dispatch_alert(s);
+			if (i <= 0)
+				{
+				s->s3->wnum=tot;
+				return i;
+				}
+			}
+
+		/* Writes of more than one record use a buffer that holds
+		 * several, allocated like the multi-block one and freed when
+		 * the call is done; a single record goes through the usual one
+		 * unless a larger buffer is already there */
+		n=(len-tot);
+		max_recs=(n + max_send_fragment - 1) / max_send_fragment;
+		if (max_recs > SSL3_WRITEV_MAX_RECORDS)
+			max_recs=SSL3_WRITEV_MAX_RECORDS;
+		if (max_recs > 1)
+			{
+			packlen=max_recs * (SSL3_RT_HEADER_LENGTH
+					+ max_send_fragment
+					+ SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD)
+				+ SSL3_RT_HEADER_LENGTH
+				+ SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD;
+#if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD!=0
+			packlen+=SSL3_ALIGN_PAYLOAD - 1;
+#endif
+#ifndef OPENSSL_NO_COMP
+			if (s->compress != NULL)
+				packlen+=max_recs * SSL3_RT_MAX_COMPRESSED_OVERHEAD;
+#endif
+			if (wb->buf != NULL && wb->len < packlen)
+				ssl3_release_write_buffer(s);
+			if (wb->buf == NULL)
+				{
+				if ((wb->buf=ssl_buf_get(s->initial_ctx,
+						packlen)) == NULL)
+					{
+					SSLerr(SSL_F_SSL3_WRITEV_BYTES,
+						ERR_R_MALLOC_FAILURE);
+					s->s3->wnum=tot;
+					return -1;
+					}
+				wb->len=packlen;
+				jumbo=1;
+				}
+			}
+		else if (wb->buf == NULL && !ssl3_setup_write_buffer(s))
+			{
+			s->s3->wnum=tot;
+			return -1;
+			}
+
+#if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD!=0
+		align = (long)wb->buf + SSL3_RT_HEADER_LENGTH;
+		align = (-align)&(SSL3_ALIGN_PAYLOAD-1);
+#endif
+		p = wb->buf + align;
+		wb->offset = align;
+
+		/* countermeasure against known-IV weakness in CBC ciphersuites,
+		 * as in do_ssl3_write() */
+		if (s->enc_write_ctx != NULL && !s->s3->empty_fragment_done)
+			{
+			if (s->s3->need_empty_fragments &&
+			    type == SSL3_RT_APPLICATION_DATA)
+				{
+				if ((i=ssl3_seal_record(s,type,p,id,NULL,0,0)) < 0)
+					{
+					s->s3->wnum=tot;
+					return -1;
+					}
+				p+=i;
+				}
+			s->s3->empty_fragment_done = 1;
+			}
+
+		/* Seal the records of this write back to back */
+		for (sent=0, nrec=0; sent < n && nrec < max_recs; nrec++)
+			{
+			nw=n - sent;
+			if (nw > max_send_fragment)
+				nw=max_send_fragment;
+			if ((i=ssl3_seal_record(s,type,p,NULL,&iov[seg],off,nw)) < 0)
+				{
+				s->s3->wnum=tot;
+				return -1;
+				}
+			p+=i;
+			sent+=nw;
+			for (off+=nw; seg < iovcnt && off >= iov[seg].len; seg++)
+				off-=iov[seg].len;
+			}
+
+		wb->left = (int)(p - wb->buf) - wb->offset;
+
+		/* memorize arguments so that ssl3_write_pending can detect bad write retries later */
+		s->s3->wpend_tot=sent;
+		s->s3->wpend_buf=id;
+		s->s3->wpend_type=type;
+		s->s3->wpend_ret=sent;
+
+		i=ssl3_write_pending(s,type,id,sent);
+		if (i <= 0)
+			{
+			s->s3->wnum=tot;
+			return i;
+			}
+
+		tot+=i;
+		if ((i == (int)n) ||
+			(type == SSL3_RT_APPLICATION_DATA &&
+			 (s->mode & SSL_MODE_ENABLE_PARTIAL_WRITE)))
+			break;
+		}
+
+	/* next chunk of data should get another prepended empty fragment
+	 * in ciphersuites with known-IV weakness: */
+	s->s3->empty_fragment_done = 0;
+ done:
+	if (jumbo)
+		{
+		ssl_buf_release(s->initial_ctx, wb->buf, wb->len);	/* free jumbo buffer */
+		wb->buf = NULL;
+		}
+	else if (s->mode & SSL_MODE_RELEASE_BUFFERS)
+		ssl3_release_write_buffer(s);
+	return tot;
+	}
+
 static int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
 			 unsigned int len, int create_empty_fragment)
 	{
-	unsigned char *p,*plen;
-	int i,mac_size,clear=0;
+	unsigned char *p;
+	int i,clear;
 	int prefix_len=0;
-	int eivlen;
 	long align=0;
-	SSL3_RECORD *wr;
 	SSL3_BUFFER *wb=&(s->s3->wbuf);
-	SSL_SESSION *sess;
 
  	if (wb->buf == NULL)
 		if (!ssl3_setup_write_buffer(s))
@@ -885,26 +1240,7 @@ static int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
 	if (len == 0 && !create_empty_fragment)
 		return 0;
 
-	wr= &(s->s3->wrec);
-	sess=s->session;
-
-	if (	(sess == NULL) ||
-		(s->enc_write_ctx == NULL) ||
-		(EVP_MD_CTX_md(s->write_hash) == NULL))
-		{
-#if 1
-		clear=s->enc_write_ctx?0:1;	/* must be AEAD cipher */
-#else
-		clear=1;
-#endif
-		mac_size=0;
-		}
-	else
-		{
-		mac_size=EVP_MD_CTX_size(s->write_hash);
-		if (mac_size < 0)
-			goto err;
-		}
+	clear=s->enc_write_ctx?0:1;
 
 #if 0 && !defined(OPENSSL_NO_MULTIBLOCK) && EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK
 	if (type==SSL3_RT_APPLICATION_DATA && s->compress==NULL &&
@@ -1010,6 +1346,71 @@ static int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
 		wb->offset  = align;
 		}
 
+	if ((i=ssl3_seal_record(s,type,p,buf,NULL,0,len)) < 0)
+		goto err;
+
+	if (create_empty_fragment)
+		{
+		/* we are in a recursive call;
+		 * just return the length, don't write out anything here
+		 */
+		return i;
+		}
+
+	/* now let's set up wb */
+	wb->left = prefix_len + i;
+
+	/* memorize arguments so that ssl3_write_pending can detect bad write retries later */
+	s->s3->wpend_tot=len;
+	s->s3->wpend_buf=buf;
+	s->s3->wpend_type=type;
+	s->s3->wpend_ret=len;
+
+	/* we now just need to write the buffer */
+	return ssl3_write_pending(s,type,buf,len);
+err:
+	return -1;
+	}
+
+/* Copies |len| bytes to |out| from the buffers at |iov|, starting |off|
+ * bytes into the first */
+static void ssl3_gather(unsigned char *out, const SSL_IOVEC *iov, size_t off,
+			unsigned int len)
+	{
+	size_t n;
+
+	for (; len > 0; iov++, off=0)
+		{
+		n=iov->len - off;
+		if (n > len)
+			n=len;
+		memcpy(out,(const unsigned char *)iov->base + off,n);
+		out+=n;
+		len-=n;
+		}
+	}
+
+/* Seals a record of |type| at |p|. Its |len| bytes of content are taken
+ * from |buf| or, if |iov| is not NULL, gathered from |iov| starting |off|
+ * bytes into its first buffer. Returns the length of the record including
+ * the header or -1 on error. */
+static int ssl3_seal_record(SSL *s, int type, unsigned char *p,
+			    const unsigned char *buf, const SSL_IOVEC *iov,
+			    size_t off, unsigned int len)
+	{
+	unsigned char *plen;
+	int mac_size=0;
+	int eivlen;
+	SSL3_RECORD *wr= &(s->s3->wrec);
+
+	if (s->session != NULL && s->enc_write_ctx != NULL &&
+	    EVP_MD_CTX_md(s->write_hash) != NULL)
+		{
+		mac_size=EVP_MD_CTX_size(s->write_hash);
+		if (mac_size < 0)
+			return -1;
+		}
+
 	/* write the header */
 
 	*(p++)=type&0xff;
@@ -1053,6 +1454,23 @@ static int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
 	wr->length=(int)len;
 	wr->input=(unsigned char *)buf;
 
+	/* The buffers of a scatter/gather write are copied straight into the
+	 * record, or into the input of the compressor */
+	if (iov != NULL)
+		{
+		if (s->compress == NULL)
+			wr->input=wr->data;
+		else if (wr->comp == NULL &&
+			 (wr->comp=OPENSSL_malloc(SSL3_RT_MAX_PLAIN_LENGTH)) == NULL)
+			{
+			SSLerr(SSL_F_DO_SSL3_WRITE,ERR_R_MALLOC_FAILURE);
+			return -1;
+			}
+		else
+			wr->input=wr->comp;
+		ssl3_gather(wr->input,iov,off,len);
+		}
+
 	/* we now 'read' from wr->input, wr->length bytes into
 	 * wr->data */
 
@@ -1062,12 +1480,13 @@ static int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
 		if (!ssl3_do_compress(s))
 			{
 			SSLerr(SSL_F_DO_SSL3_WRITE,SSL_R_COMPRESSION_FAILURE);
-			goto err;
+			return -1;
 			}
 		}
 	else
 		{
-		memcpy(wr->data,wr->input,wr->length);
+		if (wr->input != wr->data)
+			memcpy(wr->data,wr->input,wr->length);
 		wr->input=wr->data;
 		}
 
@@ -1078,7 +1497,7 @@ static int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
 	if (!SSL_USE_ETM(s) && mac_size != 0)
 		{
 		if (s->method->ssl3_enc->mac(s,&(p[wr->length + eivlen]),1) < 0)
-			goto err;
+			return -1;
 		wr->length+=mac_size;
 		}
 
@@ -1088,7 +1507,7 @@ static int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
 	if (eivlen)
 		{
 	/*	if (RAND_pseudo_bytes(p, eivlen) <= 0)
-			goto err; */
+			return -1; */
 		wr->length += eivlen;
 		}
 
@@ -1098,7 +1517,7 @@ static int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
 	if (SSL_USE_ETM(s) && mac_size != 0)
 		{
 		if (s->method->ssl3_enc->mac(s,p + wr->length,1) < 0)
-			goto err;
+			return -1;
 		wr->length+=mac_size;
 		}
 
@@ -1114,27 +1533,7 @@ static int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
 	wr->type=type; /* not needed but helps for debugging */
 	wr->length+=SSL3_RT_HEADER_LENGTH;
 
-	if (create_empty_fragment)
-		{
-		/* we are in a recursive call;
-		 * just return the length, don't write out anything here
-		 */
-		return wr->length;
-		}
-
-	/* now let's set up wb */
-	wb->left = prefix_len + wr->length;
-
-	/* memorize arguments so that ssl3_write_pending can detect bad write retries later */
-	s->s3->wpend_tot=len;
-	s->s3->wpend_buf=buf;
-	s->s3->wpend_type=type;
-	s->s3->wpend_ret=len;
-
-	/* we now just need to write the buffer */
-	return ssl3_write_pending(s,type,buf,len);
-err:
-	return -1;
+	return wr->length;
 	}
 
 /* if s->s3->wbuf.left != 0, we need to call this */
@@ -1217,6 +1616,65 @@ int ssl3_write_pending(SSL *s, int type, const unsigned char *buf,
  *     Application data protocol
  *             none of our business
  */
+/* Appends to |buf| the application data of the complete records that are
+ * already in rbuf, for SSL_MODE_READ_BATCH. Stops at the first record that
+ * is incomplete, and at the first one that is not application data or does
+ * not fit, which is left in rrec. If a record fails, the data already taken
+ * is returned and the failure is reported by the next read. */
+static unsigned int ssl3_read_batch(SSL *s, unsigned char *buf,
+				    unsigned int len)
+	{
+	SSL3_RECORD *rr= &(s->s3->rrec);
+	SSL3_BUFFER *rb= &(s->s3->rbuf);
+	unsigned int n,tot=0;
+	int ret;
+
+	s->s3->read_batch=1;
+	while (tot < len && ssl3_record_buffered(s) &&
+	       rb->buf[rb->offset] == SSL3_RT_APPLICATION_DATA)
+		{
+		ERR_set_mark();
+		ret=ssl3_get_record(s);
+		if (ret <= 0)
+			{
+			if (ret < 0 && s->rwstate != SSL_READING)
+				{
+				unsigned long l=ERR_peek_last_error();
+
+				/* Keep our own reasons, such as a bad MAC */
+				if (ERR_GET_LIB(l) == ERR_LIB_SSL &&
+				    ERR_GET_REASON(l) != 0)
+					s->s3->read_batch_error=
+						ERR_GET_REASON(l);
+				else
+					s->s3->read_batch_error=
+						SSL_R_BATCHED_RECORD_FAILED;
+				}
+			ERR_pop_to_mark();
+			s->rwstate=SSL_NOTHING;
+			break;
+			}
+		ERR_pop_to_mark();
+		if (rr->type != SSL3_RT_APPLICATION_DATA)
+			break;
+
+		n=rr->length;
+		if (n > len-tot)
+			n=len-tot;
+		memcpy(buf+tot,rr->data,n);
+		rr->length-=n;
+		rr->off=n;
+		tot+=n;
+		if (rr->length == 0)
+			{
+			s->rstate=SSL_ST_READ_HEADER;
+			rr->off=0;
+			}
+		}
+	s->s3->read_batch=0;
+	return tot;
+	}
+
 int ssl3_read_bytes(SSL *s, int type, unsigned char *buf, int len, int peek)
 	{
 	int al,i,j,ret;
@@ -1258,6 +1716,14 @@ int ssl3_read_bytes(SSL *s, int type, unsigned char *buf, int len, int peek)
 
 	/* Now s->s3->handshake_fragment_len == 0 if type == SSL3_RT_HANDSHAKE. */
 
+	if (s->s3->read_batch_error)
+		{
+		/* Reported once, as if the record had been read now */
+		SSLerr(SSL_F_SSL3_READ_BYTES,s->s3->read_batch_error);
+		s->s3->read_batch_error=0;
+		return -1;
+		}
+
 	if (!s->in_handshake && SSL_in_init(s))
 		{
 		/* type == SSL3_RT_APPLICATION_DATA */
@@ -1334,7 +1800,12 @@ start:
 				{
 				s->rstate=SSL_ST_READ_HEADER;
 				rr->off=0;
-				if (s->mode & SSL_MODE_RELEASE_BUFFERS)
+				if ((s->mode & SSL_MODE_READ_BATCH) &&
+				    type == SSL3_RT_APPLICATION_DATA &&
+				    n < (unsigned int)len)
+					n+=ssl3_read_batch(s,buf+n,len-n);
+				if (s->mode & SSL_MODE_RELEASE_BUFFERS &&
+				    rr->length == 0 && s->s3->rbuf.left == 0)
 					ssl3_release_read_buffer(s);
 				}
 			}
@@ -282,6 +282,14 @@ int ssl3_accept(SSL *s)
 
 			s->type=SSL_ST_ACCEPT;
 
+			/* The handshake changes s->cert, which may still be
+			 * that of the SSL_CTX */
+			if (!ssl_cert_unshare(s, 1))
+				{
+				ret= -1;
+				goto end;
+				}
+
 			if (s->init_buf == NULL)
 				{
 				if ((buf=BUF_MEM_new()) == NULL)
@@ -314,7 +322,11 @@ int ssl3_accept(SSL *s)
 				 */
 				if (!ssl_init_wbio_buffer(s,1)) { ret= -1; goto end; }
 				
-				ssl3_init_finished_mac(s);
+				if (!ssl3_init_finished_mac(s))
+					{
+					ret= -1;
+					goto end;
+					}
 				s->state=SSL3_ST_SR_CLNT_HELLO_A;
 				s->ctx->stats.sess_accept++;
 				}
@@ -349,7 +361,11 @@ int ssl3_accept(SSL *s)
 			s->state=SSL3_ST_SW_FLUSH;
 			s->init_num=0;
 
-			ssl3_init_finished_mac(s);
+			if (!ssl3_init_finished_mac(s))
+				{
+				ret= -1;
+				goto end;
+				}
 			break;
 
 		case SSL3_ST_SW_HELLO_REQ_C:
@@ -546,9 +562,8 @@ int ssl3_accept(SSL *s)
 				skip=1;
 				s->s3->tmp.cert_request=0;
 				s->state=SSL3_ST_SW_SRVR_DONE_A;
-				if (s->s3->handshake_buffer)
-					if (!ssl3_digest_cached_records(s))
-						return -1;
+				if (!ssl3_select_handshake_dgst(s, 0))
+					return -1;
 				}
 			else
 				{
@@ -660,16 +675,10 @@ int ssl3_accept(SSL *s)
 				s->init_num=0;
 				if (!s->session->peer)
 					break;
-				/* For sigalgs freeze the handshake buffer
-				 * at this point and digest cached records.
+				/* For sigalgs freeze the handshake hashes
+				 * the CertificateVerify may be signed with.
 				 */
-				if (!s->s3->handshake_buffer)
-					{
-					SSLerr(SSL_F_SSL3_ACCEPT,ERR_R_INTERNAL_ERROR);
-					return -1;
-					}
-				s->s3->flags |= TLS1_FLAGS_KEEP_HANDSHAKE;
-				if (!ssl3_digest_cached_records(s))
+				if (!ssl3_freeze_handshake_dgst(s))
 					return -1;
 				}
 			else
@@ -685,9 +694,8 @@ int ssl3_accept(SSL *s)
 				 * FIXME - digest processing for CertificateVerify
 				 * should be generalized. But it is next step
 				 */
-				if (s->s3->handshake_buffer)
-					if (!ssl3_digest_cached_records(s))
-						return -1;
+				if (!ssl3_select_handshake_dgst(s, 0))
+					return -1;
 				for (dgst_num=0; dgst_num<SSL_MAX_DIGEST;dgst_num++)	
 					if (s->s3->handshake_dgst[dgst_num]) 
 						{
@@ -826,6 +834,7 @@ int ssl3_accept(SSL *s)
 			ssl_free_wbio_buffer(s);
 
 			s->init_num=0;
+			ssl3_release_handshake_state(s);
 
 			if (s->renegotiate == 2) /* skipped if we just sent a HelloRequest */
 				{
@@ -946,10 +955,10 @@ int ssl3_check_client_hello(SSL *s)
 int ssl3_get_client_hello(SSL *s)
 	{
 	int i,j,ok,al=SSL_AD_INTERNAL_ERROR,ret= -1;
-	unsigned int cookie_len;
+	unsigned int cookie_len = 0;
 	long n;
 	unsigned long id;
-	unsigned char *p,*d;
+	unsigned char *p,*d,*cookie;
 	SSL_CIPHER *c;
 #ifndef OPENSSL_NO_COMP
 	unsigned char *q;
@@ -981,6 +990,9 @@ int ssl3_get_client_hello(SSL *s)
 
 	if (!ok) return((int)n);
 	s->first_packet=0;
+	/* A ClientHello taken again for the ClientHello callback is not read
+	 * afresh, which would have moved on the state */
+	s->state=SSL3_ST_SR_CLNT_HELLO_C;
 	d=p=(unsigned char *)s->init_msg;
 
 	/* use version from inside client hello, not from record header
@@ -1018,52 +1030,14 @@ int ssl3_get_client_hello(SSL *s)
 			return 1;
 		}
 
-	/* load the client random */
-	memcpy(s->s3->client_random,p,SSL3_RANDOM_SIZE);
-	p+=SSL3_RANDOM_SIZE;
-
-	/* get the session-id */
-	j= *(p++);
-
-	s->hit=0;
-	/* Versions before 0.9.7 always allow clients to resume sessions in renegotiation.
-	 * 0.9.7 and later allow this by default, but optionally ignore resumption requests
-	 * with flag SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION (it's a new flag rather
-	 * than a change to default behavior so that applications relying on this for security
-	 * won't even compile against older library versions).
-	 *
-	 * 1.0.1 and later also have a function SSL_renegotiate_abbreviated() to request
-	 * renegotiation but not a new session (s->new_session remains unset): for servers,
-	 * this essentially just means that the SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION
-	 * setting will be ignored.
-	 */
-	if ((s->new_session && (s->options & SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION)))
-		{
-		if (!ssl_get_new_session(s,1))
-			goto err;
-		}
-	else
-		{
-		i=ssl_get_prev_session(s, p, j, d + n);
-		if (i == 1)
-			{ /* previous session */
-			s->hit=1;
-			}
-		else if (i == -1)
-			goto err;
-		else /* i == 0 */
-			{
-			if (!ssl_get_new_session(s,1))
-				goto err;
-			}
-		}
-
-	p+=j;
-
 	if (SSL_IS_DTLS(s))
 		{
-		/* cookie stuff */
-		cookie_len = *(p++);
+		/* The cookie follows the random and the session-id. It is
+		 * verified first, so that only a ClientHello that is to be
+		 * answered with a ServerHello goes any further. */
+		cookie = p + SSL3_RANDOM_SIZE;
+		cookie += *cookie + 1;
+		cookie_len = *(cookie++);
 
 		/* 
 		 * The ClientHello may contain a cookie even if the
@@ -1082,7 +1056,7 @@ int ssl3_get_client_hello(SSL *s)
 		if ((SSL_get_options(s) & SSL_OP_COOKIE_EXCHANGE) &&
 			cookie_len > 0)
 			{
-			memcpy(s->d1->rcvd_cookie, p, cookie_len);
+			memcpy(s->d1->rcvd_cookie, cookie, cookie_len);
 
 			if ( s->ctx->app_verify_cookie_cb != NULL)
 				{
@@ -1107,8 +1081,86 @@ int ssl3_get_client_hello(SSL *s)
 			/* Set to -2 so if successful we return 2 */
 			ret = -2;
 			}
+		}
+
+#ifndef OPENSSL_NO_TLSEXT
+	/* Let the application look at the ClientHello before any state is
+	 * set up for it */
+	if (s->ctx->client_hello_cb != NULL)
+		{
+		if (!tls1_index_clienthello_tlsext(s, d, n))
+			{
+			al = SSL_AD_INTERNAL_ERROR;
+			SSLerr(SSL_F_SSL3_GET_CLIENT_HELLO,ERR_R_MALLOC_FAILURE);
+			goto f_err;
+			}
+		al = SSL_AD_HANDSHAKE_FAILURE;
+		i = s->ctx->client_hello_cb(s, &al,
+			s->ctx->client_hello_cb_arg);
+		if (i == SSL_CLIENT_HELLO_RETRY)
+			{
+			/* Take the same ClientHello again when called back */
+			s->rwstate = SSL_CLIENT_HELLO_CB;
+			s->s3->tmp.reuse_message = 1;
+			s->state = SSL3_ST_SR_CLNT_HELLO_B;
+			return -1;
+			}
+		if (i != SSL_CLIENT_HELLO_SUCCESS)
+			{
+			SSLerr(SSL_F_SSL3_GET_CLIENT_HELLO,SSL_R_CLIENT_HELLO_CB_ERROR);
+			goto f_err;
+			}
+		s->rwstate = SSL_NOTHING;
+		al = SSL_AD_INTERNAL_ERROR;
+		}
+#endif
+
+	/* load the client random */
+	memcpy(s->s3->client_random,p,SSL3_RANDOM_SIZE);
+	p+=SSL3_RANDOM_SIZE;
+
+	/* get the session-id */
+	j= *(p++);
+
+	s->hit=0;
+	/* Versions before 0.9.7 always allow clients to resume sessions in renegotiation.
+	 * 0.9.7 and later allow this by default, but optionally ignore resumption requests
+	 * with flag SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION (it's a new flag rather
+	 * than a change to default behavior so that applications relying on this for security
+	 * won't even compile against older library versions).
+	 *
+	 * 1.0.1 and later also have a function SSL_renegotiate_abbreviated() to request
+	 * renegotiation but not a new session (s->new_session remains unset): for servers,
+	 * this essentially just means that the SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION
+	 * setting will be ignored.
+	 */
+	if ((s->new_session && (s->options & SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION)))
+		{
+		if (!ssl_get_new_session(s,1))
+			goto err;
+		}
+	else
+		{
+		i=ssl_get_prev_session(s, p, j, d + n);
+		if (i == 1)
+			{ /* previous session */
+			s->hit=1;
+			}
+		else if (i == -1)
+			goto err;
+		else /* i == 0 */
+			{
+			if (!ssl_get_new_session(s,1))
+				goto err;
+			}
+		}
+
+	p+=j;
 
-		p += cookie_len;
+	if (SSL_IS_DTLS(s))
+		{
+		/* the cookie was verified above */
+		p += cookie_len + 1;
 		if (s->method->version == DTLS_ANY_VERSION)
 			{
 			/* Select version to use */
@@ -1470,11 +1522,10 @@ int ssl3_get_client_hello(SSL *s)
 		s->s3->tmp.new_cipher=s->session->cipher;
 		}
 
-	if (!SSL_USE_SIGALGS(s) || !(s->verify_mode & SSL_VERIFY_PEER))
-		{
-		if (!ssl3_digest_cached_records(s))
-			goto f_err;
-		}
+	/* Keep hashing the handshake in the digests a CertificateVerify from
+	 * the client may need */
+	if (!ssl3_select_handshake_dgst(s, tls12_cert_verify_hashes(s, 0)))
+		goto f_err;
 	
 	/* we now have the following setup. 
 	 * client_random
@@ -3184,10 +3235,8 @@ fprintf(stderr, "USING TLSv1.2 HASH %s\n", EVP_MD_name(md));
 
 	if (SSL_USE_SIGALGS(s))
 		{
-		long hdatalen = 0;
-		void *hdata;
-		hdatalen = BIO_get_mem_data(s->s3->handshake_buffer, &hdata);
-		if (hdatalen <= 0)
+		EVP_MD_CTX *hdgst = ssl3_get_handshake_dgst(s, EVP_MD_type(md));
+		if (hdgst == NULL)
 			{
 			SSLerr(SSL_F_SSL3_GET_CERT_VERIFY, ERR_R_INTERNAL_ERROR);
 			al=SSL_AD_INTERNAL_ERROR;
@@ -3197,8 +3246,7 @@ fprintf(stderr, "USING TLSv1.2 HASH %s\n", EVP_MD_name(md));
 		fprintf(stderr, "Using TLS 1.2 with client verify alg %s\n",
 							EVP_MD_name(md));
 #endif
-		if (!EVP_VerifyInit_ex(&mctx, md, NULL)
-			|| !EVP_VerifyUpdate(&mctx, hdata, hdatalen))
+		if (!EVP_MD_CTX_copy_ex(&mctx, hdgst))
 			{
 			SSLerr(SSL_F_SSL3_GET_CERT_VERIFY, ERR_R_EVP_LIB);
 			al=SSL_AD_INTERNAL_ERROR;
@@ -3303,12 +3351,8 @@ f_err:
 		ssl3_send_alert(s,SSL3_AL_FATAL,al);
 		}
 end:
-	if (s->s3->handshake_buffer)
-		{
-		BIO_free(s->s3->handshake_buffer);
-		s->s3->handshake_buffer = NULL;
-		s->s3->flags &= ~TLS1_FLAGS_KEEP_HANDSHAKE;
-		}
+	if (s->s3->handshake_sig_dgst != NULL)
+		ssl3_select_handshake_dgst(s, 0);
 	EVP_MD_CTX_cleanup(&mctx);
 	EVP_PKEY_free(pkey);
 	return(ret);
@@ -3422,8 +3466,8 @@ int ssl3_get_client_certificate(SSL *s)
 			al=SSL_AD_HANDSHAKE_FAILURE;
 			goto f_err;
 			}
-		/* No client certificate so digest cached records */
-		if (s->s3->handshake_buffer && !ssl3_digest_cached_records(s))
+		/* No client certificate so no CertificateVerify to hash */
+		if (!ssl3_select_handshake_dgst(s, 0))
 			{
 			al=SSL_AD_INTERNAL_ERROR;
 			goto f_err;
@@ -3530,7 +3574,7 @@ int ssl3_send_newsession_ticket(SSL *s)
 		{
 		unsigned char *p, *senc, *macstart;
 		const unsigned char *const_p;
-		int len, slen_full, slen;
+		int len, slen_full, slen, rv;
 		SSL_SESSION *sess;
 		unsigned int hlen;
 		EVP_CIPHER_CTX ctx;
@@ -3539,38 +3583,53 @@ int ssl3_send_newsession_ticket(SSL *s)
 		unsigned char iv[EVP_MAX_IV_LENGTH];
 		unsigned char key_name[16];
 
-		/* get session encoding length */
-		slen_full = i2d_SSL_SESSION(s->session, NULL);
-		/* Some length values are 16 bits, so forget it if session is
- 		 * too long
- 		 */
-		if (slen_full > 0xFF00)
-			return -1;
-		senc = OPENSSL_malloc(slen_full);
-		if (!senc)
-			return -1;
-		p = senc;
-		i2d_SSL_SESSION(s->session, &p);
-
-		/* create a fresh copy (not shared with other threads) to clean up */
-		const_p = senc;
-		sess = d2i_SSL_SESSION(NULL, &const_p, slen_full);
-		if (sess == NULL)
+		if (s->mode & SSL_MODE_COMPACT_SESSION_TICKET)
 			{
-			OPENSSL_free(senc);
-			return -1;
+			/* The ID is irrelevant for the ticket and left out
+			 * of the encoding, so no copy is needed */
+			slen = ssl_session_encode_compact(s->session, NULL, 0, 1);
+			if (slen <= 0 || slen > 0xFF00)
+				return -1;
+			senc = OPENSSL_malloc(slen);
+			if (!senc)
+				return -1;
+			ssl_session_encode_compact(s->session, senc, slen, 1);
 			}
-		sess->session_id_length = 0; /* ID is irrelevant for the ticket */
-
-		slen = i2d_SSL_SESSION(sess, NULL);
-		if (slen > slen_full) /* shouldn't ever happen */
+		else
 			{
-			OPENSSL_free(senc);
-			return -1;
+			/* get session encoding length */
+			slen_full = i2d_SSL_SESSION(s->session, NULL);
+			/* Some length values are 16 bits, so forget it if
+			 * session is too long
+			 */
+			if (slen_full > 0xFF00)
+				return -1;
+			senc = OPENSSL_malloc(slen_full);
+			if (!senc)
+				return -1;
+			p = senc;
+			i2d_SSL_SESSION(s->session, &p);
+
+			/* create a fresh copy (not shared with other threads) to clean up */
+			const_p = senc;
+			sess = d2i_SSL_SESSION(NULL, &const_p, slen_full);
+			if (sess == NULL)
+				{
+				OPENSSL_free(senc);
+				return -1;
+				}
+			sess->session_id_length = 0; /* ID is irrelevant for the ticket */
+
+			slen = i2d_SSL_SESSION(sess, NULL);
+			if (slen > slen_full) /* shouldn't ever happen */
+				{
+				OPENSSL_free(senc);
+				return -1;
+				}
+			p = senc;
+			i2d_SSL_SESSION(sess, &p);
+			SSL_SESSION_free(sess);
 			}
-		p = senc;
-		i2d_SSL_SESSION(sess, &p);
-		SSL_SESSION_free(sess);
 
 		/* Grow buffer if need be: the length calculation is as
  		 * follows handshake_header_length +
@@ -3599,6 +3658,15 @@ int ssl3_send_newsession_ticket(SSL *s)
 				return -1;
 				}
 			}
+		else if ((rv = tls1_ticket_key_ring_cb(tctx, key_name, iv,
+							&ctx, &hctx, 1)) != 0)
+			{
+			if (rv < 0)
+				{
+				OPENSSL_free(senc);
+				return -1;
+				}
+			}
 		else
 			{
 			RAND_pseudo_bytes(iv, 16);
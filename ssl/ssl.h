@@ -372,6 +372,26 @@ typedef struct ssl_cipher_st SSL_CIPHER;
 typedef struct ssl_session_st SSL_SESSION;
 typedef struct tls_sigalgs_st TLS_SIGALGS;
 typedef struct ssl_conf_ctx_st SSL_CONF_CTX;
+typedef struct ssl_shm_sess_cache_st SSL_SHM_SESS_CACHE;
+
+/* A buffer of the array passed to SSL_writev() */
+typedef struct ssl_iovec_st
+	{
+	const void *base;
+	size_t len;
+	} SSL_IOVEC;
+
+/* Counters of the record buffer pool of an SSL_CTX, filled in by
+ * SSL_CTX_get_buffer_pool_stats() */
+typedef struct ssl_buf_pool_stats_st
+	{
+	unsigned long hits;	/* buffers handed out from the pool */
+	unsigned long misses;	/* buffers allocated as none was pooled */
+	unsigned long drops;	/* buffers freed as the pool was full */
+	unsigned long buffers;	/* buffers retained in the pool */
+	size_t bytes;		/* bytes retained in the pool */
+	size_t bytes_in_use;	/* bytes held by connections */
+	} SSL_BUF_POOL_STATS;
 
 DECLARE_STACK_OF(SSL_CIPHER)
 
@@ -637,6 +657,10 @@ struct ssl_session_st
 	/* These are used to make removal of session-ids more
 	 * efficient and to implement a maximum cache size. */
 	struct ssl_session_st *prev,*next;
+	/* Position in the expiry heap of the internal cache, and the
+	 * SSL_CTX of that cache, while the session is held there. */
+	unsigned long cache_heap_idx;
+	SSL_CTX *cache_ctx;
 #ifndef OPENSSL_NO_TLSEXT
 	char *tlsext_hostname;
 #ifndef OPENSSL_NO_EC
@@ -756,7 +780,7 @@ struct ssl_session_st
 /* Don't attempt to automatically build certificate chain */
 #define SSL_MODE_NO_AUTO_CHAIN 0x00000008L
 /* Save RAM by releasing read and write buffers when they're empty. (SSL3 and
- * TLS only.)  "Released" buffers are put onto a free-list in the context
+ * TLS only.)  "Released" buffers are put into the buffer pool of the context
  * or just freed (depending on the context's setting for freelist_max_len). */
 #define SSL_MODE_RELEASE_BUFFERS 0x00000010L
 /* Send the current time in the Random fields of the ClientHello and
@@ -765,6 +789,23 @@ struct ssl_session_st
  */
 #define SSL_MODE_SEND_CLIENTHELLO_TIME 0x00000020L
 #define SSL_MODE_SEND_SERVERHELLO_TIME 0x00000040L
+/* Encode the session in tickets issued by a server with the compact encoding
+ * of SSL_SESSION_encode_compact() instead of ASN.1. Tickets in either
+ * encoding are accepted regardless of this mode. */
+#define SSL_MODE_COMPACT_SESSION_TICKET 0x00000080L
+/* Let SSL_read() return the application data of every complete record that
+ * is already buffered, up to the length asked for, rather than that of one
+ * record. Most useful together with read_ahead and a read buffer larger than
+ * one record. */
+#define SSL_MODE_READ_BATCH 0x00000100L
+/* Share the certificate settings of the SSL_CTX until a handshake or the
+ * application changes them, and free the state that only a handshake needs
+ * once it completes. Saves memory per idle connection. */
+#define SSL_MODE_RELEASE_HANDSHAKE_STATE 0x00000200L
+/* Seal and open several application data records per call to an AEAD
+ * cipher such as AES-GCM, where the cipher can do so. The stitched
+ * CBC-HMAC ciphers seal several records only in this mode too. */
+#define SSL_MODE_AEAD_MULTI_RECORD 0x00000400L
 
 /* Cert related flags */
 /* Many implementations ignore some aspects of the TLS standards such as
@@ -976,6 +1017,13 @@ struct ssl_ctx_st
 	unsigned long session_cache_size;
 	struct ssl_session_st *session_cache_head;
 	struct ssl_session_st *session_cache_tail;
+	/* If SSL_SESS_CACHE_SHARDED is set, the internal cache is kept in
+	 * these shards instead of |sessions| and the list above. */
+	struct ssl_sess_shard_st *session_shards;
+	/* Sessions of the internal cache ordered by expiry time */
+	struct ssl_sess_heap_st *session_heap;
+	/* Shared memory cache installed by SSL_CTX_set_shm_session_cache() */
+	struct ssl_shm_sess_cache_st *shm_sess_cache;
 
 	/* This can have one of 2 values, ored together,
 	 * SSL_SESS_CACHE_CLIENT,
@@ -1101,6 +1149,9 @@ struct ssl_ctx_st
 	 */
 	unsigned int max_send_fragment;
 
+	/* Size of the read buffer of new connections, 0 for one record */
+	size_t default_read_buf_len;
+
 #ifndef OPENSSL_NO_ENGINE
 	/* Engine to pass requests for client certs to
 	 */
@@ -1120,6 +1171,8 @@ struct ssl_ctx_st
 					unsigned char *name, unsigned char *iv,
 					EVP_CIPHER_CTX *ectx,
  					HMAC_CTX *hctx, int enc);
+	/* Ring of ticket keys, see SSL_CTX_add_ticket_key() */
+	struct tls_ticket_key_ring_st *tlsext_ticket_key_ring;
 
 	/* certificate status request info */
 	/* Callback for status request */
@@ -1141,11 +1194,16 @@ struct ssl_ctx_st
 #endif
 
 #ifndef OPENSSL_NO_BUF_FREELISTS
+	/* Most buffers of each size kept in |buf_pool| */
 #define SSL_MAX_BUF_FREELIST_LEN_DEFAULT 32
 	unsigned int freelist_max_len;
-	struct ssl3_buf_freelist_st *wbuf_freelist;
-	struct ssl3_buf_freelist_st *rbuf_freelist;
+	struct ssl_buf_pool_st *buf_pool;
 #endif
+	/* Record buffer allocator, see SSL_CTX_set_buffer_callbacks() */
+	void *(*buf_get_cb)(SSL_CTX *ctx, size_t len, void *arg);
+	void (*buf_release_cb)(SSL_CTX *ctx, void *buf, size_t len,
+			       void *arg);
+	void *buf_cb_arg;
 #ifndef OPENSSL_NO_SRP
 	SRP_CTX srp_ctx; /* ctx for SRP authentication */
 #endif
@@ -1190,6 +1248,11 @@ struct ssl_ctx_st
 			      void *arg);
 	void *alpn_select_cb_arg;
 
+	/* For a server, a callback run when a ClientHello arrives, before
+	 * anything else is done with it: see SSL_CTX_set_client_hello_cb() */
+	int (*client_hello_cb)(SSL *s, int *al, void *arg);
+	void *client_hello_cb_arg;
+
 	/* For a client, this contains the list of supported protocols in wire
 	 * format. */
 	unsigned char* alpn_client_proto_list;
@@ -1233,6 +1296,15 @@ struct ssl_ctx_st
 #define SSL_SESS_CACHE_NO_INTERNAL_STORE	0x0200
 #define SSL_SESS_CACHE_NO_INTERNAL \
 	(SSL_SESS_CACHE_NO_INTERNAL_LOOKUP|SSL_SESS_CACHE_NO_INTERNAL_STORE)
+/* Split the internal cache into independently locked shards selected by
+ * session ID. Changing this flag empties the cache. */
+#define SSL_SESS_CACHE_SHARDED			0x0400
+
+/* Format version, and first byte, of SSL_SESSION_encode_compact() output */
+#define SSL_SESSION_COMPACT_VERSION		1
+
+/* Largest encoded session a shared memory cache slot holds by default */
+#define SSL_SHM_SESS_CACHE_DEFAULT_SESS_LEN	2048
 
 LHASH_OF(SSL_SESSION) *SSL_CTX_sessions(SSL_CTX *ctx);
 #define SSL_CTX_sess_number(ctx) \
@@ -1316,6 +1388,19 @@ void SSL_CTX_set_alpn_select_cb(SSL_CTX* ctx,
 void SSL_get0_alpn_selected(const SSL *ssl, const unsigned char **data,
 			    unsigned *len);
 
+#ifndef OPENSSL_NO_TLSEXT
+/* Return values of the ClientHello callback */
+#define SSL_CLIENT_HELLO_SUCCESS	1
+#define SSL_CLIENT_HELLO_ERROR		0
+#define SSL_CLIENT_HELLO_RETRY		(-1)
+
+void SSL_CTX_set_client_hello_cb(SSL_CTX *ctx,
+				 int (*cb) (SSL *s, int *al, void *arg),
+				 void *arg);
+int SSL_client_hello_get0_ext(SSL *s, unsigned int type,
+			      const unsigned char **out, size_t *outlen);
+#endif
+
 #ifndef OPENSSL_NO_PSK
 /* the maximum length of the buffer given to callbacks containing the
  * resulting identity/psk */
@@ -1396,12 +1481,14 @@ int SSL_CTX_set_cli_supp_data(SSL_CTX *ctx,
 #define SSL_WRITING	2
 #define SSL_READING	3
 #define SSL_X509_LOOKUP	4
+#define SSL_CLIENT_HELLO_CB	5
 
 /* These will only be used when doing non-blocking IO */
 #define SSL_want_nothing(s)	(SSL_want(s) == SSL_NOTHING)
 #define SSL_want_read(s)	(SSL_want(s) == SSL_READING)
 #define SSL_want_write(s)	(SSL_want(s) == SSL_WRITING)
 #define SSL_want_x509_lookup(s)	(SSL_want(s) == SSL_X509_LOOKUP)
+#define SSL_want_client_hello_cb(s)	(SSL_want(s) == SSL_CLIENT_HELLO_CB)
 
 #define SSL_MAC_FLAG_READ_MAC_STREAM 1
 #define SSL_MAC_FLAG_WRITE_MAC_STREAM 2
@@ -1519,6 +1606,10 @@ struct ssl_st
 	/* client cert? */
 	/* This is used to hold the server certificate used */
 	struct cert_st /* CERT */ *cert;
+	/* Set while |cert| is the CERT of |ctx|, and while it is a copy that
+	 * was made for a handshake only; see ssl_cert_unshare() */
+	int cert_shared;
+	int cert_handshake_copy;
 
 	/* the session_id_context is used to ensure sessions are only reused
 	 * in the appropriate context */
@@ -1573,6 +1664,8 @@ struct ssl_st
 	int client_version;	/* what was passed, used for
 				 * SSLv3/TLS rollback check */
 	unsigned int max_send_fragment;
+	/* Size of the read buffer, 0 for one record */
+	size_t default_read_buf_len;
 #ifndef OPENSSL_NO_TLSEXT
 	/* TLS extension debug callback */
 	void (*tlsext_debug_cb)(SSL *s, int client_server, int type,
@@ -1824,6 +1917,7 @@ DECLARE_PEM_rw(SSL_SESSION, SSL_SESSION)
 #define SSL_ERROR_ZERO_RETURN		6
 #define SSL_ERROR_WANT_CONNECT		7
 #define SSL_ERROR_WANT_ACCEPT		8
+#define SSL_ERROR_WANT_CLIENT_HELLO_CB	9
 
 #define SSL_CTRL_NEED_TMP_RSA			1
 #define SSL_CTRL_SET_TMP_RSA			2
@@ -1958,6 +2052,7 @@ DECLARE_PEM_rw(SSL_SESSION, SSL_SESSION)
 #define SSL_CERT_SET_SERVER			3
 
 #define SSL_CTRL_SET_DH_AUTO			118
+#define SSL_CTRL_SET_READ_BUFFER_LEN		119
 
 #define DTLSv1_get_timeout(ssl, arg) \
 	SSL_ctrl(ssl,DTLS_CTRL_GET_TIMEOUT,0, (void *)arg)
@@ -2130,6 +2225,7 @@ void BIO_ssl_shutdown(BIO *ssl_bio);
 #endif
 
 int	SSL_CTX_set_cipher_list(SSL_CTX *,const char *str);
+void	SSL_flush_cipher_list_cache(void);
 SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth);
 void	SSL_CTX_free(SSL_CTX *);
 long SSL_CTX_set_timeout(SSL_CTX *ctx,long t);
@@ -2247,6 +2343,23 @@ int	SSL_has_matching_session_id(const SSL *ssl, const unsigned char *id,
 					unsigned int id_len);
 SSL_SESSION *d2i_SSL_SESSION(SSL_SESSION **a,const unsigned char **pp,
 			     long length);
+int	SSL_SESSION_encode_compact(const SSL_SESSION *in, unsigned char *out,
+				   unsigned int outlen);
+SSL_SESSION *SSL_SESSION_decode_compact(SSL_SESSION **a,
+					const unsigned char *in, long len);
+SSL_SHM_SESS_CACHE *SSL_SHM_SESS_CACHE_new(const char *file,
+					    unsigned long num_sessions,
+					    unsigned long max_sess_len);
+void	SSL_SHM_SESS_CACHE_free(SSL_SHM_SESS_CACHE *c);
+int	SSL_CTX_set_shm_session_cache(SSL_CTX *ctx, SSL_SHM_SESS_CACHE *c);
+
+void	SSL_CTX_set_buffer_callbacks(SSL_CTX *ctx,
+		void *(*get_cb)(SSL_CTX *ctx, size_t len, void *arg),
+		void (*release_cb)(SSL_CTX *ctx, void *buf, size_t len,
+				   void *arg),
+		void *arg);
+int	SSL_CTX_get_buffer_pool_stats(SSL_CTX *ctx, SSL_BUF_POOL_STATS *stats);
+void	SSL_CTX_flush_buffer_pool(SSL_CTX *ctx);
 
 #ifdef HEADER_X509_H
 X509 *	SSL_get_peer_certificate(const SSL *s);
@@ -2327,6 +2440,7 @@ int 	SSL_connect(SSL *ssl);
 int 	SSL_read(SSL *ssl,void *buf,int num);
 int 	SSL_peek(SSL *ssl,void *buf,int num);
 int 	SSL_write(SSL *ssl,const void *buf,int num);
+int 	SSL_writev(SSL *ssl,const SSL_IOVEC *iov,int iovcnt);
 long	SSL_ctrl(SSL *ssl,int cmd, long larg, void *parg);
 long	SSL_callback_ctrl(SSL *, int, void (*)(void));
 long	SSL_CTX_ctrl(SSL_CTX *ctx,int cmd, long larg, void *parg);
@@ -2488,6 +2602,10 @@ int SSL_get_ex_data_X509_STORE_CTX_idx(void );
 	SSL_CTX_ctrl(ctx,SSL_CTRL_SET_MAX_SEND_FRAGMENT,m,NULL)
 #define SSL_set_max_send_fragment(ssl,m) \
 	SSL_ctrl(ssl,SSL_CTRL_SET_MAX_SEND_FRAGMENT,m,NULL)
+#define SSL_CTX_set_default_read_buffer_len(ctx,len) \
+	SSL_CTX_ctrl(ctx,SSL_CTRL_SET_READ_BUFFER_LEN,len,NULL)
+#define SSL_set_default_read_buffer_len(ssl,len) \
+	SSL_ctrl(ssl,SSL_CTRL_SET_READ_BUFFER_LEN,len,NULL)
 
      /* NB: the keylength is only applicable when is_export is true */
 #ifndef OPENSSL_NO_RSA
@@ -2737,6 +2855,7 @@ void ERR_load_SSL_strings(void);
 #define SSL_F_SSL3_DIGEST_CACHED_RECORDS		 293
 #define SSL_F_SSL3_DO_CHANGE_CIPHER_SPEC		 292
 #define SSL_F_SSL3_ENC					 134
+#define SSL_F_SSL3_FREEZE_HANDSHAKE_DGST		 353
 #define SSL_F_SSL3_GENERATE_KEY_BLOCK			 238
 #define SSL_F_SSL3_GET_CERTIFICATE_REQUEST		 135
 #define SSL_F_SSL3_GET_CERT_STATUS			 289
@@ -2754,11 +2873,13 @@ void ERR_load_SSL_strings(void);
 #define SSL_F_SSL3_GET_SERVER_DONE			 145
 #define SSL_F_SSL3_GET_SERVER_HELLO			 146
 #define SSL_F_SSL3_HANDSHAKE_MAC			 285
+#define SSL_F_SSL3_INIT_FINISHED_MAC			 354
 #define SSL_F_SSL3_NEW_SESSION_TICKET			 287
 #define SSL_F_SSL3_OUTPUT_CERT_CHAIN			 147
 #define SSL_F_SSL3_PEEK					 235
 #define SSL_F_SSL3_READ_BYTES				 148
 #define SSL_F_SSL3_READ_N				 149
+#define SSL_F_SSL3_SELECT_HANDSHAKE_DGST		 352
 #define SSL_F_SSL3_SEND_CERTIFICATE_REQUEST		 150
 #define SSL_F_SSL3_SEND_CLIENT_CERTIFICATE		 151
 #define SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE		 152
@@ -2769,6 +2890,7 @@ void ERR_load_SSL_strings(void);
 #define SSL_F_SSL3_SETUP_KEY_BLOCK			 157
 #define SSL_F_SSL3_SETUP_READ_BUFFER			 156
 #define SSL_F_SSL3_SETUP_WRITE_BUFFER			 291
+#define SSL_F_SSL3_WRITEV_BYTES				 350
 #define SSL_F_SSL3_WRITE_BYTES				 158
 #define SSL_F_SSL3_WRITE_PENDING			 159
 #define SSL_F_SSL_ADD_CERT_CHAIN			 316
@@ -2790,6 +2912,7 @@ void ERR_load_SSL_strings(void);
 #define SSL_F_SSL_CERT_INSTANTIATE			 214
 #define SSL_F_SSL_CERT_NEW				 162
 #define SSL_F_SSL_CERT_SET0_CHAIN			 340
+#define SSL_F_SSL_CERT_UNSHARE				 351
 #define SSL_F_SSL_CHECK_PRIVATE_KEY			 163
 #define SSL_F_SSL_CHECK_SERVERHELLO_TLSEXT		 280
 #define SSL_F_SSL_CHECK_SRVR_ECC_CERT_AND_ALG		 279
@@ -2800,14 +2923,18 @@ void ERR_load_SSL_strings(void);
 #define SSL_F_SSL_CONF_CMD				 334
 #define SSL_F_SSL_CREATE_CIPHER_LIST			 166
 #define SSL_F_SSL_CTRL					 232
+#define SSL_F_SSL_CTX_ADD_TICKET_KEY			 346
 #define SSL_F_SSL_CTX_CHECK_PRIVATE_KEY			 168
 #define SSL_F_SSL_CTX_MAKE_PROFILES			 309
 #define SSL_F_SSL_CTX_NEW				 169
+#define SSL_F_SSL_CTX_REMOVE_TICKET_KEY			 347
 #define SSL_F_SSL_CTX_SET_CIPHER_LIST			 269
 #define SSL_F_SSL_CTX_SET_CLIENT_CERT_ENGINE		 290
 #define SSL_F_SSL_CTX_SET_PURPOSE			 226
 #define SSL_F_SSL_CTX_SET_SESSION_ID_CONTEXT		 219
+#define SSL_F_SSL_CTX_SET_SHM_SESSION_CACHE		 342
 #define SSL_F_SSL_CTX_SET_SSL_VERSION			 170
+#define SSL_F_SSL_CTX_SET_TICKET_ENCRYPT_KEY		 348
 #define SSL_F_SSL_CTX_SET_TRUST				 229
 #define SSL_F_SSL_CTX_USE_AUTHZ				 324
 #define SSL_F_SSL_CTX_USE_CERTIFICATE			 171
@@ -2847,6 +2974,9 @@ void ERR_load_SSL_strings(void);
 #define SSL_F_SSL_RSA_PUBLIC_ENCRYPT			 188
 #define SSL_F_SSL_SCAN_CLIENTHELLO_TLSEXT		 320
 #define SSL_F_SSL_SCAN_SERVERHELLO_TLSEXT		 321
+#define SSL_F_SSL_SESSION_CACHE_SET_SHARDED		 341
+#define SSL_F_SSL_SESSION_DECODE_COMPACT		 345
+#define SSL_F_SSL_SESSION_ENCODE_COMPACT		 344
 #define SSL_F_SSL_SESSION_NEW				 189
 #define SSL_F_SSL_SESSION_PRINT_FP			 190
 #define SSL_F_SSL_SESSION_SET1_ID_CONTEXT		 312
@@ -2863,6 +2993,7 @@ void ERR_load_SSL_strings(void);
 #define SSL_F_SSL_SET_SESSION_TICKET_EXT		 294
 #define SSL_F_SSL_SET_TRUST				 228
 #define SSL_F_SSL_SET_WFD				 196
+#define SSL_F_SSL_SHM_SESS_CACHE_NEW			 343
 #define SSL_F_SSL_SHUTDOWN				 224
 #define SSL_F_SSL_SRP_CTX_INIT				 313
 #define SSL_F_SSL_UNDEFINED_CONST_FUNCTION		 243
@@ -2881,6 +3012,7 @@ void ERR_load_SSL_strings(void);
 #define SSL_F_SSL_USE_RSAPRIVATEKEY_FILE		 206
 #define SSL_F_SSL_VERIFY_CERT_CHAIN			 207
 #define SSL_F_SSL_WRITE					 208
+#define SSL_F_SSL_WRITEV				 349
 #define SSL_F_TLS12_CHECK_PEER_SIGALG			 333
 #define SSL_F_TLS1_CERT_VERIFY_MAC			 286
 #define SSL_F_TLS1_CHANGE_CIPHER_STATE			 209
@@ -2932,6 +3064,7 @@ void ERR_load_SSL_strings(void);
 #define SSL_R_BAD_RSA_E_LENGTH				 120
 #define SSL_R_BAD_RSA_MODULUS_LENGTH			 121
 #define SSL_R_BAD_RSA_SIGNATURE				 122
+#define SSL_R_BAD_SHM_SESS_CACHE_FILE			 400
 #define SSL_R_BAD_SIGNATURE				 123
 #define SSL_R_BAD_SRP_A_LENGTH				 347
 #define SSL_R_BAD_SRP_B_LENGTH				 348
@@ -2945,6 +3078,7 @@ void ERR_load_SSL_strings(void);
 #define SSL_R_BAD_STATE					 126
 #define SSL_R_BAD_VALUE					 384
 #define SSL_R_BAD_WRITE_RETRY				 127
+#define SSL_R_BATCHED_RECORD_FAILED			 405
 #define SSL_R_BIO_NOT_SET				 128
 #define SSL_R_BLOCK_CIPHER_PAD_IS_WRONG			 129
 #define SSL_R_BN_LIB					 130
@@ -2961,6 +3095,7 @@ void ERR_load_SSL_strings(void);
 #define SSL_R_CIPHER_OR_HASH_UNAVAILABLE		 138
 #define SSL_R_CIPHER_TABLE_SRC_ERROR			 139
 #define SSL_R_CLIENTHELLO_TLSEXT			 226
+#define SSL_R_CLIENT_HELLO_CB_ERROR			 403
 #define SSL_R_COMPRESSED_LENGTH_TOO_LONG		 140
 #define SSL_R_COMPRESSION_DISABLED			 343
 #define SSL_R_COMPRESSION_FAILURE			 141
@@ -3117,7 +3252,9 @@ void ERR_load_SSL_strings(void);
 #define SSL_R_REUSE_CIPHER_LIST_NOT_ZERO		 218
 #define SSL_R_SCSV_RECEIVED_WHEN_RENEGOTIATING		 345
 #define SSL_R_SERVERHELLO_TLSEXT			 275
+#define SSL_R_SESSION_CALLBACKS_ALREADY_SET		 404
 #define SSL_R_SESSION_ID_CONTEXT_UNINITIALIZED		 277
+#define SSL_R_SHM_SESS_CACHE_NOT_SUPPORTED		 401
 #define SSL_R_SHORT_READ				 219
 #define SSL_R_SIGNATURE_ALGORITHMS_ERROR		 360
 #define SSL_R_SIGNATURE_FOR_NON_SIGNING_CERTIFICATE	 220
@@ -3151,6 +3288,7 @@ void ERR_load_SSL_strings(void);
 #define SSL_R_SSL_SESSION_ID_CONTEXT_TOO_LONG		 273
 #define SSL_R_SSL_SESSION_ID_HAS_BAD_LENGTH		 303
 #define SSL_R_SSL_SESSION_ID_IS_DIFFERENT		 231
+#define SSL_R_TICKET_KEY_NOT_FOUND			 402
 #define SSL_R_TLSV1_ALERT_ACCESS_DENIED			 1049
 #define SSL_R_TLSV1_ALERT_DECODE_ERROR			 1050
 #define SSL_R_TLSV1_ALERT_DECRYPTION_FAILED		 1021
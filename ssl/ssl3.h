@@ -472,6 +472,22 @@ typedef struct ssl3_state_st
 	SSL3_RECORD rrec;	/* each decoded record goes in here */
 	SSL3_RECORD wrec;	/* goes out from here */
 
+	/* Number of records following rrec in rbuf that were already
+	 * decrypted in place by a multi-record cipher, and whether the
+	 * record after those failed to verify */
+	unsigned int rrec_ready;
+	int rrec_bad;
+	/* Lengths of the explicit IV and tag of those records, as told by
+	 * the cipher */
+	unsigned int rrec_eiv_len;
+	unsigned int rrec_tag_len;
+
+	/* Set while SSL_MODE_READ_BATCH takes further buffered records, and
+	 * the SSL_R_ reason of a failure of one of them, which fails the
+	 * next read once the data taken before it has been returned */
+	int read_batch;
+	int read_batch_error;
+
 	/* storage for Alert/Handshake protocol data received but not
 	 * yet processed by ssl3_read_bytes: */
 	unsigned char alert_fragment[2];
@@ -486,12 +502,13 @@ typedef struct ssl3_state_st
 	int wpend_ret;		/* number of bytes submitted */
 	const unsigned char *wpend_buf;
 
-	/* used during startup, digest all incoming/outgoing packets */
-	BIO *handshake_buffer;
-	/* When set of handshake digests is determined, buffer is hashed
-	 * and freed and MD_CTX-es for all required digests are stored in
-	 * this array */
+	/* Running hashes of all incoming/outgoing handshake messages, in
+	 * every digest the handshake may still need: see
+	 * ssl3_init_finished_mac() */
 	EVP_MD_CTX **handshake_dgst;
+	/* Hashes of the handshake messages up to a CertificateVerify that
+	 * is yet to be received, see ssl3_freeze_handshake_dgst() */
+	EVP_MD_CTX **handshake_sig_dgst;
 	/* this is set whenerver we see a change_cipher_spec message
 	 * come in when we are not looking for one */
 	int change_cipher_spec;
@@ -600,6 +617,12 @@ typedef struct ssl3_state_st
 	unsigned char *alpn_selected;
 	unsigned alpn_selected_len;
 
+	/* In a server with a ClientHello callback, the extensions of the
+	 * ClientHello being processed: see tls1_index_clienthello_tlsext(). */
+	struct tls1_ext_index_st *client_exts;
+	size_t client_exts_num;
+	size_t client_exts_max;
+
 #ifndef OPENSSL_NO_EC
 	/* This is set to true if we believe that this is a version of Safari
 	 * running on OS X 10.6 or newer. We wish to know this because Safari
@@ -0,0 +1,416 @@
+/* ssl/ssl_bin.c */
+/* ====================================================================
+ * Copyright (c) 2014 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+
+
+/* A compact, fixed layout encoding of SSL_SESSION as an alternative to the
+ * ASN.1 one of ssl_asn1.c. Encoding writes into a caller supplied buffer and
+ * decoding reads the fixed fields in place, so neither allocates unless the
+ * session carries variable length data such as a peer certificate.
+ *
+ * Layout, integers in network byte order:
+ *
+ *   0   format version (SSL_SESSION_COMPACT_VERSION)
+ *   1   master key length
+ *   2   ssl_version (2)
+ *   4   cipher ID (4)
+ *   8   compression method
+ *   9   session ID length
+ *  10   session ID context length
+ *  11   key arg length
+ *  12   time, timeout, verify result, ticket lifetime hint (8 each)
+ *  44   master key, session ID, session ID context, key arg, each
+ *       padded to its maximum length
+ * 164   lengths of the variable fields: Kerberos principal, hostname,
+ *       PSK identity hint, PSK identity, SRP username and ticket (2 each)
+ *       and peer certificate (3)
+ * 179   variable fields in the same order, the certificate DER encoded
+ *
+ * The first byte can never be that of a DER SEQUENCE, so both encodings
+ * may be told apart by it. */
+
+#include <stdio.h>
+#include <limits.h>
+#include "ssl_locl.h"
+#include <openssl/x509.h>
+
+#define COMPACT_VAR_OFF		164
+#define COMPACT_FIXED_LEN	(COMPACT_VAR_OFF + 6 * 2 + 3)
+#define COMPACT_NUM_STR		6
+
+static unsigned char *compact_put_long(unsigned char *p, long v)
+	{
+	unsigned long hi = v < 0 ? 0xffffffffUL : 0, lo;
+
+#if LONG_MAX > 0x7fffffffL
+	hi = ((unsigned long)v >> 16 >> 16) & 0xffffffffUL;
+#endif
+	lo = (unsigned long)v & 0xffffffffUL;
+	l2n(hi, p);
+	l2n(lo, p);
+	return p;
+	}
+
+static int compact_get_long(const unsigned char **pp, long *v)
+	{
+	const unsigned char *p = *pp;
+	unsigned long hi, lo;
+
+	n2l(p, hi);
+	n2l(p, lo);
+	*pp = p;
+#if LONG_MAX > 0x7fffffffL
+	*v = (long)((hi << 16 << 16) | lo);
+	return 1;
+#else
+	/* The value must fit a 32 bit long */
+	if (hi != ((lo & 0x80000000UL) ? 0xffffffffUL : 0))
+		return 0;
+	*v = (long)lo;
+	return 1;
+#endif
+	}
+
+static unsigned char *compact_put_bytes(unsigned char *p,
+					const unsigned char *d,
+					unsigned int len, unsigned int max)
+	{
+	memcpy(p, d, len);
+	memset(p + len, 0, max - len);
+	return p + max;
+	}
+
+/* Copies a string field, reusing the old buffer when it is long enough */
+static int compact_get_str(char **dst, const unsigned char *d,
+			   unsigned int len)
+	{
+	if (len == 0)
+		{
+		if (*dst != NULL)
+			OPENSSL_free(*dst);
+		*dst = NULL;
+		return 1;
+		}
+	if (*dst == NULL || strlen(*dst) < len)
+		{
+		if (*dst != NULL)
+			OPENSSL_free(*dst);
+		if ((*dst = OPENSSL_malloc(len + 1)) == NULL)
+			return 0;
+		}
+	memcpy(*dst, d, len);
+	(*dst)[len] = '\0';
+	return 1;
+	}
+
+int ssl_session_encode_compact(const SSL_SESSION *in, unsigned char *out,
+			       unsigned int outlen, int no_id)
+	{
+	const unsigned char *str[COMPACT_NUM_STR];
+	unsigned int str_len[COMPACT_NUM_STR], id_len, peer_len = 0, len, i;
+	unsigned long l;
+	unsigned char *p;
+	int n;
+
+	if (in == NULL || (in->cipher == NULL && in->cipher_id == 0))
+		return 0;
+
+	for (i = 0; i < COMPACT_NUM_STR; i++)
+		{
+		str[i] = NULL;
+		str_len[i] = 0;
+		}
+#ifndef OPENSSL_NO_KRB5
+	str[0] = in->krb5_client_princ;
+	str_len[0] = in->krb5_client_princ_len;
+#endif
+#ifndef OPENSSL_NO_TLSEXT
+	if (in->tlsext_hostname)
+		{
+		str[1] = (unsigned char *)in->tlsext_hostname;
+		str_len[1] = strlen(in->tlsext_hostname);
+		}
+	if (in->tlsext_tick)
+		{
+		str[5] = in->tlsext_tick;
+		str_len[5] = in->tlsext_ticklen;
+		}
+#endif
+#ifndef OPENSSL_NO_PSK
+	if (in->psk_identity_hint)
+		{
+		str[2] = (unsigned char *)in->psk_identity_hint;
+		str_len[2] = strlen(in->psk_identity_hint);
+		}
+	if (in->psk_identity)
+		{
+		str[3] = (unsigned char *)in->psk_identity;
+		str_len[3] = strlen(in->psk_identity);
+		}
+#endif
+#ifndef OPENSSL_NO_SRP
+	if (in->srp_username)
+		{
+		str[4] = (unsigned char *)in->srp_username;
+		str_len[4] = strlen(in->srp_username);
+		}
+#endif
+	if (in->peer != NULL)
+		{
+		n = i2d_X509(in->peer, NULL);
+		if (n <= 0 || n > 0xffffff)
+			return 0;
+		peer_len = n;
+		}
+
+	len = COMPACT_FIXED_LEN + peer_len;
+	for (i = 0; i < COMPACT_NUM_STR; i++)
+		{
+		if (str_len[i] > 0xffff)
+			return 0;
+		len += str_len[i];
+		}
+	if (out == NULL)
+		return len;
+	if (outlen < len)
+		{
+		SSLerr(SSL_F_SSL_SESSION_ENCODE_COMPACT, SSL_R_BAD_LENGTH);
+		return 0;
+		}
+
+	id_len = no_id ? 0 : in->session_id_length;
+	p = out;
+	*(p++) = SSL_SESSION_COMPACT_VERSION;
+	*(p++) = (unsigned char)in->master_key_length;
+	s2n(in->ssl_version, p);
+	l = in->cipher == NULL ? in->cipher_id : in->cipher->id;
+	l2n(l, p);
+	*(p++) = (unsigned char)in->compress_meth;
+	*(p++) = (unsigned char)id_len;
+	*(p++) = (unsigned char)in->sid_ctx_length;
+	*(p++) = (unsigned char)in->key_arg_length;
+	p = compact_put_long(p, in->time);
+	p = compact_put_long(p, in->timeout);
+	p = compact_put_long(p, in->verify_result);
+#ifndef OPENSSL_NO_TLSEXT
+	p = compact_put_long(p, in->tlsext_tick_lifetime_hint);
+#else
+	p = compact_put_long(p, 0);
+#endif
+	p = compact_put_bytes(p, in->master_key, in->master_key_length,
+			      SSL_MAX_MASTER_KEY_LENGTH);
+	p = compact_put_bytes(p, in->session_id, id_len,
+			      SSL_MAX_SSL_SESSION_ID_LENGTH);
+	p = compact_put_bytes(p, in->sid_ctx, in->sid_ctx_length,
+			      SSL_MAX_SID_CTX_LENGTH);
+	p = compact_put_bytes(p, in->key_arg, in->key_arg_length,
+			      SSL_MAX_KEY_ARG_LENGTH);
+	OPENSSL_assert(p == out + COMPACT_VAR_OFF);
+	for (i = 0; i < COMPACT_NUM_STR; i++)
+		s2n(str_len[i], p);
+	l2n3(peer_len, p);
+	for (i = 0; i < COMPACT_NUM_STR; i++)
+		{
+		if (str_len[i] != 0)
+			memcpy(p, str[i], str_len[i]);
+		p += str_len[i];
+		}
+	if (peer_len != 0)
+		i2d_X509(in->peer, &p);
+	return p - out;
+	}
+
+int SSL_SESSION_encode_compact(const SSL_SESSION *in, unsigned char *out,
+			       unsigned int outlen)
+	{
+	return ssl_session_encode_compact(in, out, outlen, 0);
+	}
+
+SSL_SESSION *SSL_SESSION_decode_compact(SSL_SESSION **a,
+					const unsigned char *in, long len)
+	{
+	const unsigned char *p = in, *fix, *d;
+	unsigned int str_len[COMPACT_NUM_STR], mk_len, id_len, ctx_len, arg_len;
+	unsigned int i;
+	unsigned long l, peer_len, total = COMPACT_FIXED_LEN;
+	long lifetime;
+	SSL_SESSION *ret = NULL;
+	int ssl_version;
+
+	if (len < COMPACT_FIXED_LEN || in[0] != SSL_SESSION_COMPACT_VERSION)
+		goto bad;
+	p++;
+	mk_len = *(p++);
+	n2s(p, ssl_version);
+	n2l(p, l);
+	if ((ssl_version >> 8) < SSL3_VERSION_MAJOR &&
+	    ssl_version != SSL2_VERSION)
+		{
+		SSLerr(SSL_F_SSL_SESSION_DECODE_COMPACT,
+		       SSL_R_UNKNOWN_SSL_VERSION);
+		return NULL;
+		}
+	fix = p;
+	p += 4;
+	id_len = fix[1];
+	ctx_len = fix[2];
+	arg_len = fix[3];
+	if (mk_len > SSL_MAX_MASTER_KEY_LENGTH ||
+	    id_len > SSL_MAX_SSL_SESSION_ID_LENGTH ||
+	    ctx_len > SSL_MAX_SID_CTX_LENGTH ||
+	    arg_len > SSL_MAX_KEY_ARG_LENGTH)
+		goto bad;
+
+	d = in + COMPACT_VAR_OFF;
+	for (i = 0; i < COMPACT_NUM_STR; i++)
+		{
+		n2s(d, str_len[i]);
+		total += str_len[i];
+		}
+	n2l3(d, peer_len);
+	total += peer_len;
+	if ((unsigned long)len < total)
+		goto bad;
+#ifndef OPENSSL_NO_KRB5
+	if (str_len[0] > SSL_MAX_KRB5_PRINCIPAL_LENGTH)
+		goto bad;
+#endif
+
+	if (a != NULL && *a != NULL)
+		ret = *a;
+	else if ((ret = SSL_SESSION_new()) == NULL)
+		return NULL;
+
+	ret->ssl_version = ssl_version;
+	ret->cipher = NULL;
+	ret->cipher_id = l;
+	ret->compress_meth = fix[0];
+	if (!compact_get_long(&p, &ret->time) ||
+	    !compact_get_long(&p, &ret->timeout) ||
+	    !compact_get_long(&p, &ret->verify_result) ||
+	    !compact_get_long(&p, &lifetime))
+		goto bad;
+	ret->master_key_length = mk_len;
+	memcpy(ret->master_key, p, mk_len);
+	p += SSL_MAX_MASTER_KEY_LENGTH;
+	ret->session_id_length = id_len;
+	memcpy(ret->session_id, p, id_len);
+	p += SSL_MAX_SSL_SESSION_ID_LENGTH;
+	ret->sid_ctx_length = ctx_len;
+	memcpy(ret->sid_ctx, p, ctx_len);
+	p += SSL_MAX_SID_CTX_LENGTH;
+	ret->key_arg_length = arg_len;
+	memcpy(ret->key_arg, p, arg_len);
+
+	/* d now points at the variable fields */
+#ifndef OPENSSL_NO_KRB5
+	ret->krb5_client_princ_len = str_len[0];
+	memcpy(ret->krb5_client_princ, d, str_len[0]);
+#endif
+	d += str_len[0];
+#ifndef OPENSSL_NO_TLSEXT
+	if (!compact_get_str(&ret->tlsext_hostname, d, str_len[1]))
+		goto err;
+	ret->tlsext_tick_lifetime_hint = lifetime;
+#endif
+	d += str_len[1];
+#ifndef OPENSSL_NO_PSK
+	if (!compact_get_str(&ret->psk_identity_hint, d, str_len[2]) ||
+	    !compact_get_str(&ret->psk_identity, d + str_len[2], str_len[3]))
+		goto err;
+#endif
+	d += str_len[2] + str_len[3];
+#ifndef OPENSSL_NO_SRP
+	if (!compact_get_str(&ret->srp_username, d, str_len[4]))
+		goto err;
+#endif
+	d += str_len[4];
+#ifndef OPENSSL_NO_TLSEXT
+	if (ret->tlsext_tick != NULL && ret->tlsext_ticklen != str_len[5])
+		{
+		OPENSSL_free(ret->tlsext_tick);
+		ret->tlsext_tick = NULL;
+		}
+	if (str_len[5] != 0 && ret->tlsext_tick == NULL &&
+	    (ret->tlsext_tick = OPENSSL_malloc(str_len[5])) == NULL)
+		goto err;
+	if (str_len[5] != 0)
+		memcpy(ret->tlsext_tick, d, str_len[5]);
+	ret->tlsext_ticklen = str_len[5];
+#endif
+	d += str_len[5];
+
+	if (ret->peer != NULL)
+		{
+		X509_free(ret->peer);
+		ret->peer = NULL;
+		}
+	if (peer_len != 0)
+		{
+		ret->peer = d2i_X509(NULL, &d, peer_len);
+		if (ret->peer == NULL)
+			goto bad;
+		}
+
+	if (a != NULL)
+		*a = ret;
+	return ret;
+ bad:
+	SSLerr(SSL_F_SSL_SESSION_DECODE_COMPACT, SSL_R_BAD_DATA);
+ err:
+	if (ret != NULL && (a == NULL || *a != ret))
+		SSL_SESSION_free(ret);
+	return NULL;
+	}
@@ -0,0 +1,336 @@
+/* ssl/ssl_buf.c */
+/* ====================================================================
+ * Copyright (c) 2014 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+/* The pool of record buffers of an SSL_CTX. Connections take their read
+ * and write buffers from it and, with SSL_MODE_RELEASE_BUFFERS, give them
+ * back whenever they go idle, so the pool sees a lot of traffic from every
+ * thread serving connections of the context.
+ *
+ * To keep threads from contending for one lock the pool is split into
+ * shards, each with its own lock, and every thread uses the shard chosen
+ * by a hash of its thread id. A buffer goes back to the shard of the thread
+ * that releases it, which need not be the one it came from.
+ *
+ * Within a shard, buffers are kept by size: the read and write buffers of
+ * TLS and DTLS, with or without compression, extra room, empty fragments or
+ * a smaller max_send_fragment all differ in size. Each shard has a few
+ * size classes, and a class whose list runs empty is free for another
+ * size. Buffers of sizes that find no class are simply freed.
+ *
+ * A connection always uses the pool, or the callbacks, of the SSL_CTX it
+ * was created with (s->initial_ctx): SSL_set_SSL_CTX() may switch s->ctx
+ * while buffers are out, and they must go back where they came from. */
+
+#include <stdio.h>
+#include "ssl_locl.h"
+
+#ifndef OPENSSL_NO_BUF_FREELISTS
+
+#define SSL_BUF_POOL_CLASSES	8
+
+typedef struct ssl_buf_pool_entry_st
+	{
+	struct ssl_buf_pool_entry_st *next;
+	} SSL_BUF_POOL_ENTRY;
+
+typedef struct ssl_buf_pool_class_st
+	{
+	size_t chunklen;	/* 0 if the class is unused */
+	unsigned int len;
+	SSL_BUF_POOL_ENTRY *head;
+	} SSL_BUF_POOL_CLASS;
+
+typedef struct ssl_buf_pool_shard_st
+	{
+	SSL_BUF_POOL_CLASS classes[SSL_BUF_POOL_CLASSES];
+	unsigned long hits, misses, drops;
+	size_t bytes;
+	/* Bytes handed out less bytes given back. A shard may get back more
+	 * than it handed out, but the sum over all shards is right. */
+	size_t bytes_in_use;
+	} SSL_BUF_POOL_SHARD;
+
+struct ssl_buf_pool_st
+	{
+	SSL_BUF_POOL_SHARD shards[CRYPTO_NUM_SSL_BUF_POOL_SHARDS];
+	};
+
+struct ssl_buf_pool_st *ssl_buf_pool_new(void)
+	{
+	struct ssl_buf_pool_st *pool;
+
+	pool = OPENSSL_malloc(sizeof(*pool));
+	if (pool != NULL)
+		memset(pool, 0, sizeof(*pool));
+	return pool;
+	}
+
+static void ssl_buf_pool_flush_shard(SSL_BUF_POOL_SHARD *shard)
+	{
+	SSL_BUF_POOL_ENTRY *ent, *next;
+	int i;
+
+	for (i = 0; i < SSL_BUF_POOL_CLASSES; i++)
+		{
+		for (ent = shard->classes[i].head; ent != NULL; ent = next)
+			{
+			next = ent->next;
+			OPENSSL_free(ent);
+			}
+		shard->bytes -= shard->classes[i].chunklen *
+				shard->classes[i].len;
+		shard->classes[i].chunklen = 0;
+		shard->classes[i].len = 0;
+		shard->classes[i].head = NULL;
+		}
+	}
+
+void ssl_buf_pool_free(struct ssl_buf_pool_st *pool)
+	{
+	int i;
+
+	for (i = 0; i < CRYPTO_NUM_SSL_BUF_POOL_SHARDS; i++)
+		ssl_buf_pool_flush_shard(&pool->shards[i]);
+	OPENSSL_free(pool);
+	}
+
+/* The shard of the calling thread. Thread ids are mostly addresses, which
+ * differ in their high bits only, so the hash is mixed before use. */
+static int ssl_buf_pool_shard(void)
+	{
+	CRYPTO_THREADID id;
+	unsigned long h;
+
+	CRYPTO_THREADID_current(&id);
+	h = (CRYPTO_THREADID_hash(&id) * 0x9E3779B9UL) & 0xffffffffUL;
+	return (int)((h >> 16) % CRYPTO_NUM_SSL_BUF_POOL_SHARDS);
+	}
+
+static void *ssl_buf_pool_get(SSL_CTX *ctx, size_t len)
+	{
+	SSL_BUF_POOL_SHARD *shard;
+	SSL_BUF_POOL_CLASS *cl;
+	SSL_BUF_POOL_ENTRY *ent = NULL;
+	int i, n;
+
+	n = ssl_buf_pool_shard();
+	shard = &ctx->buf_pool->shards[n];
+	CRYPTO_w_lock(CRYPTO_LOCK_SSL_BUF_POOL + n);
+	for (i = 0; i < SSL_BUF_POOL_CLASSES; i++)
+		{
+		cl = &shard->classes[i];
+		if (cl->chunklen == len && cl->head != NULL)
+			{
+			ent = cl->head;
+			cl->head = ent->next;
+			if (--cl->len == 0)
+				cl->chunklen = 0;
+			shard->bytes -= len;
+			break;
+			}
+		}
+	if (ent != NULL)
+		shard->hits++;
+	else
+		shard->misses++;
+	shard->bytes_in_use += len;
+	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_BUF_POOL + n);
+
+	if (ent == NULL && (ent = OPENSSL_malloc(len)) == NULL)
+		{
+		CRYPTO_w_lock(CRYPTO_LOCK_SSL_BUF_POOL + n);
+		shard->bytes_in_use -= len;
+		CRYPTO_w_unlock(CRYPTO_LOCK_SSL_BUF_POOL + n);
+		}
+	return ent;
+	}
+
+static void ssl_buf_pool_release(SSL_CTX *ctx, void *buf, size_t len)
+	{
+	SSL_BUF_POOL_SHARD *shard;
+	SSL_BUF_POOL_CLASS *cl, *free_cl = NULL;
+	SSL_BUF_POOL_ENTRY *ent;
+	unsigned int max;
+	int i, n;
+
+	/* The shards together keep about freelist_max_len buffers of each
+	 * size */
+	max = ctx->freelist_max_len / CRYPTO_NUM_SSL_BUF_POOL_SHARDS;
+	if (max * CRYPTO_NUM_SSL_BUF_POOL_SHARDS < ctx->freelist_max_len)
+		max++;
+
+	n = ssl_buf_pool_shard();
+	shard = &ctx->buf_pool->shards[n];
+	CRYPTO_w_lock(CRYPTO_LOCK_SSL_BUF_POOL + n);
+	shard->bytes_in_use -= len;
+	if (len >= sizeof(*ent))
+		{
+		for (i = 0; i < SSL_BUF_POOL_CLASSES; i++)
+			{
+			cl = &shard->classes[i];
+			if (cl->chunklen == len)
+				break;
+			if (cl->chunklen == 0 && free_cl == NULL)
+				free_cl = cl;
+			}
+		if (i == SSL_BUF_POOL_CLASSES)
+			cl = free_cl;
+		if (cl != NULL && cl->len < max)
+			{
+			cl->chunklen = len;
+			ent = buf;
+			ent->next = cl->head;
+			cl->head = ent;
+			cl->len++;
+			shard->bytes += len;
+			buf = NULL;
+			}
+		}
+	if (buf != NULL)
+		shard->drops++;
+	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_BUF_POOL + n);
+
+	if (buf != NULL)
+		OPENSSL_free(buf);
+	}
+
+#endif
+
+/* Allocates a record buffer of |len| bytes for a connection of |ctx| */
+void *ssl_buf_get(SSL_CTX *ctx, size_t len)
+	{
+	if (ctx->buf_get_cb != NULL)
+		return ctx->buf_get_cb(ctx, len, ctx->buf_cb_arg);
+#ifndef OPENSSL_NO_BUF_FREELISTS
+	if (ctx->buf_pool != NULL)
+		return ssl_buf_pool_get(ctx, len);
+#endif
+	return OPENSSL_malloc(len);
+	}
+
+/* Gives back a buffer from ssl_buf_get(), |len| being the length it was
+ * allocated with */
+void ssl_buf_release(SSL_CTX *ctx, void *buf, size_t len)
+	{
+	if (ctx->buf_release_cb != NULL)
+		{
+		ctx->buf_release_cb(ctx, buf, len, ctx->buf_cb_arg);
+		return;
+		}
+#ifndef OPENSSL_NO_BUF_FREELISTS
+	if (ctx->buf_pool != NULL)
+		{
+		ssl_buf_pool_release(ctx, buf, len);
+		return;
+		}
+#endif
+	OPENSSL_free(buf);
+	}
+
+void SSL_CTX_set_buffer_callbacks(SSL_CTX *ctx,
+		void *(*get_cb)(SSL_CTX *ctx, size_t len, void *arg),
+		void (*release_cb)(SSL_CTX *ctx, void *buf, size_t len,
+				   void *arg),
+		void *arg)
+	{
+	ctx->buf_get_cb = get_cb;
+	ctx->buf_release_cb = release_cb;
+	ctx->buf_cb_arg = arg;
+	}
+
+int SSL_CTX_get_buffer_pool_stats(SSL_CTX *ctx, SSL_BUF_POOL_STATS *stats)
+	{
+#ifndef OPENSSL_NO_BUF_FREELISTS
+	SSL_BUF_POOL_SHARD *shard;
+	int i, j;
+
+	memset(stats, 0, sizeof(*stats));
+	if (ctx->buf_pool == NULL)
+		return 0;
+	for (i = 0; i < CRYPTO_NUM_SSL_BUF_POOL_SHARDS; i++)
+		{
+		shard = &ctx->buf_pool->shards[i];
+		CRYPTO_r_lock(CRYPTO_LOCK_SSL_BUF_POOL + i);
+		stats->hits += shard->hits;
+		stats->misses += shard->misses;
+		stats->drops += shard->drops;
+		for (j = 0; j < SSL_BUF_POOL_CLASSES; j++)
+			stats->buffers += shard->classes[j].len;
+		stats->bytes += shard->bytes;
+		stats->bytes_in_use += shard->bytes_in_use;
+		CRYPTO_r_unlock(CRYPTO_LOCK_SSL_BUF_POOL + i);
+		}
+	return 1;
+#else
+	memset(stats, 0, sizeof(*stats));
+	return 0;
+#endif
+	}
+
+void SSL_CTX_flush_buffer_pool(SSL_CTX *ctx)
+	{
+#ifndef OPENSSL_NO_BUF_FREELISTS
+	int i;
+
+	if (ctx->buf_pool == NULL)
+		return;
+	for (i = 0; i < CRYPTO_NUM_SSL_BUF_POOL_SHARDS; i++)
+		{
+		CRYPTO_w_lock(CRYPTO_LOCK_SSL_BUF_POOL + i);
+		ssl_buf_pool_flush_shard(&ctx->buf_pool->shards[i]);
+		CRYPTO_w_unlock(CRYPTO_LOCK_SSL_BUF_POOL + i);
+		}
+#endif
+	}
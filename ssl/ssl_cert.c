@@ -562,6 +562,46 @@ int ssl_cert_inst(CERT **o)
 	return(1);
 	}
 
+/* With SSL_MODE_RELEASE_HANDSHAKE_STATE, an SSL starts out using the CERT
+ * of its SSL_CTX. Anything that changes s->cert must first call this to
+ * give |s| a copy of its own. |handshake| is set when the handshake needs
+ * the copy: it is then dropped again once the handshake is over, whereas a
+ * copy made for the application's settings is kept. */
+int ssl_cert_unshare(SSL *s, int handshake)
+	{
+	CERT *c;
+
+	if (!s->cert_shared)
+		{
+		if (!handshake)
+			s->cert_handshake_copy = 0;
+		return 1;
+		}
+	if ((c = ssl_cert_dup(s->cert)) == NULL)
+		{
+		SSLerr(SSL_F_SSL_CERT_UNSHARE, ERR_R_MALLOC_FAILURE);
+		return 0;
+		}
+	ssl_cert_free(s->cert);
+	s->cert = c;
+	s->cert_shared = 0;
+	s->cert_handshake_copy = handshake;
+	return 1;
+	}
+
+/* Drops the copy of the CERT made for a handshake, if there is one, and
+ * goes back to using that of the SSL_CTX */
+void ssl_cert_share(SSL *s)
+	{
+	if (!s->cert_handshake_copy)
+		return;
+	CRYPTO_add(&s->ctx->cert->references, 1, CRYPTO_LOCK_SSL_CERT);
+	ssl_cert_free(s->cert);
+	s->cert = s->ctx->cert;
+	s->cert_shared = 1;
+	s->cert_handshake_copy = 0;
+	}
+
 int ssl_cert_set0_chain(SSL *s, SSL_CTX *ctx, STACK_OF(X509) *chain)
 	{
 	int i, r;
@@ -1133,7 +1133,7 @@ static int ssl_cipher_strength_sort(CIPHER_ORDER **head_p,
 
 static int ssl_cipher_process_rulestr(const char *rule_str,
                 CIPHER_ORDER **head_p, CIPHER_ORDER **tail_p,
-                const SSL_CIPHER **ca_list, CERT *c)
+                const SSL_CIPHER **ca_list, int *sec_level)
 	{
 	unsigned long alg_mkey, alg_auth, alg_enc, alg_mac, alg_ssl, algo_strength;
 	const char *l, *buf;
@@ -1362,7 +1362,7 @@ static int ssl_cipher_process_rulestr(const char *rule_str,
 					}
 				else
 					{
-					c->sec_level = level;
+					*sec_level = level;
 					ok = 1;
 					}
 				}
@@ -1457,17 +1457,147 @@ static int check_suiteb_cipher_list(const SSL_METHOD *meth, CERT *c,
 	}
 #endif
 
+/* Compiled cipher lists, kept so that setting the same rule string again,
+ * as per-connection or per-SNI configuration tends to, does not run the
+ * rules again. A list is only valid for the method it was compiled for and
+ * for the ciphers that were disabled at the time, so those are part of the
+ * key. The cache is direct-mapped: an entry displaces the one in its slot.
+ * Entries are never changed once made; callers get copies of the stacks. */
+#define SSL_CIPHER_LIST_CACHE_SIZE	128
+
+typedef struct ssl_cipher_list_cache_st
+	{
+	unsigned long hash;
+	const SSL_METHOD *method;
+	char *rule_str;
+	unsigned long disabled_mkey, disabled_auth, disabled_enc;
+	unsigned long disabled_mac, disabled_ssl;
+	int fips;
+	int sec_level;		/* set by @SECLEVEL, or -1 */
+	STACK_OF(SSL_CIPHER) *cipher_list;
+	STACK_OF(SSL_CIPHER) *cipher_list_by_id;
+	} SSL_CIPHER_LIST_CACHE;
+
+static SSL_CIPHER_LIST_CACHE *ssl_cipher_list_cache[SSL_CIPHER_LIST_CACHE_SIZE];
+
+static void ssl_cipher_list_cache_free(SSL_CIPHER_LIST_CACHE *e)
+	{
+	if (e == NULL)
+		return;
+	if (e->rule_str != NULL)
+		OPENSSL_free(e->rule_str);
+	if (e->cipher_list != NULL)
+		sk_SSL_CIPHER_free(e->cipher_list);
+	if (e->cipher_list_by_id != NULL)
+		sk_SSL_CIPHER_free(e->cipher_list_by_id);
+	OPENSSL_free(e);
+	}
+
+static int ssl_cipher_list_cache_match(const SSL_CIPHER_LIST_CACHE *e,
+		const SSL_CIPHER_LIST_CACHE *key)
+	{
+	return e->hash == key->hash && e->method == key->method
+		&& e->disabled_mkey == key->disabled_mkey
+		&& e->disabled_auth == key->disabled_auth
+		&& e->disabled_enc == key->disabled_enc
+		&& e->disabled_mac == key->disabled_mac
+		&& e->disabled_ssl == key->disabled_ssl
+		&& e->fips == key->fips
+		&& strcmp(e->rule_str, key->rule_str) == 0;
+	}
+
+/* Look up the list compiled for |key| and copy it to |*cipher_list| and
+ * |*cipher_list_by_id|. Returns 1 on a hit, 0 on a miss and -1 if the
+ * copies could not be made. */
+static int ssl_cipher_list_cache_get(SSL_CIPHER_LIST_CACHE *key,
+		STACK_OF(SSL_CIPHER) **cipher_list,
+		STACK_OF(SSL_CIPHER) **cipher_list_by_id)
+	{
+	SSL_CIPHER_LIST_CACHE *e;
+	int ret = 0;
+
+	*cipher_list = *cipher_list_by_id = NULL;
+	CRYPTO_r_lock(CRYPTO_LOCK_SSL_CIPHER_LIST);
+	e = ssl_cipher_list_cache[key->hash % SSL_CIPHER_LIST_CACHE_SIZE];
+	if (e != NULL && ssl_cipher_list_cache_match(e, key))
+		{
+		key->sec_level = e->sec_level;
+		*cipher_list = sk_SSL_CIPHER_dup(e->cipher_list);
+		*cipher_list_by_id = sk_SSL_CIPHER_dup(e->cipher_list_by_id);
+		ret = 1;
+		}
+	CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CIPHER_LIST);
+
+	if (ret == 1 && (*cipher_list == NULL || *cipher_list_by_id == NULL))
+		{
+		if (*cipher_list != NULL)
+			sk_SSL_CIPHER_free(*cipher_list);
+		if (*cipher_list_by_id != NULL)
+			sk_SSL_CIPHER_free(*cipher_list_by_id);
+		SSLerr(SSL_F_SSL_CREATE_CIPHER_LIST,ERR_R_MALLOC_FAILURE);
+		return -1;
+		}
+	return ret;
+	}
+
+/* Add copies of a freshly compiled list to the cache. Failing to do so is
+ * not an error: the list will just be compiled again next time. */
+static void ssl_cipher_list_cache_put(const SSL_CIPHER_LIST_CACHE *key,
+		STACK_OF(SSL_CIPHER) *cipher_list,
+		STACK_OF(SSL_CIPHER) *cipher_list_by_id)
+	{
+	SSL_CIPHER_LIST_CACHE *e, *old;
+
+	e = OPENSSL_malloc(sizeof(*e));
+	if (e == NULL)
+		return;
+	*e = *key;
+	e->rule_str = BUF_strdup(key->rule_str);
+	e->cipher_list = sk_SSL_CIPHER_dup(cipher_list);
+	e->cipher_list_by_id = sk_SSL_CIPHER_dup(cipher_list_by_id);
+	if (e->rule_str == NULL || e->cipher_list == NULL
+		|| e->cipher_list_by_id == NULL)
+		{
+		ssl_cipher_list_cache_free(e);
+		return;
+		}
+
+	CRYPTO_w_lock(CRYPTO_LOCK_SSL_CIPHER_LIST);
+	old = ssl_cipher_list_cache[e->hash % SSL_CIPHER_LIST_CACHE_SIZE];
+	ssl_cipher_list_cache[e->hash % SSL_CIPHER_LIST_CACHE_SIZE] = e;
+	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CIPHER_LIST);
+	ssl_cipher_list_cache_free(old);
+	}
+
+void SSL_flush_cipher_list_cache(void)
+	{
+	SSL_CIPHER_LIST_CACHE *old[SSL_CIPHER_LIST_CACHE_SIZE];
+	int i;
+
+	CRYPTO_w_lock(CRYPTO_LOCK_SSL_CIPHER_LIST);
+	for (i = 0; i < SSL_CIPHER_LIST_CACHE_SIZE; i++)
+		{
+		old[i] = ssl_cipher_list_cache[i];
+		ssl_cipher_list_cache[i] = NULL;
+		}
+	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CIPHER_LIST);
+	for (i = 0; i < SSL_CIPHER_LIST_CACHE_SIZE; i++)
+		ssl_cipher_list_cache_free(old[i]);
+	}
+
 STACK_OF(SSL_CIPHER) *ssl_create_cipher_list(const SSL_METHOD *ssl_method,
 		STACK_OF(SSL_CIPHER) **cipher_list,
 		STACK_OF(SSL_CIPHER) **cipher_list_by_id,
 		const char *rule_str, CERT *c)
 	{
 	int ok, num_of_ciphers, num_of_alias_max, num_of_group_aliases;
+	int sec_level = -1;
 	unsigned long disabled_mkey, disabled_auth, disabled_enc, disabled_mac, disabled_ssl;
 	STACK_OF(SSL_CIPHER) *cipherstack, *tmp_cipher_list;
 	const char *rule_p;
 	CIPHER_ORDER *co_list = NULL, *head = NULL, *tail = NULL, *curr;
 	const SSL_CIPHER **ca_list = NULL;
+	SSL_CIPHER_LIST_CACHE key;
 
 	/*
 	 * Return with error if nothing to do.
@@ -1485,6 +1615,35 @@ STACK_OF(SSL_CIPHER) *ssl_create_cipher_list(const SSL_METHOD *ssl_method,
 	 */
 	ssl_cipher_get_disabled(&disabled_mkey, &disabled_auth, &disabled_enc, &disabled_mac, &disabled_ssl);
 
+	/*
+	 * The same rules for the same method and the same available
+	 * ciphers always give the same list: take it from the cache
+	 * if it has been compiled before.
+	 */
+	memset(&key, 0, sizeof(key));
+	key.method = ssl_method;
+	key.rule_str = (char *)rule_str;
+	key.disabled_mkey = disabled_mkey;
+	key.disabled_auth = disabled_auth;
+	key.disabled_enc = disabled_enc;
+	key.disabled_mac = disabled_mac;
+	key.disabled_ssl = disabled_ssl;
+#ifdef OPENSSL_FIPS
+	key.fips = FIPS_mode();
+#endif
+	key.hash = lh_strhash(rule_str) ^ (unsigned long)(size_t)ssl_method
+		^ disabled_mkey ^ (disabled_auth << 1) ^ (disabled_enc << 2)
+		^ (disabled_mac << 3) ^ (disabled_ssl << 4) ^ key.fips;
+	key.hash ^= key.hash >> 16;
+	ok = ssl_cipher_list_cache_get(&key, &cipherstack, &tmp_cipher_list);
+	if (ok < 0)
+		return NULL;
+	if (ok)
+		{
+		sec_level = key.sec_level;
+		goto done;
+		}
+
 	/*
 	 * Now we have to collect the available ciphers from the compiled
 	 * in ciphers. We cannot get more than the number compiled in, so
@@ -1578,14 +1737,15 @@ STACK_OF(SSL_CIPHER) *ssl_create_cipher_list(const SSL_METHOD *ssl_method,
 	if (strncmp(rule_str,"DEFAULT",7) == 0)
 		{
 		ok = ssl_cipher_process_rulestr(SSL_DEFAULT_CIPHER_LIST,
-			&head, &tail, ca_list, c);
+			&head, &tail, ca_list, &sec_level);
 		rule_p += 7;
 		if (*rule_p == ':')
 			rule_p++;
 		}
 
 	if (ok && (strlen(rule_p) > 0))
-		ok = ssl_cipher_process_rulestr(rule_p, &head, &tail, ca_list, c);
+		ok = ssl_cipher_process_rulestr(rule_p, &head, &tail, ca_list,
+			&sec_level);
 
 	OPENSSL_free((void *)ca_list);	/* Not needed anymore */
 
@@ -1631,15 +1791,21 @@ STACK_OF(SSL_CIPHER) *ssl_create_cipher_list(const SSL_METHOD *ssl_method,
 		sk_SSL_CIPHER_free(cipherstack);
 		return NULL;
 		}
+	(void)sk_SSL_CIPHER_set_cmp_func(tmp_cipher_list,ssl_cipher_ptr_id_cmp);
+	sk_SSL_CIPHER_sort(tmp_cipher_list);
+
+	key.sec_level = sec_level;
+	ssl_cipher_list_cache_put(&key, cipherstack, tmp_cipher_list);
+
+done:
+	if (sec_level >= 0 && c != NULL)
+		c->sec_level = sec_level;
 	if (*cipher_list != NULL)
 		sk_SSL_CIPHER_free(*cipher_list);
 	*cipher_list = cipherstack;
 	if (*cipher_list_by_id != NULL)
 		sk_SSL_CIPHER_free(*cipher_list_by_id);
 	*cipher_list_by_id = tmp_cipher_list;
-	(void)sk_SSL_CIPHER_set_cmp_func(*cipher_list_by_id,ssl_cipher_ptr_id_cmp);
-
-	sk_SSL_CIPHER_sort(*cipher_list_by_id);
 	return(cipherstack);
 	}
 
@@ -686,7 +686,7 @@ void SSL_CONF_CTX_set_ssl(SSL_CONF_CTX *cctx, SSL *ssl)
 	{
 	cctx->ssl = ssl;
 	cctx->ctx = NULL;
-	if (ssl)
+	if (ssl && ssl_cert_unshare(ssl, 0))
 		{
 		cctx->poptions = &ssl->options;
 		cctx->pcert_flags = &ssl->cert->cert_flags;
@@ -309,11 +309,22 @@ SSL *SSL_new(SSL_CTX *ctx)
 		 * accessed for various purposes, and for that reason they
 		 * used to be known as s->ctx->default_cert).
 		 * Now we don't look at the SSL_CTX's CERT after having
-		 * duplicated it once. */
+		 * duplicated it once, except in
+		 * SSL_MODE_RELEASE_HANDSHAKE_STATE where it is again shared
+		 * until the first change (see ssl_cert_unshare()). */
 
-		s->cert = ssl_cert_dup(ctx->cert);
-		if (s->cert == NULL)
-			goto err;
+		if (ctx->mode & SSL_MODE_RELEASE_HANDSHAKE_STATE)
+			{
+			CRYPTO_add(&ctx->cert->references,1,CRYPTO_LOCK_SSL_CERT);
+			s->cert = ctx->cert;
+			s->cert_shared = 1;
+			}
+		else
+			{
+			s->cert = ssl_cert_dup(ctx->cert);
+			if (s->cert == NULL)
+				goto err;
+			}
 		}
 	else
 		s->cert=NULL; /* Cannot really happen (see SSL_CTX_new) */
@@ -342,6 +353,7 @@ SSL *SSL_new(SSL_CTX *ctx)
 #endif
 	s->quiet_shutdown=ctx->quiet_shutdown;
 	s->max_send_fragment = ctx->max_send_fragment;
+	s->default_read_buf_len = ctx->default_read_buf_len;
 
 	CRYPTO_add(&ctx->references,1,CRYPTO_LOCK_SSL_CTX);
 	s->ctx=ctx;
@@ -481,6 +493,7 @@ int SSL_has_matching_session_id(const SSL *ssl, const unsigned char *id,
 	 * any new session built out of this id/id_len and the ssl_version in
 	 * use by this SSL. */
 	SSL_SESSION r, *p;
+	SSL_SESS_CACHE_PART part;
 
 	if(id_len > sizeof r.session_id)
 		return 0;
@@ -500,9 +513,10 @@ int SSL_has_matching_session_id(const SSL *ssl, const unsigned char *id,
 		r.session_id_length = SSL2_SSL_SESSION_ID_LENGTH;
 		}
 
-	CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
-	p = lh_SSL_SESSION_retrieve(ssl->ctx->sessions, &r);
-	CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+	ssl_session_cache_find_part(ssl->ctx, &r, &part);
+	CRYPTO_r_lock(part.lock);
+	p = lh_SSL_SESSION_retrieve(part.sessions, &r);
+	CRYPTO_r_unlock(part.lock);
 	return (p != NULL);
 	}
 
@@ -548,7 +562,8 @@ X509_VERIFY_PARAM *SSL_get0_param(SSL *ssl)
 
 void SSL_certs_clear(SSL *s)
 	{
-	ssl_cert_clear_certs(s->cert);
+	if (ssl_cert_unshare(s, 0))
+		ssl_cert_clear_certs(s->cert);
 	}
 
 void SSL_free(SSL *s)
@@ -932,6 +947,8 @@ void SSL_copy_session_id(SSL *t,const SSL *f)
 	else
 		t->cert=NULL;
 	if (tmp != NULL) ssl_cert_free(tmp);
+	t->cert_shared = f->cert_shared;
+	t->cert_handshake_copy = 0;
 	SSL_set_session_id_context(t,f->sid_ctx,f->sid_ctx_length);
 	}
 
@@ -1051,6 +1068,50 @@ int SSL_write(SSL *s,const void *buf,int num)
 	return(s->method->ssl_write(s,buf,num));
 	}
 
+int SSL_writev(SSL *s, const SSL_IOVEC *iov, int iovcnt)
+	{
+	int i;
+
+	if (s->handshake_func == 0)
+		{
+		SSLerr(SSL_F_SSL_WRITEV, SSL_R_UNINITIALIZED);
+		return -1;
+		}
+
+	if (s->shutdown & SSL_SENT_SHUTDOWN)
+		{
+		s->rwstate=SSL_NOTHING;
+		SSLerr(SSL_F_SSL_WRITEV,SSL_R_PROTOCOL_IS_SHUTDOWN);
+		return(-1);
+		}
+
+	if (iovcnt < 0 || (iov == NULL && iovcnt != 0))
+		{
+		SSLerr(SSL_F_SSL_WRITEV,SSL_R_BAD_VALUE);
+		return -1;
+		}
+
+	/* The version is only known once the handshake is done */
+	if (SSL_in_init(s) && !s->in_handshake)
+		{
+		i=s->handshake_func(s);
+		if (i < 0) return(i);
+		if (i == 0)
+			{
+			SSLerr(SSL_F_SSL_WRITEV,SSL_R_SSL_HANDSHAKE_FAILURE);
+			return -1;
+			}
+		}
+
+	/* Only SSLv3 and TLS records can be gathered */
+	if (s->version < SSL3_VERSION || SSL_IS_DTLS(s))
+		{
+		SSLerr(SSL_F_SSL_WRITEV,SSL_R_WRONG_SSL_VERSION);
+		return -1;
+		}
+	return ssl3_writev(s,iov,iovcnt);
+	}
+
 int SSL_shutdown(SSL *s)
 	{
 	/* Note that this function behaves differently from what one might
@@ -1146,13 +1207,22 @@ long SSL_ctrl(SSL *s,int cmd,long larg,void *parg)
 			return 0;
 		s->max_send_fragment = larg;
 		return 1;
+	case SSL_CTRL_SET_READ_BUFFER_LEN:
+		if (larg < 0)
+			return 0;
+		s->default_read_buf_len = larg;
+		return 1;
 	case SSL_CTRL_GET_RI_SUPPORT:
 		if (s->s3)
 			return s->s3->send_connection_binding;
 		else return 0;
 	case SSL_CTRL_CERT_FLAGS:
+		if (!ssl_cert_unshare(s, 0))
+			return 0;
 		return(s->cert->cert_flags|=larg);
 	case SSL_CTRL_CLEAR_CERT_FLAGS:
+		if (!ssl_cert_unshare(s, 0))
+			return 0;
 		return(s->cert->cert_flags &=~larg);
 
 	case SSL_CTRL_GET_RAW_CIPHERLIST:
@@ -1185,6 +1255,12 @@ long SSL_callback_ctrl(SSL *s, int cmd, void (*fp)(void))
 
 LHASH_OF(SSL_SESSION) *SSL_CTX_sessions(SSL_CTX *ctx)
 	{
+	if (ctx->session_shards != NULL)
+		{
+		CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+		ssl_session_cache_snapshot(ctx);
+		CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+		}
 	return ctx->sessions;
 	}
 
@@ -1236,13 +1312,18 @@ long SSL_CTX_ctrl(SSL_CTX *ctx,int cmd,long larg,void *parg)
 		return(ctx->session_cache_size);
 	case SSL_CTRL_SET_SESS_CACHE_MODE:
 		l=ctx->session_cache_mode;
+		if (((l ^ larg) & SSL_SESS_CACHE_SHARDED) &&
+		    !ssl_session_cache_set_sharded(ctx,
+					larg & SSL_SESS_CACHE_SHARDED))
+			larg = (larg & ~SSL_SESS_CACHE_SHARDED) |
+				(l & SSL_SESS_CACHE_SHARDED);
 		ctx->session_cache_mode=larg;
 		return(l);
 	case SSL_CTRL_GET_SESS_CACHE_MODE:
 		return(ctx->session_cache_mode);
 
 	case SSL_CTRL_SESS_NUMBER:
-		return(lh_SSL_SESSION_num_items(ctx->sessions));
+		return(ssl_session_cache_num_items(ctx));
 	case SSL_CTRL_SESS_CONNECT:
 		return(ctx->stats.sess_connect);
 	case SSL_CTRL_SESS_CONNECT_GOOD:
@@ -1264,7 +1345,7 @@ long SSL_CTX_ctrl(SSL_CTX *ctx,int cmd,long larg,void *parg)
 	case SSL_CTRL_SESS_TIMEOUTS:
 		return(ctx->stats.sess_timeout);
 	case SSL_CTRL_SESS_CACHE_FULL:
-		return(ctx->stats.sess_cache_full);
+		return(ssl_session_cache_num_full(ctx));
 	case SSL_CTRL_OPTIONS:
 		return(ctx->options|=larg);
 	case SSL_CTRL_CLEAR_OPTIONS:
@@ -1278,6 +1359,11 @@ long SSL_CTX_ctrl(SSL_CTX *ctx,int cmd,long larg,void *parg)
 			return 0;
 		ctx->max_send_fragment = larg;
 		return 1;
+	case SSL_CTRL_SET_READ_BUFFER_LEN:
+		if (larg < 0)
+			return 0;
+		ctx->default_read_buf_len = larg;
+		return 1;
 	case SSL_CTRL_CERT_FLAGS:
 		return(ctx->cert->cert_flags|=larg);
 	case SSL_CTRL_CLEAR_CERT_FLAGS:
@@ -1875,6 +1961,21 @@ void SSL_get0_alpn_selected(const SSL *ssl, const unsigned char **data,
 		*len = ssl->s3->alpn_selected_len;
 	}
 
+/* SSL_CTX_set_client_hello_cb sets a callback that a server calls with each
+ * ClientHello it accepts, before it looks up or sets up a session for it.
+ * The callback can look at the extensions with SSL_client_hello_get0_ext,
+ * and switch the SSL_CTX of |s| with SSL_set_SSL_CTX. It returns
+ * SSL_CLIENT_HELLO_SUCCESS to go on, SSL_CLIENT_HELLO_RETRY to suspend the
+ * handshake until it is called again with the same ClientHello, or
+ * SSL_CLIENT_HELLO_ERROR to end it with the alert it sets in |*al|. */
+void SSL_CTX_set_client_hello_cb(SSL_CTX *ctx,
+				 int (*cb) (SSL *s, int *al, void *arg),
+				 void *arg)
+	{
+	ctx->client_hello_cb = cb;
+	ctx->client_hello_cb_arg = arg;
+	}
+
 int SSL_CTX_set_cli_supp_data(SSL_CTX *ctx,
 			      unsigned short supp_data_type,
 			      cli_supp_data_first_cb_fn fn1,
@@ -1981,6 +2082,59 @@ static int ssl_session_cmp(const SSL_SESSION *a,const SSL_SESSION *b)
 static IMPLEMENT_LHASH_HASH_FN(ssl_session, SSL_SESSION)
 static IMPLEMENT_LHASH_COMP_FN(ssl_session, SSL_SESSION)
 
+static void ssl_session_shards_free(SSL_SESS_SHARD *shards)
+	{
+	int i;
+
+	for (i = 0; i < SSL_SESS_NUM_SHARDS; i++)
+		{
+		if (shards[i].sessions != NULL)
+			lh_SSL_SESSION_free(shards[i].sessions);
+		ssl_session_heap_cleanup(&shards[i].heap);
+		}
+	OPENSSL_free(shards);
+	}
+
+/* Switches the internal session cache of |ctx| between a single table under
+ * CRYPTO_LOCK_SSL_CTX and SSL_SESS_NUM_SHARDS separately locked tables.
+ * Cached sessions are flushed rather than migrated, so this is meant to be
+ * done while configuring |ctx|, not while it is in use by other threads. */
+int ssl_session_cache_set_sharded(SSL_CTX *ctx, int sharded)
+	{
+	SSL_SESS_SHARD *shards = NULL;
+	int i;
+
+	if (sharded)
+		{
+		shards = OPENSSL_malloc(sizeof(*shards) * SSL_SESS_NUM_SHARDS);
+		if (shards == NULL)
+			goto err;
+		memset(shards, 0, sizeof(*shards) * SSL_SESS_NUM_SHARDS);
+		for (i = 0; i < SSL_SESS_NUM_SHARDS; i++)
+			{
+			ssl_session_heap_init(&shards[i].heap);
+			shards[i].sessions = lh_SSL_SESSION_new();
+			if (shards[i].sessions == NULL)
+				goto err;
+			}
+		}
+
+	SSL_CTX_flush_sessions(ctx, 0);
+	if (ctx->session_shards != NULL)
+		{
+		ctx->stats.sess_cache_full = ssl_session_cache_num_full(ctx);
+		ssl_session_shards_free(ctx->session_shards);
+		}
+	ctx->session_shards = shards;
+	return 1;
+
+ err:
+	if (shards != NULL)
+		ssl_session_shards_free(shards);
+	SSLerr(SSL_F_SSL_SESSION_CACHE_SET_SHARDED, ERR_R_MALLOC_FAILURE);
+	return 0;
+	}
+
 SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
 	{
 	SSL_CTX *ret=NULL;
@@ -2017,6 +2171,9 @@ SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
 	ret->session_cache_size=SSL_SESSION_CACHE_MAX_SIZE_DEFAULT;
 	ret->session_cache_head=NULL;
 	ret->session_cache_tail=NULL;
+	ret->session_shards=NULL;
+	ret->session_heap=NULL;
+	ret->shm_sess_cache=NULL;
 
 	/* We take the system default */
 	ret->session_timeout=meth->get_timeout();
@@ -2063,6 +2220,9 @@ SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
 
 	ret->sessions=lh_SSL_SESSION_new();
 	if (ret->sessions == NULL) goto err;
+	ret->session_heap=OPENSSL_malloc(sizeof(SSL_SESS_HEAP));
+	if (ret->session_heap == NULL) goto err;
+	ssl_session_heap_init(ret->session_heap);
 	ret->cert_store=X509_STORE_new();
 	if (ret->cert_store == NULL) goto err;
 
@@ -2111,6 +2271,7 @@ SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
 #ifndef OPENSSL_NO_TLSEXT
 	ret->tlsext_servername_callback = 0;
 	ret->tlsext_servername_arg = NULL;
+	ret->tlsext_ticket_key_ring = NULL;
 	/* Setup RFC4507 ticket keys */
 	if ((RAND_pseudo_bytes(ret->tlsext_tick_key_name, 16) <= 0)
 		|| (RAND_bytes(ret->tlsext_tick_hmac_key, 16) <= 0)
@@ -2143,21 +2304,8 @@ SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
 	ret->srv_supp_data_records_count = 0;
 #ifndef OPENSSL_NO_BUF_FREELISTS
 	ret->freelist_max_len = SSL_MAX_BUF_FREELIST_LEN_DEFAULT;
-	ret->rbuf_freelist = OPENSSL_malloc(sizeof(SSL3_BUF_FREELIST));
-	if (!ret->rbuf_freelist)
+	if ((ret->buf_pool = ssl_buf_pool_new()) == NULL)
 		goto err;
-	ret->rbuf_freelist->chunklen = 0;
-	ret->rbuf_freelist->len = 0;
-	ret->rbuf_freelist->head = NULL;
-	ret->wbuf_freelist = OPENSSL_malloc(sizeof(SSL3_BUF_FREELIST));
-	if (!ret->wbuf_freelist)
-		{
-		OPENSSL_free(ret->rbuf_freelist);
-		goto err;
-		}
-	ret->wbuf_freelist->chunklen = 0;
-	ret->wbuf_freelist->len = 0;
-	ret->wbuf_freelist->head = NULL;
 #endif
 #ifndef OPENSSL_NO_ENGINE
 	ret->client_cert_engine = NULL;
@@ -2197,20 +2345,6 @@ static void SSL_COMP_free(SSL_COMP *comp)
     { OPENSSL_free(comp); }
 #endif
 
-#ifndef OPENSSL_NO_BUF_FREELISTS
-static void
-ssl_buf_freelist_free(SSL3_BUF_FREELIST *list)
-	{
-	SSL3_BUF_FREELIST_ENTRY *ent, *next;
-	for (ent = list->head; ent; ent = next)
-		{
-		next = ent->next;
-		OPENSSL_free(ent);
-		}
-	OPENSSL_free(list);
-	}
-#endif
-
 void SSL_CTX_free(SSL_CTX *a)
 	{
 	int i;
@@ -2249,6 +2383,13 @@ void SSL_CTX_free(SSL_CTX *a)
 
 	if (a->sessions != NULL)
 		lh_SSL_SESSION_free(a->sessions);
+	if (a->session_shards != NULL)
+		ssl_session_shards_free(a->session_shards);
+	if (a->session_heap != NULL)
+		{
+		ssl_session_heap_cleanup(a->session_heap);
+		OPENSSL_free(a->session_heap);
+		}
 
 	if (a->cert_store != NULL)
 		X509_STORE_free(a->cert_store);
@@ -2284,6 +2425,8 @@ void SSL_CTX_free(SSL_CTX *a)
 	OPENSSL_free(a->custom_srv_ext_records);
 	OPENSSL_free(a->cli_supp_data_records);
 	OPENSSL_free(a->srv_supp_data_records);
+	if (a->tlsext_ticket_key_ring != NULL)
+		tls1_ticket_key_ring_free(a->tlsext_ticket_key_ring);
 #endif
 #ifndef OPENSSL_NO_ENGINE
 	if (a->client_cert_engine)
@@ -2291,10 +2434,8 @@ void SSL_CTX_free(SSL_CTX *a)
 #endif
 
 #ifndef OPENSSL_NO_BUF_FREELISTS
-	if (a->wbuf_freelist)
-		ssl_buf_freelist_free(a->wbuf_freelist);
-	if (a->rbuf_freelist)
-		ssl_buf_freelist_free(a->rbuf_freelist);
+	if (a->buf_pool)
+		ssl_buf_pool_free(a->buf_pool);
 #endif
 #ifndef OPENSSL_NO_TLSEXT
 # ifndef OPENSSL_NO_EC
@@ -2344,7 +2485,8 @@ void SSL_CTX_set_cert_cb(SSL_CTX *c, int (*cb)(SSL *ssl, void *arg), void *arg)
 
 void SSL_set_cert_cb(SSL *s, int (*cb)(SSL *ssl, void *arg), void *arg)
 	{
-	ssl_cert_set_cert_cb(s->cert, cb, arg);
+	if (ssl_cert_unshare(s, 0))
+		ssl_cert_set_cert_cb(s->cert, cb, arg);
 	}
 
 void ssl_set_cert_masks(CERT *c, const SSL_CIPHER *cipher)
@@ -2762,18 +2904,6 @@ void ssl_update_cache(SSL *s,int mode)
 		if (!s->session_ctx->new_session_cb(s,s->session))
 			SSL_SESSION_free(s->session);
 		}
-
-	/* auto flush every 255 connections */
-	if ((!(i & SSL_SESS_CACHE_NO_AUTO_CLEAR)) &&
-		((i & mode) == mode))
-		{
-		if (  (((mode & SSL_SESS_CACHE_CLIENT)
-			?s->session_ctx->stats.sess_connect_good
-			:s->session_ctx->stats.sess_accept_good) & 0xff) == 0xff)
-			{
-			SSL_CTX_flush_sessions(s->session_ctx,(unsigned long)time(NULL));
-			}
-		}
 	}
 
 const SSL_METHOD *SSL_CTX_get_ssl_method(SSL_CTX *ctx)
@@ -2882,6 +3012,10 @@ int SSL_get_error(const SSL *s,int i)
 		{
 		return(SSL_ERROR_WANT_X509_LOOKUP);
 		}
+	if ((i < 0) && SSL_want_client_hello_cb(s))
+		{
+		return(SSL_ERROR_WANT_CLIENT_HELLO_CB);
+		}
 
 	if (i == 0)
 		{
@@ -3024,6 +3158,8 @@ SSL *SSL_dup(SSL *s)
 			ret->cert = ssl_cert_dup(s->cert);
 			if (ret->cert == NULL)
 				goto err;
+			ret->cert_shared = 0;
+			ret->cert_handshake_copy = 0;
 			}
 				
 		SSL_set_session_id_context(ret,
@@ -3311,6 +3447,11 @@ SSL_CTX *SSL_set_SSL_CTX(SSL *ssl, SSL_CTX* ctx)
 	if (ssl->cert != NULL)
 		ssl_cert_free(ssl->cert);
 	ssl->cert = ssl_cert_dup(ctx->cert);
+	/* The handshake under way changes the copy; it is dropped for the
+	 * CERT of |ctx| once the handshake is over */
+	ssl->cert_shared = 0;
+	ssl->cert_handshake_copy =
+		(ssl->mode & SSL_MODE_RELEASE_HANDSHAKE_STATE) != 0;
 	CRYPTO_add(&ctx->references,1,CRYPTO_LOCK_SSL_CTX);
 	if (ssl->ctx != NULL)
 		SSL_CTX_free(ssl->ctx); /* decrement reference count */
@@ -3642,7 +3783,8 @@ int SSL_is_server(SSL *s)
 
 void SSL_set_security_level(SSL *s, int level)
 	{
-	s->cert->sec_level = level;
+	if (ssl_cert_unshare(s, 0))
+		s->cert->sec_level = level;
 	}
 
 int SSL_get_security_level(const SSL *s)
@@ -3652,7 +3794,8 @@ int SSL_get_security_level(const SSL *s)
 
 void SSL_set_security_callback(SSL *s, int (*cb)(SSL *s, SSL_CTX *ctx, int op, int bits, int nid, void *other, void *ex))
 	{
-	s->cert->sec_cb = cb;
+	if (ssl_cert_unshare(s, 0))
+		s->cert->sec_cb = cb;
 	}
 
 int (*SSL_get_security_callback(const SSL *s))(SSL *s, SSL_CTX *ctx, int op, int bits, int nid, void *other, void *ex)
@@ -3662,7 +3805,8 @@ int (*SSL_get_security_callback(const SSL *s))(SSL *s, SSL_CTX *ctx, int op, int
 
 void SSL_set0_security_ex_data(SSL *s, void *ex)
 	{
-	s->cert->sec_ex = ex;
+	if (ssl_cert_unshare(s, 0))
+		s->cert->sec_ex = ex;
 	}
 
 void *SSL_get0_security_ex_data(const SSL *s)
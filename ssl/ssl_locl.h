@@ -366,6 +366,13 @@
  * make sure to update this constant too */
 #define SSL_MAX_DIGEST 6
 
+/* The running hashes of the handshake messages are those of
+ * ssl_get_handshake_digest() followed by the hashes only a TLS 1.2
+ * CertificateVerify may be signed with */
+#define SSL3_HANDSHAKE_DGST_SHA224	SSL_MAX_DIGEST
+#define SSL3_HANDSHAKE_DGST_SHA512	(SSL_MAX_DIGEST + 1)
+#define SSL3_NUM_HANDSHAKE_DGST		(SSL_MAX_DIGEST + 2)
+
 #define TLS1_PRF_DGST_SHIFT 10
 #define TLS1_PRF_MD5 (SSL_HANDSHAKE_MAC_MD5 << TLS1_PRF_DGST_SHIFT)
 #define TLS1_PRF_SHA1 (SSL_HANDSHAKE_MAC_SHA << TLS1_PRF_DGST_SHIFT)
@@ -662,6 +669,87 @@ typedef struct sess_cert_st
 
 	int references; /* actually always 1 at the moment */
 	} SESS_CERT;
+
+/* A cached session and the time it expires at. The time is kept next to
+ * the pointer so that moving through the heap does not touch the sessions
+ * themselves, which are scattered over memory. */
+typedef struct ssl_sess_heap_entry_st
+	{
+	long expire;
+	SSL_SESSION *sess;
+	} SSL_SESS_HEAP_ENTRY;
+
+/* Binary min-heap of cached sessions keyed on their expiry time, so that
+ * expired sessions can be found without walking the whole cache. */
+typedef struct ssl_sess_heap_st
+	{
+	SSL_SESS_HEAP_ENTRY *ent;
+	unsigned long num;
+	unsigned long max;
+	/* expire of the top entry, or LONG_MAX if empty. This may be
+	 * read without the lock to skip taking it when nothing has expired. */
+	long next_expire;
+	} SSL_SESS_HEAP;
+
+/* Upper bound on the number of expired sessions removed per cache lookup
+ * or addition unless SSL_SESS_CACHE_NO_AUTO_CLEAR is set. */
+#define SSL_SESS_EXPIRE_BATCH	8
+
+/* One shard of an SSL_SESS_CACHE_SHARDED session cache: shard i is protected
+ * by lock CRYPTO_LOCK_SSL_SESS_SHARD + i rather than CRYPTO_LOCK_SSL_CTX. */
+typedef struct ssl_sess_shard_st
+	{
+	LHASH_OF(SSL_SESSION) *sessions;
+	SSL_SESSION *session_cache_head;
+	SSL_SESSION *session_cache_tail;
+	SSL_SESS_HEAP heap;
+	int cache_full;		/* sessions removed as the shard was full */
+	} SSL_SESS_SHARD;
+
+#define SSL_SESS_NUM_SHARDS	CRYPTO_NUM_SSL_SESS_SHARDS
+
+/* The part of the internal session cache holding a given session ID: either
+ * the whole cache of an SSL_CTX or one of its shards. */
+typedef struct ssl_sess_cache_part_st
+	{
+	LHASH_OF(SSL_SESSION) *sessions;
+	SSL_SESSION **head;
+	SSL_SESSION **tail;
+	SSL_SESS_HEAP *heap;
+	unsigned long max;	/* size limit for this part, 0 is unlimited */
+	int *cache_full;	/* count of sessions removed as it was full */
+	int lock;
+	} SSL_SESS_CACHE_PART;
+
+/* A session ticket key. The cipher and HMAC contexts are keyed once when the
+ * key is added and copied for each ticket rather than keyed again. */
+typedef struct tls_ticket_key_st
+	{
+	unsigned char name[16];
+	EVP_CIPHER_CTX enc_ctx;
+	EVP_CIPHER_CTX dec_ctx;
+	HMAC_CTX hmac_ctx;
+	} TLS_TICKET_KEY;
+
+DECLARE_LHASH_OF(TLS_TICKET_KEY);
+
+/* The ticket keys of an SSL_CTX indexed by name, protected by lock
+ * CRYPTO_LOCK_SSL_TICKET_KEYS. New tickets use encrypt_key, if set. */
+typedef struct tls_ticket_key_ring_st
+	{
+	LHASH_OF(TLS_TICKET_KEY) *keys;
+	TLS_TICKET_KEY *encrypt_key;
+	} TLS_TICKET_KEY_RING;
+
+/* An extension of the ClientHello in init_msg: its type, and the offset
+ * from init_msg and length of its body */
+typedef struct tls1_ext_index_st
+	{
+	unsigned int type;
+	unsigned int off;
+	unsigned int len;
+	} TLS1_EXT_INDEX;
+
 /* Structure containing decoded values of signature algorithms extension */
 struct tls_sigalgs_st
 	{
@@ -755,20 +843,6 @@ typedef struct ssl3_comp_st
 	} SSL3_COMP;
 #endif
 
-#ifndef OPENSSL_NO_BUF_FREELISTS
-typedef struct ssl3_buf_freelist_st
-	{
-	size_t chunklen;
-	unsigned int len;
-	struct ssl3_buf_freelist_entry_st *head;
-	} SSL3_BUF_FREELIST;
-
-typedef struct ssl3_buf_freelist_entry_st
-	{
-	struct ssl3_buf_freelist_entry_st *next;
-	} SSL3_BUF_FREELIST_ENTRY;
-#endif
-
 extern SSL3_ENC_METHOD ssl3_undef_enc_method;
 OPENSSL_EXTERN const SSL_CIPHER ssl2_ciphers[];
 OPENSSL_EXTERN SSL_CIPHER ssl3_ciphers[];
@@ -976,6 +1050,8 @@ CERT *ssl_cert_new(void);
 CERT *ssl_cert_dup(CERT *cert);
 void ssl_cert_set_default_md(CERT *cert);
 int ssl_cert_inst(CERT **o);
+int ssl_cert_unshare(SSL *s, int handshake);
+void ssl_cert_share(SSL *s);
 void ssl_cert_clear_certs(CERT *c);
 void ssl_cert_free(CERT *c);
 SESS_CERT *ssl_sess_cert_new(void);
@@ -983,6 +1059,19 @@ void ssl_sess_cert_free(SESS_CERT *sc);
 int ssl_set_peer_cert_type(SESS_CERT *c, int type);
 int ssl_get_new_session(SSL *s, int session);
 int ssl_get_prev_session(SSL *s, unsigned char *session,int len, const unsigned char *limit);
+unsigned int ssl_session_cache_num_parts(const SSL_CTX *ctx);
+void ssl_session_cache_get_part(SSL_CTX *ctx, unsigned int idx,
+				SSL_SESS_CACHE_PART *part);
+void ssl_session_cache_find_part(SSL_CTX *ctx, const SSL_SESSION *s,
+				 SSL_SESS_CACHE_PART *part);
+long ssl_session_cache_num_items(SSL_CTX *ctx);
+long ssl_session_cache_num_full(SSL_CTX *ctx);
+void ssl_session_cache_snapshot(SSL_CTX *ctx);
+void ssl_session_heap_init(SSL_SESS_HEAP *heap);
+void ssl_session_heap_cleanup(SSL_SESS_HEAP *heap);
+int ssl_session_cache_set_sharded(SSL_CTX *ctx, int sharded);
+int ssl_session_encode_compact(const SSL_SESSION *in, unsigned char *out,
+			       unsigned int outlen, int no_id);
 int ssl_cipher_id_cmp(const SSL_CIPHER *a,const SSL_CIPHER *b);
 DECLARE_OBJ_BSEARCH_GLOBAL_CMP_FN(SSL_CIPHER, SSL_CIPHER,
 				  ssl_cipher_id);
@@ -1066,7 +1155,7 @@ long	ssl2_default_timeout(void );
 
 const SSL_CIPHER *ssl3_get_cipher_by_char(const unsigned char *p);
 int ssl3_put_cipher_by_char(const SSL_CIPHER *c,unsigned char *p);
-void ssl3_init_finished_mac(SSL *s);
+int ssl3_init_finished_mac(SSL *s);
 int ssl3_send_server_certificate(SSL *s);
 int ssl3_send_newsession_ticket(SSL *s);
 int ssl3_send_cert_status(SSL *s);
@@ -1089,6 +1178,7 @@ int ssl3_renegotiate_check(SSL *ssl);
 int ssl3_dispatch_alert(SSL *s);
 int ssl3_read_bytes(SSL *s, int type, unsigned char *buf, int len, int peek);
 int ssl3_write_bytes(SSL *s, int type, const void *buf, int len);
+int ssl3_writev_bytes(SSL *s, int type, const SSL_IOVEC *iov, int iovcnt);
 int ssl3_final_finish_mac(SSL *s, const char *sender, int slen,unsigned char *p);
 int ssl3_cert_verify_mac(SSL *s, int md_nid, unsigned char *p);
 void ssl3_finish_mac(SSL *s, const unsigned char *buf, int len);
@@ -1103,7 +1193,16 @@ int	ssl3_setup_read_buffer(SSL *s);
 int	ssl3_setup_write_buffer(SSL *s);
 int	ssl3_release_read_buffer(SSL *s);
 int	ssl3_release_write_buffer(SSL *s);
-int	ssl3_digest_cached_records(SSL *s);
+#ifndef OPENSSL_NO_BUF_FREELISTS
+struct ssl_buf_pool_st *ssl_buf_pool_new(void);
+void	ssl_buf_pool_free(struct ssl_buf_pool_st *pool);
+#endif
+void *	ssl_buf_get(SSL_CTX *ctx, size_t len);
+void	ssl_buf_release(SSL_CTX *ctx, void *buf, size_t len);
+void	ssl3_release_handshake_state(SSL *s);
+int	ssl3_select_handshake_dgst(SSL *s, unsigned int sig_hashes);
+int	ssl3_freeze_handshake_dgst(SSL *s);
+EVP_MD_CTX *ssl3_get_handshake_dgst(SSL *s, int md_nid);
 int	ssl3_new(SSL *s);
 void	ssl3_free(SSL *s);
 int	ssl3_accept(SSL *s);
@@ -1111,6 +1210,7 @@ int	ssl3_connect(SSL *s);
 int	ssl3_read(SSL *s, void *buf, int len);
 int	ssl3_peek(SSL *s, void *buf, int len);
 int	ssl3_write(SSL *s, const void *buf, int len);
+int	ssl3_writev(SSL *s, const SSL_IOVEC *iov, int iovcnt);
 int	ssl3_shutdown(SSL *s);
 void	ssl3_clear(SSL *s);
 long	ssl3_ctrl(SSL *s,int cmd, long larg, void *parg);
@@ -1285,6 +1385,7 @@ int tls1_shared_list(SSL *s,
 			int nmatch);
 unsigned char *ssl_add_clienthello_tlsext(SSL *s, unsigned char *p, unsigned char *limit, int *al);
 unsigned char *ssl_add_serverhello_tlsext(SSL *s, unsigned char *p, unsigned char *limit, int *al);
+int tls1_index_clienthello_tlsext(SSL *s, const unsigned char *d, long n);
 int ssl_parse_clienthello_tlsext(SSL *s, unsigned char **data, unsigned char *d, int n);
 int ssl_check_clienthello_tlsext_late(SSL *s);
 int ssl_parse_serverhello_tlsext(SSL *s, unsigned char **data, unsigned char *d, int n);
@@ -1312,11 +1413,17 @@ int dtls1_process_heartbeat(SSL *s);
 #endif
 int tls1_process_ticket(SSL *s, unsigned char *session_id, int len,
 				const unsigned char *limit, SSL_SESSION **ret);
+int tls1_ticket_key_ring_cb(SSL_CTX *ctx, unsigned char *name,
+			    unsigned char *iv, EVP_CIPHER_CTX *ectx,
+			    HMAC_CTX *hctx, int enc);
+void tls1_ticket_key_ring_free(TLS_TICKET_KEY_RING *ring);
 
 int tls12_get_sigandhash(unsigned char *p, const EVP_PKEY *pk,
 				const EVP_MD *md);
 int tls12_get_sigid(const EVP_PKEY *pk);
 const EVP_MD *tls12_get_hash(unsigned char hash_alg);
+int tls12_get_hash_id(const EVP_MD *md);
+unsigned int tls12_cert_verify_hashes(SSL *s, int cert_req);
 void ssl_set_sig_mask(unsigned long *pmask_a, SSL *s, int op);
 
 int tls1_set_sigalgs_list(CERT *c, const char *str, int client);
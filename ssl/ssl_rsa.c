@@ -81,7 +81,7 @@ int SSL_use_certificate(SSL *ssl, X509 *x)
 		return 0;
 		}
 
-	if (!ssl_cert_inst(&ssl->cert))
+	if (!ssl_cert_inst(&ssl->cert) || !ssl_cert_unshare(ssl, 0))
 		{
 		SSLerr(SSL_F_SSL_USE_CERTIFICATE,ERR_R_MALLOC_FAILURE);
 		return(0);
@@ -167,7 +167,7 @@ int SSL_use_RSAPrivateKey(SSL *ssl, RSA *rsa)
 		SSLerr(SSL_F_SSL_USE_RSAPRIVATEKEY,ERR_R_PASSED_NULL_PARAMETER);
 		return(0);
 		}
-	if (!ssl_cert_inst(&ssl->cert))
+	if (!ssl_cert_inst(&ssl->cert) || !ssl_cert_unshare(ssl, 0))
 		{
 		SSLerr(SSL_F_SSL_USE_RSAPRIVATEKEY,ERR_R_MALLOC_FAILURE);
 		return(0);
@@ -324,7 +324,7 @@ int SSL_use_PrivateKey(SSL *ssl, EVP_PKEY *pkey)
 		SSLerr(SSL_F_SSL_USE_PRIVATEKEY,ERR_R_PASSED_NULL_PARAMETER);
 		return(0);
 		}
-	if (!ssl_cert_inst(&ssl->cert))
+	if (!ssl_cert_inst(&ssl->cert) || !ssl_cert_unshare(ssl, 0))
 		{
 		SSLerr(SSL_F_SSL_USE_PRIVATEKEY,ERR_R_MALLOC_FAILURE);
 		return(0);
@@ -136,6 +136,7 @@
  */
 
 #include <stdio.h>
+#include <limits.h>
 #include <openssl/lhash.h>
 #include <openssl/rand.h>
 #ifndef OPENSSL_NO_ENGINE
@@ -143,9 +144,19 @@
 #endif
 #include "ssl_locl.h"
 
-static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s);
-static void SSL_SESSION_list_add(SSL_CTX *ctx,SSL_SESSION *s);
+static void SSL_SESSION_list_remove(SSL_SESS_CACHE_PART *part,
+				    SSL_SESSION *s);
+static void SSL_SESSION_list_add(SSL_SESS_CACHE_PART *part, SSL_SESSION *s);
 static int remove_session_lock(SSL_CTX *ctx, SSL_SESSION *c, int lck);
+static int ssl_session_heap_reserve(SSL_SESS_HEAP *h);
+static void ssl_session_heap_push(SSL_SESS_HEAP *h, SSL_SESSION *s);
+static void ssl_session_heap_remove(SSL_SESS_HEAP *h, SSL_SESSION *s);
+static void ssl_session_cache_clear_snapshot(SSL_CTX *ctx);
+static void ssl_session_cache_expire(SSL_CTX *ctx, SSL_SESS_CACHE_PART *part,
+				     long t, unsigned int max);
+static void ssl_session_cache_expire_some(SSL_CTX *ctx,
+					  SSL_SESS_CACHE_PART *part, long t);
+static void ssl_session_cache_rekey(SSL_SESSION *s);
 
 SSL_SESSION *SSL_get_session(const SSL *ssl)
 /* aka SSL_get0_session; gets 0 objects, just returns a copy of the pointer */
@@ -481,19 +492,28 @@ int ssl_get_prev_session(SSL *s, unsigned char *session_id, int len,
 	    !(s->session_ctx->session_cache_mode & SSL_SESS_CACHE_NO_INTERNAL_LOOKUP))
 		{
 		SSL_SESSION data;
+		SSL_SESS_CACHE_PART part;
+		long now = (long)time(NULL);
+		int expired;
 		data.ssl_version=s->version;
 		data.session_id_length=len;
 		if (len == 0)
 			return 0;
 		memcpy(data.session_id,session_id,len);
-		CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
-		ret=lh_SSL_SESSION_retrieve(s->session_ctx->sessions,&data);
+		ssl_session_cache_find_part(s->session_ctx,&data,&part);
+		CRYPTO_r_lock(part.lock);
+		ret=lh_SSL_SESSION_retrieve(part.sessions,&data);
 		if (ret != NULL)
 			{
 			/* don't allow other threads to steal it: */
 			CRYPTO_add(&ret->references,1,CRYPTO_LOCK_SSL_SESSION);
 			}
-		CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+		/* Only take the lock for writing when a session is due */
+		expired = part.heap->next_expire < now;
+		CRYPTO_r_unlock(part.lock);
+		if (expired && !(s->session_ctx->session_cache_mode &
+				 SSL_SESS_CACHE_NO_AUTO_CLEAR))
+			ssl_session_cache_expire_some(s->session_ctx,&part,now);
 		if (ret == NULL)
 			s->session_ctx->stats.sess_miss++;
 		}
@@ -613,6 +633,7 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 	{
 	int ret=0;
 	SSL_SESSION *s;
+	SSL_SESS_CACHE_PART part;
 
 	/* add just 1 reference count for the SSL_CTX's session cache
 	 * even though it has two ways of access: each session is in a
@@ -620,8 +641,15 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 	CRYPTO_add(&c->references,1,CRYPTO_LOCK_SSL_SESSION);
 	/* if session c is in already in cache, we take back the increment later */
 
-	CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
-	s=lh_SSL_SESSION_insert(ctx->sessions,c);
+	ssl_session_cache_find_part(ctx,c,&part);
+	CRYPTO_w_lock(part.lock);
+	if (!ssl_session_heap_reserve(part.heap))
+		{
+		CRYPTO_w_unlock(part.lock);
+		SSL_SESSION_free(c);
+		return 0;
+		}
+	s=lh_SSL_SESSION_insert(part.sessions,c);
 	
 	/* s != NULL iff we already had a session with the given PID.
 	 * In this case, s == c should hold (then we did not really modify
@@ -629,7 +657,8 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 	if (s != NULL && s != c)
 		{
 		/* We *are* in trouble ... */
-		SSL_SESSION_list_remove(ctx,s);
+		SSL_SESSION_list_remove(&part,s);
+		ssl_session_heap_remove(part.heap,s);
 		SSL_SESSION_free(s);
 		/* ... so pretend the other session did not exist in cache
 		 * (we cannot handle two SSL_SESSION structures with identical
@@ -641,36 +670,48 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 
  	/* Put at the head of the queue unless it is already in the cache */
 	if (s == NULL)
-		SSL_SESSION_list_add(ctx,c);
+		{
+		SSL_SESSION_list_add(&part,c);
+		ssl_session_heap_push(part.heap,c);
+		c->cache_ctx = ctx;
+		}
 
 	if (s != NULL)
 		{
 		/* existing cache entry -- decrement previously incremented reference
 		 * count because it already takes into account the cache */
 
+		/* pick up any change to its time or timeout */
+		ssl_session_heap_remove(part.heap,c);
+		ssl_session_heap_push(part.heap,c);
+		c->cache_ctx = ctx;
 		SSL_SESSION_free(s); /* s == c */
 		ret=0;
 		}
 	else
 		{
-		/* new cache entry -- remove old ones if cache has become too large */
+		/* new cache entry -- remove expired ones and then old ones if
+		 * cache has become too large */
 		
 		ret=1;
 
-		if (SSL_CTX_sess_get_cache_size(ctx) > 0)
+		if (!(ctx->session_cache_mode & SSL_SESS_CACHE_NO_AUTO_CLEAR))
+			ssl_session_cache_expire(ctx, &part, (long)time(NULL),
+						 SSL_SESS_EXPIRE_BATCH);
+
+		if (part.max > 0)
 			{
-			while (SSL_CTX_sess_number(ctx) >
-				SSL_CTX_sess_get_cache_size(ctx))
+			while (lh_SSL_SESSION_num_items(part.sessions) >
+				part.max)
 				{
-				if (!remove_session_lock(ctx,
-					ctx->session_cache_tail, 0))
+				if (!remove_session_lock(ctx, *part.tail, 0))
 					break;
 				else
-					ctx->stats.sess_cache_full++;
+					(*part.cache_full)++;
 				}
 			}
 		}
-	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+	CRYPTO_w_unlock(part.lock);
 	return(ret);
 	}
 
@@ -682,19 +723,22 @@ int SSL_CTX_remove_session(SSL_CTX *ctx, SSL_SESSION *c)
 static int remove_session_lock(SSL_CTX *ctx, SSL_SESSION *c, int lck)
 	{
 	SSL_SESSION *r;
+	SSL_SESS_CACHE_PART part;
 	int ret=0;
 
 	if ((c != NULL) && (c->session_id_length != 0))
 		{
-		if(lck) CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
-		if ((r = lh_SSL_SESSION_retrieve(ctx->sessions,c)) == c)
+		ssl_session_cache_find_part(ctx,c,&part);
+		if(lck) CRYPTO_w_lock(part.lock);
+		if ((r = lh_SSL_SESSION_retrieve(part.sessions,c)) == c)
 			{
 			ret=1;
-			r=lh_SSL_SESSION_delete(ctx->sessions,c);
-			SSL_SESSION_list_remove(ctx,c);
+			r=lh_SSL_SESSION_delete(part.sessions,c);
+			SSL_SESSION_list_remove(&part,c);
+			ssl_session_heap_remove(part.heap,c);
 			}
 
-		if(lck) CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+		if(lck) CRYPTO_w_unlock(part.lock);
 
 		if (ret)
 			{
@@ -826,6 +870,7 @@ long SSL_SESSION_set_timeout(SSL_SESSION *s, long t)
 	{
 	if (s == NULL) return(0);
 	s->timeout=t;
+	ssl_session_cache_rekey(s);
 	return(1);
 	}
 
@@ -845,6 +890,7 @@ long SSL_SESSION_set_time(SSL_SESSION *s, long t)
 	{
 	if (s == NULL) return(0);
 	s->time=t;
+	ssl_session_cache_rekey(s);
 	return(t);
 	}
 
@@ -941,7 +987,7 @@ typedef struct timeout_param_st
 	{
 	SSL_CTX *ctx;
 	long time;
-	LHASH_OF(SSL_SESSION) *cache;
+	SSL_SESS_CACHE_PART part;
 	} TIMEOUT_PARAM;
 
 static void timeout_doall_arg(SSL_SESSION *s, TIMEOUT_PARAM *p)
@@ -950,8 +996,9 @@ static void timeout_doall_arg(SSL_SESSION *s, TIMEOUT_PARAM *p)
 		{
 		/* The reason we don't call SSL_CTX_remove_session() is to
 		 * save on locking overhead */
-		(void)lh_SSL_SESSION_delete(p->cache,s);
-		SSL_SESSION_list_remove(p->ctx,s);
+		(void)lh_SSL_SESSION_delete(p->part.sessions,s);
+		SSL_SESSION_list_remove(&p->part,s);
+		ssl_session_heap_remove(p->part.heap,s);
 		s->not_resumable=1;
 		if (p->ctx->remove_session_cb != NULL)
 			p->ctx->remove_session_cb(p->ctx,s);
@@ -964,19 +1011,375 @@ static IMPLEMENT_LHASH_DOALL_ARG_FN(timeout, SSL_SESSION, TIMEOUT_PARAM)
 void SSL_CTX_flush_sessions(SSL_CTX *s, long t)
 	{
 	unsigned long i;
+	unsigned int n;
 	TIMEOUT_PARAM tp;
 
+	if (s->sessions == NULL) return;
 	tp.ctx=s;
-	tp.cache=s->sessions;
-	if (tp.cache == NULL) return;
 	tp.time=t;
-	CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
-	i=CHECKED_LHASH_OF(SSL_SESSION, tp.cache)->down_load;
-	CHECKED_LHASH_OF(SSL_SESSION, tp.cache)->down_load=0;
-	lh_SSL_SESSION_doall_arg(tp.cache, LHASH_DOALL_ARG_FN(timeout),
-				 TIMEOUT_PARAM, &tp);
-	CHECKED_LHASH_OF(SSL_SESSION, tp.cache)->down_load=i;
-	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+	for (n = 0; n < ssl_session_cache_num_parts(s); n++)
+		{
+		ssl_session_cache_get_part(s,n,&tp.part);
+		CRYPTO_w_lock(tp.part.lock);
+		if (t != 0)
+			{
+			/* Only the expired sessions need to be visited */
+			ssl_session_cache_expire(s,&tp.part,t,0);
+			CRYPTO_w_unlock(tp.part.lock);
+			continue;
+			}
+		i=CHECKED_LHASH_OF(SSL_SESSION, tp.part.sessions)->down_load;
+		CHECKED_LHASH_OF(SSL_SESSION, tp.part.sessions)->down_load=0;
+		lh_SSL_SESSION_doall_arg(tp.part.sessions,
+			LHASH_DOALL_ARG_FN(timeout), TIMEOUT_PARAM, &tp);
+		CHECKED_LHASH_OF(SSL_SESSION, tp.part.sessions)->down_load=i;
+		CRYPTO_w_unlock(tp.part.lock);
+		}
+	if (t == 0 && s->session_shards != NULL)
+		{
+		/* drop the references of the copy for SSL_CTX_sessions() */
+		CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+		ssl_session_cache_clear_snapshot(s);
+		CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+		}
+	}
+
+static long ssl_session_expire_time(const SSL_SESSION *s)
+	{
+	if (s->timeout > 0 && s->time > LONG_MAX - s->timeout)
+		return LONG_MAX;
+	return s->time + s->timeout;
+	}
+
+void ssl_session_heap_init(SSL_SESS_HEAP *h)
+	{
+	h->ent = NULL;
+	h->num = 0;
+	h->max = 0;
+	h->next_expire = LONG_MAX;
+	}
+
+void ssl_session_heap_cleanup(SSL_SESS_HEAP *h)
+	{
+	if (h->ent != NULL)
+		OPENSSL_free(h->ent);
+	ssl_session_heap_init(h);
+	}
+
+static void ssl_session_heap_set(SSL_SESS_HEAP *h, unsigned long i,
+				 SSL_SESS_HEAP_ENTRY e)
+	{
+	h->ent[i] = e;
+	e.sess->cache_heap_idx = i;
+	}
+
+static void ssl_session_heap_sift_up(SSL_SESS_HEAP *h, unsigned long i)
+	{
+	SSL_SESS_HEAP_ENTRY e = h->ent[i];
+	unsigned long parent;
+
+	while (i > 0)
+		{
+		parent = (i - 1) / 2;
+		if (h->ent[parent].expire <= e.expire)
+			break;
+		ssl_session_heap_set(h, i, h->ent[parent]);
+		i = parent;
+		}
+	ssl_session_heap_set(h, i, e);
+	}
+
+static void ssl_session_heap_sift_down(SSL_SESS_HEAP *h, unsigned long i)
+	{
+	SSL_SESS_HEAP_ENTRY e = h->ent[i];
+	unsigned long child;
+
+	for (;;)
+		{
+		child = 2 * i + 1;
+		if (child >= h->num)
+			break;
+		if (child + 1 < h->num &&
+		    h->ent[child + 1].expire < h->ent[child].expire)
+			child++;
+		if (e.expire <= h->ent[child].expire)
+			break;
+		ssl_session_heap_set(h, i, h->ent[child]);
+		i = child;
+		}
+	ssl_session_heap_set(h, i, e);
+	}
+
+static void ssl_session_heap_update(SSL_SESS_HEAP *h)
+	{
+	h->next_expire = h->num > 0 ? h->ent[0].expire : LONG_MAX;
+	}
+
+/* Makes room for one more session so that ssl_session_heap_push() cannot
+ * fail once the session has been inserted into the hash table. */
+static int ssl_session_heap_reserve(SSL_SESS_HEAP *h)
+	{
+	SSL_SESS_HEAP_ENTRY *p;
+	unsigned long n;
+
+	if (h->num < h->max)
+		return 1;
+	n = h->max > 0 ? h->max * 2 : 64;
+	if (n < h->max || n > ((size_t)-1) / sizeof(*p))
+		return 0;
+	p = OPENSSL_realloc(h->ent, n * sizeof(*p));
+	if (p == NULL)
+		return 0;
+	h->ent = p;
+	h->max = n;
+	return 1;
+	}
+
+static void ssl_session_heap_push(SSL_SESS_HEAP *h, SSL_SESSION *s)
+	{
+	SSL_SESS_HEAP_ENTRY e;
+
+	e.expire = ssl_session_expire_time(s);
+	e.sess = s;
+	ssl_session_heap_set(h, h->num++, e);
+	ssl_session_heap_sift_up(h, s->cache_heap_idx);
+	ssl_session_heap_update(h);
+	}
+
+static void ssl_session_heap_remove(SSL_SESS_HEAP *h, SSL_SESSION *s)
+	{
+	unsigned long i = s->cache_heap_idx;
+	SSL_SESS_HEAP_ENTRY last;
+
+	if (i >= h->num || h->ent[i].sess != s)
+		return;
+	s->cache_ctx = NULL;
+	last = h->ent[--h->num];
+	if (last.sess != s)
+		{
+		ssl_session_heap_set(h, i, last);
+		ssl_session_heap_sift_down(h, i);
+		ssl_session_heap_sift_up(h, last.sess->cache_heap_idx);
+		}
+	ssl_session_heap_update(h);
+	}
+
+/* Removes the sessions of |part| that expired before time |t|, but no more
+ * than |max| of them unless |max| is 0. The cost is proportional to the
+ * number of sessions removed, not to the size of the cache. Called with the
+ * lock of |part| held. */
+static void ssl_session_cache_expire(SSL_CTX *ctx, SSL_SESS_CACHE_PART *part,
+				     long t, unsigned int max)
+	{
+	SSL_SESS_HEAP *h = part->heap;
+	SSL_SESSION *s;
+	unsigned int n = 0;
+	unsigned long down_load;
+
+	if (h->num == 0 || h->ent[0].expire >= t)
+		return;
+	/* As in a full flush, the table is not shrunk while sessions expire:
+	 * new sessions fill it again and would have it grown back bucket by
+	 * bucket. */
+	down_load = CHECKED_LHASH_OF(SSL_SESSION, part->sessions)->down_load;
+	CHECKED_LHASH_OF(SSL_SESSION, part->sessions)->down_load = 0;
+	while (h->num > 0 && h->ent[0].expire < t &&
+	       (max == 0 || n++ < max))
+		{
+		s = h->ent[0].sess;
+		if (ssl_session_expire_time(s) >= t)
+			{
+			/* Its time or timeout was changed while cached */
+			h->ent[0].expire = ssl_session_expire_time(s);
+			ssl_session_heap_sift_down(h, 0);
+			ssl_session_heap_update(h);
+			continue;
+			}
+		ssl_session_heap_remove(h, s);
+		(void)lh_SSL_SESSION_delete(part->sessions,s);
+		SSL_SESSION_list_remove(part,s);
+		s->not_resumable=1;
+		if (ctx->remove_session_cb != NULL)
+			ctx->remove_session_cb(ctx,s);
+		SSL_SESSION_free(s);
+		}
+	CHECKED_LHASH_OF(SSL_SESSION, part->sessions)->down_load = down_load;
+	}
+
+/* Removes a bounded number of the sessions of |part| that expired before
+ * time |t|, taking its lock. */
+static void ssl_session_cache_expire_some(SSL_CTX *ctx,
+					  SSL_SESS_CACHE_PART *part, long t)
+	{
+	CRYPTO_w_lock(part->lock);
+	ssl_session_cache_expire(ctx, part, t, SSL_SESS_EXPIRE_BATCH);
+	CRYPTO_w_unlock(part->lock);
+	}
+
+/* Moves |s| within the expiry heap of the internal cache holding it, if any,
+ * after its time or timeout changed. ssl_session_cache_expire() would only
+ * find a session whose timeout was shortened once its old expiry time came.
+ * s->cache_ctx is read before the lock is taken, so whether |s| is still in
+ * the heap is checked again under the lock. */
+static void ssl_session_cache_rekey(SSL_SESSION *s)
+	{
+	SSL_CTX *ctx = s->cache_ctx;
+	SSL_SESS_CACHE_PART part;
+	SSL_SESS_HEAP *h;
+	unsigned long i;
+
+	if (ctx == NULL || s->session_id_length == 0)
+		return;
+	ssl_session_cache_find_part(ctx, s, &part);
+	CRYPTO_w_lock(part.lock);
+	h = part.heap;
+	i = s->cache_heap_idx;
+	if (s->cache_ctx == ctx && i < h->num && h->ent[i].sess == s)
+		{
+		h->ent[i].expire = ssl_session_expire_time(s);
+		ssl_session_heap_sift_down(h, i);
+		ssl_session_heap_sift_up(h, s->cache_heap_idx);
+		ssl_session_heap_update(h);
+		}
+	CRYPTO_w_unlock(part.lock);
+	}
+
+/* Selects the shard of a sharded session cache holding session ID |s|. The
+ * lhash already buckets on the leading bytes of the ID, so mix in all of it
+ * to keep the shards and the buckets within each shard independent. */
+static unsigned int ssl_session_shard_index(const SSL_SESSION *s)
+	{
+	unsigned int i, h = 0;
+
+	for (i = 0; i < s->session_id_length; i++)
+		h = h * 31 + s->session_id[i];
+	return h % SSL_SESS_NUM_SHARDS;
+	}
+
+unsigned int ssl_session_cache_num_parts(const SSL_CTX *ctx)
+	{
+	return ctx->session_shards != NULL ? SSL_SESS_NUM_SHARDS : 1;
+	}
+
+void ssl_session_cache_get_part(SSL_CTX *ctx, unsigned int idx,
+				SSL_SESS_CACHE_PART *part)
+	{
+	SSL_SESS_SHARD *shard;
+
+	if (ctx->session_shards == NULL)
+		{
+		part->sessions = ctx->sessions;
+		part->head = &ctx->session_cache_head;
+		part->tail = &ctx->session_cache_tail;
+		part->heap = ctx->session_heap;
+		part->max = ctx->session_cache_size;
+		part->cache_full = &ctx->stats.sess_cache_full;
+		part->lock = CRYPTO_LOCK_SSL_CTX;
+		return;
+		}
+	shard = &ctx->session_shards[idx];
+	part->sessions = shard->sessions;
+	part->head = &shard->session_cache_head;
+	part->tail = &shard->session_cache_tail;
+	part->heap = &shard->heap;
+	/* Spread the size limit evenly, rounding up so that a non-zero
+	 * limit never becomes unlimited. */
+	part->max = (ctx->session_cache_size + SSL_SESS_NUM_SHARDS - 1) /
+			SSL_SESS_NUM_SHARDS;
+	part->cache_full = &shard->cache_full;
+	part->lock = CRYPTO_LOCK_SSL_SESS_SHARD + idx;
+	}
+
+void ssl_session_cache_find_part(SSL_CTX *ctx, const SSL_SESSION *s,
+				 SSL_SESS_CACHE_PART *part)
+	{
+	ssl_session_cache_get_part(ctx, ctx->session_shards != NULL ?
+				   ssl_session_shard_index(s) : 0, part);
+	}
+
+long ssl_session_cache_num_items(SSL_CTX *ctx)
+	{
+	unsigned int i;
+	long ret = 0;
+
+	if (ctx->session_shards == NULL)
+		return lh_SSL_SESSION_num_items(ctx->sessions);
+	for (i = 0; i < SSL_SESS_NUM_SHARDS; i++)
+		ret += lh_SSL_SESSION_num_items(ctx->session_shards[i].sessions);
+	return ret;
+	}
+
+/* The sessions removed from a full cache, counted per shard under the lock
+ * of each shard. The count of the unsharded cache carries those of shards
+ * that were dropped. */
+long ssl_session_cache_num_full(SSL_CTX *ctx)
+	{
+	unsigned int i;
+	long ret = ctx->stats.sess_cache_full;
+
+	if (ctx->session_shards != NULL)
+		{
+		for (i = 0; i < SSL_SESS_NUM_SHARDS; i++)
+			ret += ctx->session_shards[i].cache_full;
+		}
+	return ret;
+	}
+
+static void snapshot_clear_doall_arg(SSL_SESSION *s,
+				     LHASH_OF(SSL_SESSION) *snapshot)
+	{
+	(void)lh_SSL_SESSION_delete(snapshot, s);
+	SSL_SESSION_free(s);
+	}
+
+static IMPLEMENT_LHASH_DOALL_ARG_FN(snapshot_clear, SSL_SESSION,
+				    LHASH_OF(SSL_SESSION))
+
+/* Empties the copy of a sharded cache that ctx->sessions holds for
+ * SSL_CTX_sessions(); CRYPTO_LOCK_SSL_CTX must be held. */
+static void ssl_session_cache_clear_snapshot(SSL_CTX *ctx)
+	{
+	unsigned long i;
+
+	i=CHECKED_LHASH_OF(SSL_SESSION, ctx->sessions)->down_load;
+	CHECKED_LHASH_OF(SSL_SESSION, ctx->sessions)->down_load=0;
+	lh_SSL_SESSION_doall_arg(ctx->sessions,
+		LHASH_DOALL_ARG_FN(snapshot_clear), LHASH_OF(SSL_SESSION),
+		ctx->sessions);
+	CHECKED_LHASH_OF(SSL_SESSION, ctx->sessions)->down_load=i;
+	}
+
+static void snapshot_add_doall_arg(SSL_SESSION *s,
+				   LHASH_OF(SSL_SESSION) *snapshot)
+	{
+	CRYPTO_add(&s->references, 1, CRYPTO_LOCK_SSL_SESSION);
+	(void)lh_SSL_SESSION_insert(snapshot, s);
+	if (lh_SSL_SESSION_error(snapshot))
+		SSL_SESSION_free(s);
+	}
+
+static IMPLEMENT_LHASH_DOALL_ARG_FN(snapshot_add, SSL_SESSION,
+				    LHASH_OF(SSL_SESSION))
+
+/* Refills ctx->sessions, which a sharded cache does not use, with the
+ * sessions of all shards for SSL_CTX_sessions(). Each session in it holds
+ * a reference until the next snapshot or flush, so the table stays safe to
+ * walk while the shards change; CRYPTO_LOCK_SSL_CTX must be held. */
+void ssl_session_cache_snapshot(SSL_CTX *ctx)
+	{
+	SSL_SESS_CACHE_PART part;
+	unsigned int n;
+
+	ssl_session_cache_clear_snapshot(ctx);
+	for (n = 0; n < SSL_SESS_NUM_SHARDS; n++)
+		{
+		ssl_session_cache_get_part(ctx, n, &part);
+		CRYPTO_r_lock(part.lock);
+		lh_SSL_SESSION_doall_arg(part.sessions,
+			LHASH_DOALL_ARG_FN(snapshot_add),
+			LHASH_OF(SSL_SESSION), ctx->sessions);
+		CRYPTO_r_unlock(part.lock);
+		}
 	}
 
 int ssl_clear_bad_session(SSL *s)
@@ -992,30 +1395,31 @@ int ssl_clear_bad_session(SSL *s)
 		return(0);
 	}
 
-/* locked by SSL_CTX in the calling function */
-static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s)
+/* locked by the cache part's lock in the calling function */
+static void SSL_SESSION_list_remove(SSL_SESS_CACHE_PART *part,
+				    SSL_SESSION *s)
 	{
 	if ((s->next == NULL) || (s->prev == NULL)) return;
 
-	if (s->next == (SSL_SESSION *)&(ctx->session_cache_tail))
+	if (s->next == (SSL_SESSION *)part->tail)
 		{ /* last element in list */
-		if (s->prev == (SSL_SESSION *)&(ctx->session_cache_head))
+		if (s->prev == (SSL_SESSION *)part->head)
 			{ /* only one element in list */
-			ctx->session_cache_head=NULL;
-			ctx->session_cache_tail=NULL;
+			*part->head=NULL;
+			*part->tail=NULL;
 			}
 		else
 			{
-			ctx->session_cache_tail=s->prev;
-			s->prev->next=(SSL_SESSION *)&(ctx->session_cache_tail);
+			*part->tail=s->prev;
+			s->prev->next=(SSL_SESSION *)part->tail;
 			}
 		}
 	else
 		{
-		if (s->prev == (SSL_SESSION *)&(ctx->session_cache_head))
+		if (s->prev == (SSL_SESSION *)part->head)
 			{ /* first element in list */
-			ctx->session_cache_head=s->next;
-			s->next->prev=(SSL_SESSION *)&(ctx->session_cache_head);
+			*part->head=s->next;
+			s->next->prev=(SSL_SESSION *)part->head;
 			}
 		else
 			{ /* middle of list */
@@ -1026,24 +1430,24 @@ static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s)
 	s->prev=s->next=NULL;
 	}
 
-static void SSL_SESSION_list_add(SSL_CTX *ctx, SSL_SESSION *s)
+static void SSL_SESSION_list_add(SSL_SESS_CACHE_PART *part, SSL_SESSION *s)
 	{
 	if ((s->next != NULL) && (s->prev != NULL))
-		SSL_SESSION_list_remove(ctx,s);
+		SSL_SESSION_list_remove(part,s);
 
-	if (ctx->session_cache_head == NULL)
+	if (*part->head == NULL)
 		{
-		ctx->session_cache_head=s;
-		ctx->session_cache_tail=s;
-		s->prev=(SSL_SESSION *)&(ctx->session_cache_head);
-		s->next=(SSL_SESSION *)&(ctx->session_cache_tail);
+		*part->head=s;
+		*part->tail=s;
+		s->prev=(SSL_SESSION *)part->head;
+		s->next=(SSL_SESSION *)part->tail;
 		}
 	else
 		{
-		s->next=ctx->session_cache_head;
+		s->next=*part->head;
 		s->next->prev=s;
-		s->prev=(SSL_SESSION *)&(ctx->session_cache_head);
-		ctx->session_cache_head=s;
+		s->prev=(SSL_SESSION *)part->head;
+		*part->head=s;
 		}
 	}
 
@@ -0,0 +1,532 @@
+/* ssl/ssl_shm.c */
+/* ====================================================================
+ * Copyright (c) 2014 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+
+/* A session cache kept in a shared memory segment, so that several
+ * processes, typically pre-forked workers of one server, can resume each
+ * other's sessions. It is hooked up to an SSL_CTX as an external cache
+ * through the new/get/remove session callbacks.
+ *
+ * The segment is a small header followed by a fixed number of buckets. A
+ * session ID hashes to one bucket, which holds SHM_SLOTS_PER_BUCKET slots
+ * of a fixed size and a spinlock holding the process ID of its owner, so
+ * that the lock of a process that died can be taken over. Within a bucket
+ * a slot is found by a linear scan, and a new session replaces a slot with
+ * the same ID, then a free or expired slot, and otherwise the slot closest
+ * to expiry. Sessions are stored in the compact encoding of ssl_bin.c,
+ * written straight into their slot. All integers in the segment but the
+ * locks are stored in network byte order, so a file backed cache can be
+ * shared by builds for different platforms. */
+
+#include <stdio.h>
+#include <limits.h>
+#include "ssl_locl.h"
+
+#if defined(OPENSSL_SYS_UNIX) && defined(__GNUC__) && \
+	!defined(OPENSSL_NO_SHM_SESS_CACHE)
+# define SHM_SESS_CACHE_SUPPORTED
+# include <sys/types.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <sched.h>
+# include <signal.h>
+# include <unistd.h>
+# ifndef MAP_ANONYMOUS
+#  define MAP_ANONYMOUS MAP_ANON
+# endif
+#endif
+
+#define SHM_MAGIC		"OSSLSHMC"
+#define SHM_VERSION		3
+#define SHM_HEADER_LEN		64
+#define SHM_READY_OFF		20	/* set once the header is written */
+#define SHM_READY_WAIT		1000	/* ms to wait for a new file */
+#define SHM_LOCK_LEN		64	/* keep locks on separate cache lines */
+#define SHM_SLOTS_PER_BUCKET	8
+#define SHM_SPINS		100000
+
+/* Slot layout:
+ *   id_len(1) pad(1) ssl_version(2) expire(4) data_len(4) id(32) pad(4)
+ *   data(max_sess_len)
+ * A slot with id_len 0 is free. */
+#define SHM_SLOT_HEADER_LEN	48
+#define SHM_SLOT_ID_OFF		12
+
+struct ssl_shm_sess_cache_st
+	{
+	unsigned char *base;
+	size_t size;
+	unsigned long num_buckets;
+	unsigned long slot_len;
+	unsigned long max_sess_len;
+	};
+
+#ifdef SHM_SESS_CACHE_SUPPORTED
+
+static size_t shm_bucket_len(const SSL_SHM_SESS_CACHE *c)
+	{
+	return SHM_LOCK_LEN + SHM_SLOTS_PER_BUCKET * c->slot_len;
+	}
+
+static unsigned char *shm_bucket(const SSL_SHM_SESS_CACHE *c,
+				 const unsigned char *id, unsigned int id_len)
+	{
+	unsigned long h = 0;
+	unsigned int i;
+
+	for (i = 0; i < id_len; i++)
+		h = h * 31 + id[i];
+	return c->base + SHM_HEADER_LEN + (h % c->num_buckets) *
+						shm_bucket_len(c);
+	}
+
+static unsigned char *shm_slot(const SSL_SHM_SESS_CACHE *c,
+			       unsigned char *bucket, int i)
+	{
+	return bucket + SHM_LOCK_LEN + i * c->slot_len;
+	}
+
+static int shm_owner_dead(int pid)
+	{
+	return kill((pid_t)pid, 0) != 0 && errno == ESRCH;
+	}
+
+/* Takes the bucket lock. The lock of a process that no longer exists is
+ * taken over, and the bucket, which that process may have left half
+ * written, is emptied. Otherwise the wait is bounded, as a cache may always
+ * miss: the owner may be stuck, or its process ID reused. */
+static int shm_lock(const SSL_SHM_SESS_CACHE *c, unsigned char *bucket)
+	{
+	volatile int *l = (volatile int *)bucket;
+	int i, j, owner, self = (int)getpid();
+
+	for (i = 0; i < SHM_SPINS; i++)
+		{
+		owner = *l;
+		if (owner == 0 && __sync_bool_compare_and_swap(l, 0, self))
+			return 1;
+		if ((i & 63) == 63)
+			{
+			if (owner > 0 && owner != self &&
+			    shm_owner_dead(owner) &&
+			    __sync_bool_compare_and_swap(l, owner, self))
+				{
+				for (j = 0; j < SHM_SLOTS_PER_BUCKET; j++)
+					shm_slot(c, bucket, j)[0] = 0;
+				return 1;
+				}
+			sched_yield();
+			}
+		}
+	return 0;
+	}
+
+static void shm_unlock(unsigned char *bucket)
+	{
+	__sync_lock_release((volatile int *)bucket);
+	}
+
+static int shm_slot_matches(const unsigned char *slot, int version,
+			    const unsigned char *id, unsigned int id_len)
+	{
+	return slot[0] == id_len && id_len != 0 &&
+		((slot[2] << 8) | slot[3]) == version &&
+		memcmp(slot + SHM_SLOT_ID_OFF, id, id_len) == 0;
+	}
+
+static unsigned long shm_slot_expire(const unsigned char *slot)
+	{
+	unsigned long l;
+
+	slot += 4;
+	n2l(slot, l);
+	return l;
+	}
+
+/* Finds the slot holding the given session in a locked bucket. */
+static unsigned char *shm_find(const SSL_SHM_SESS_CACHE *c,
+			       unsigned char *bucket, int version,
+			       const unsigned char *id, unsigned int id_len)
+	{
+	int i;
+
+	for (i = 0; i < SHM_SLOTS_PER_BUCKET; i++)
+		{
+		unsigned char *slot = shm_slot(c, bucket, i);
+
+		if (shm_slot_matches(slot, version, id, id_len))
+			return slot;
+		}
+	return NULL;
+	}
+
+static int shm_sess_new_cb(SSL *s, SSL_SESSION *sess)
+	{
+	SSL_SHM_SESS_CACHE *c = s->session_ctx->shm_sess_cache;
+	unsigned char *p, *bucket, *slot, *victim = NULL;
+	unsigned long now = (unsigned long)time(NULL), expire, l;
+	int i, len;
+
+	if (c == NULL || sess->session_id_length == 0)
+		return 0;
+	len = SSL_SESSION_encode_compact(sess, NULL, 0);
+	if (len <= 0 || (unsigned long)len > c->max_sess_len)
+		return 0;
+
+	if (sess->timeout <= 0)
+		expire = (unsigned long)sess->time;
+	else if ((unsigned long)sess->time + sess->timeout > 0xffffffffUL)
+		expire = 0xffffffffUL;
+	else
+		expire = (unsigned long)sess->time + sess->timeout;
+
+	bucket = shm_bucket(c, sess->session_id, sess->session_id_length);
+	if (!shm_lock(c, bucket))
+		return 0;
+	for (i = 0; i < SHM_SLOTS_PER_BUCKET; i++)
+		{
+		slot = shm_slot(c, bucket, i);
+		if (shm_slot_matches(slot, sess->ssl_version,
+				     sess->session_id,
+				     sess->session_id_length) ||
+		    slot[0] == 0)
+			{
+			victim = slot;
+			break;
+			}
+		if (victim == NULL ||
+		    shm_slot_expire(slot) < shm_slot_expire(victim))
+			victim = slot;
+		}
+	/* A free or expired slot is as good as the matching one, and evicting
+	 * the one closest to expiry is the best that can be done otherwise. */
+	if (victim[0] != 0 && shm_slot_expire(victim) < now)
+		victim[0] = 0;
+	p = victim;
+	*(p++) = (unsigned char)sess->session_id_length;
+	*(p++) = 0;
+	s2n(sess->ssl_version, p);
+	l2n(expire, p);
+	l = len;
+	l2n(l, p);
+	memcpy(p, sess->session_id, sess->session_id_length);
+	/* Encoded in place, the slot is large enough for max_sess_len */
+	SSL_SESSION_encode_compact(sess, victim + SHM_SLOT_HEADER_LEN, len);
+	shm_unlock(bucket);
+
+	/* The cache holds an encoding, not a reference */
+	return 0;
+	}
+
+static SSL_SESSION *shm_sess_get_cb(SSL *s, unsigned char *id, int id_len,
+				    int *copy)
+	{
+	SSL_SHM_SESS_CACHE *c = s->session_ctx->shm_sess_cache;
+	unsigned char *buf = NULL, *bucket, *slot;
+	const unsigned char *p;
+	unsigned long len = 0;
+	SSL_SESSION *ret = NULL;
+
+	*copy = 0;
+	if (c == NULL || id_len <= 0 || id_len > SSL_MAX_SSL_SESSION_ID_LENGTH)
+		return NULL;
+	bucket = shm_bucket(c, id, id_len);
+	if (!shm_lock(c, bucket))
+		return NULL;
+	slot = shm_find(c, bucket, s->version, id, id_len);
+	if (slot != NULL &&
+	    shm_slot_expire(slot) < (unsigned long)time(NULL))
+		{
+		slot[0] = 0;
+		slot = NULL;
+		}
+	if (slot != NULL)
+		{
+		p = slot + 8;
+		n2l(p, len);
+		if (len > c->max_sess_len ||
+		    (buf = OPENSSL_malloc(len)) == NULL)
+			len = 0;
+		else
+			memcpy(buf, slot + SHM_SLOT_HEADER_LEN, len);
+		}
+	shm_unlock(bucket);
+
+	if (buf != NULL)
+		{
+		ret = SSL_SESSION_decode_compact(NULL, buf, len);
+		OPENSSL_free(buf);
+		}
+	return ret;
+	}
+
+static void shm_sess_remove_cb(SSL_CTX *ctx, SSL_SESSION *sess)
+	{
+	SSL_SHM_SESS_CACHE *c = ctx->shm_sess_cache;
+	unsigned char *bucket, *slot;
+
+	if (c == NULL || sess->session_id_length == 0)
+		return;
+	bucket = shm_bucket(c, sess->session_id, sess->session_id_length);
+	if (!shm_lock(c, bucket))
+		return;
+	slot = shm_find(c, bucket, sess->ssl_version, sess->session_id,
+			sess->session_id_length);
+	if (slot != NULL)
+		slot[0] = 0;
+	shm_unlock(bucket);
+	}
+
+/* Writes the header describing the cache geometry to a new segment */
+static void shm_init_header(SSL_SHM_SESS_CACHE *c)
+	{
+	unsigned char *p = c->base + sizeof(SHM_MAGIC) - 1;
+	unsigned long l;
+
+	l = SHM_VERSION;
+	l2n(l, p);
+	l2n(c->num_buckets, p);
+	l2n(c->max_sess_len, p);
+	memcpy(c->base, SHM_MAGIC, sizeof(SHM_MAGIC) - 1);
+	/* The ready flag goes last so a half initialised file is not used */
+	__sync_synchronize();
+	*(volatile unsigned char *)(c->base + SHM_READY_OFF) = 1;
+	}
+
+/* Waits for the process that created the file of the cache to finish
+ * writing its header */
+static int shm_wait_header(const SSL_SHM_SESS_CACHE *c)
+	{
+	int i;
+
+	for (i = 0; i < SHM_READY_WAIT; i++)
+		{
+		if (*(volatile unsigned char *)(c->base + SHM_READY_OFF))
+			{
+			__sync_synchronize();
+			return 1;
+			}
+		usleep(1000);
+		}
+	return 0;
+	}
+
+static int shm_check_header(const SSL_SHM_SESS_CACHE *c)
+	{
+	const unsigned char *p = c->base + sizeof(SHM_MAGIC) - 1;
+	unsigned long version, num_buckets, max_sess_len;
+
+	if (memcmp(c->base, SHM_MAGIC, sizeof(SHM_MAGIC) - 1) != 0)
+		return 0;
+	n2l(p, version);
+	n2l(p, num_buckets);
+	n2l(p, max_sess_len);
+	return version == SHM_VERSION && num_buckets == c->num_buckets &&
+		max_sess_len == c->max_sess_len;
+	}
+
+#endif /* SHM_SESS_CACHE_SUPPORTED */
+
+SSL_SHM_SESS_CACHE *SSL_SHM_SESS_CACHE_new(const char *file,
+					    unsigned long num_sessions,
+					    unsigned long max_sess_len)
+	{
+#ifdef SHM_SESS_CACHE_SUPPORTED
+	SSL_SHM_SESS_CACHE *c;
+	struct stat st;
+	int fd = -1, created = 0, i;
+	void *base;
+
+	if (max_sess_len == 0)
+		max_sess_len = SSL_SHM_SESS_CACHE_DEFAULT_SESS_LEN;
+	if (num_sessions == 0 || max_sess_len > 0xffffUL)
+		{
+		SSLerr(SSL_F_SSL_SHM_SESS_CACHE_NEW, SSL_R_BAD_VALUE);
+		return NULL;
+		}
+	c = OPENSSL_malloc(sizeof(*c));
+	if (c == NULL)
+		{
+		SSLerr(SSL_F_SSL_SHM_SESS_CACHE_NEW, ERR_R_MALLOC_FAILURE);
+		return NULL;
+		}
+	c->max_sess_len = max_sess_len;
+	c->slot_len = (SHM_SLOT_HEADER_LEN + max_sess_len + 7) & ~7UL;
+	c->num_buckets = (num_sessions + SHM_SLOTS_PER_BUCKET - 1) /
+				SHM_SLOTS_PER_BUCKET;
+	if (c->num_buckets > (((size_t)-1) - SHM_HEADER_LEN) /
+				shm_bucket_len(c))
+		{
+		SSLerr(SSL_F_SSL_SHM_SESS_CACHE_NEW, SSL_R_BAD_VALUE);
+		OPENSSL_free(c);
+		return NULL;
+		}
+	c->size = SHM_HEADER_LEN + c->num_buckets * shm_bucket_len(c);
+
+	if (file == NULL)
+		{
+		/* Shared with the children forked after this point */
+		base = mmap(NULL, c->size, PROT_READ|PROT_WRITE,
+			    MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+		created = 1;
+		}
+	else
+		{
+		fd = open(file, O_RDWR|O_CREAT|O_EXCL, 0600);
+		if (fd >= 0)
+			created = 1;
+		else if (errno == EEXIST)
+			fd = open(file, O_RDWR);
+		if (fd < 0)
+			goto syserr;
+		if (created && ftruncate(fd, c->size) != 0)
+			goto syserr;
+		if (fstat(fd, &st) != 0)
+			goto syserr;
+		/* The file may have been created but not yet sized */
+		for (i = 0; st.st_size == 0 && i < SHM_READY_WAIT; i++)
+			{
+			usleep(1000);
+			if (fstat(fd, &st) != 0)
+				goto syserr;
+			}
+		if ((size_t)st.st_size != c->size)
+			{
+			SSLerr(SSL_F_SSL_SHM_SESS_CACHE_NEW,
+			       SSL_R_BAD_SHM_SESS_CACHE_FILE);
+			goto err;
+			}
+		base = mmap(NULL, c->size, PROT_READ|PROT_WRITE,
+			    MAP_SHARED, fd, 0);
+		close(fd);
+		fd = -1;
+		}
+	if (base == MAP_FAILED)
+		goto syserr;
+	c->base = base;
+
+	if (created)
+		shm_init_header(c);
+	else if (!shm_wait_header(c) || !shm_check_header(c))
+		{
+		SSLerr(SSL_F_SSL_SHM_SESS_CACHE_NEW,
+		       SSL_R_BAD_SHM_SESS_CACHE_FILE);
+		munmap(c->base, c->size);
+		goto err;
+		}
+	return c;
+
+ syserr:
+	SSLerr(SSL_F_SSL_SHM_SESS_CACHE_NEW, ERR_R_SYS_LIB);
+ err:
+	if (fd >= 0)
+		close(fd);
+	OPENSSL_free(c);
+	return NULL;
+#else
+	SSLerr(SSL_F_SSL_SHM_SESS_CACHE_NEW,
+	       SSL_R_SHM_SESS_CACHE_NOT_SUPPORTED);
+	return NULL;
+#endif
+	}
+
+void SSL_SHM_SESS_CACHE_free(SSL_SHM_SESS_CACHE *c)
+	{
+	if (c == NULL)
+		return;
+#ifdef SHM_SESS_CACHE_SUPPORTED
+	munmap(c->base, c->size);
+#endif
+	OPENSSL_free(c);
+	}
+
+int SSL_CTX_set_shm_session_cache(SSL_CTX *ctx, SSL_SHM_SESS_CACHE *c)
+	{
+#ifdef SHM_SESS_CACHE_SUPPORTED
+	if (c == NULL)
+		{
+		/* Only clear the callbacks set for the cache */
+		ctx->shm_sess_cache = NULL;
+		if (ctx->new_session_cb == shm_sess_new_cb)
+			SSL_CTX_sess_set_new_cb(ctx, NULL);
+		if (ctx->get_session_cb == shm_sess_get_cb)
+			SSL_CTX_sess_set_get_cb(ctx, NULL);
+		if (ctx->remove_session_cb == shm_sess_remove_cb)
+			SSL_CTX_sess_set_remove_cb(ctx, NULL);
+		return 1;
+		}
+	if ((ctx->new_session_cb != NULL &&
+	     ctx->new_session_cb != shm_sess_new_cb) ||
+	    (ctx->get_session_cb != NULL &&
+	     ctx->get_session_cb != shm_sess_get_cb) ||
+	    (ctx->remove_session_cb != NULL &&
+	     ctx->remove_session_cb != shm_sess_remove_cb))
+		{
+		SSLerr(SSL_F_SSL_CTX_SET_SHM_SESSION_CACHE,
+		       SSL_R_SESSION_CALLBACKS_ALREADY_SET);
+		return 0;
+		}
+	ctx->shm_sess_cache = c;
+	SSL_CTX_sess_set_new_cb(ctx, shm_sess_new_cb);
+	SSL_CTX_sess_set_get_cb(ctx, shm_sess_get_cb);
+	SSL_CTX_sess_set_remove_cb(ctx, shm_sess_remove_cb);
+	return 1;
+#else
+	SSLerr(SSL_F_SSL_CTX_SET_SHM_SESSION_CACHE,
+	       SSL_R_SHM_SESS_CACHE_NOT_SUPPORTED);
+	return 0;
+#endif
+	}
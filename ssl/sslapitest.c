@@ -0,0 +1,3006 @@
+/* ssl/sslapitest.c */
+/* Tests of SSL library interfaces that ssltest does not exercise:
+ *
+ *   sslapitest [-cert file] [-cert2 file] [-n iterations] [test ...]
+ *
+ * Each test group is named in the table at the end and runs all its cases;
+ * without names all groups are run but the benchmarks, which print timings
+ * and are run only when named.  -n sets their number of iterations. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <openssl/crypto.h>
+#include <openssl/bio.h>
+#include <openssl/buffer.h>
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/rand.h>
+#include <openssl/x509.h>
+#ifndef OPENSSL_NO_EC
+#include <openssl/ec.h>
+#endif
+#include <openssl/ssl.h>
+
+#define TEST_CERT "../apps/server.pem"
+#define TEST_CERT2 "../apps/server2.pem"
+
+static const char *cert_file = TEST_CERT;
+static const char *cert2_file = TEST_CERT2;
+
+/* Iterations of each benchmark, 0 for its own default */
+static int bench_n = 0;
+
+/* Allocations made through OPENSSL_malloc() and OPENSSL_realloc(), and
+ * the bytes allocated and not yet freed: each block carries its size in
+ * front of it */
+static unsigned long num_allocs = 0;
+static size_t mem_live = 0;
+
+typedef union
+	{
+	size_t len;
+	double align_d;
+	void *align_p;
+	} MEM_HEADER;
+
+static void *count_malloc(size_t len)
+	{
+	MEM_HEADER *h;
+
+	num_allocs++;
+	if ((h = malloc(sizeof(*h) + len)) == NULL)
+		return NULL;
+	h->len = len;
+	mem_live += len;
+	return h + 1;
+	}
+
+static void *count_realloc(void *p, size_t len)
+	{
+	MEM_HEADER *h;
+	size_t old;
+
+	if (p == NULL)
+		return count_malloc(len);
+	num_allocs++;
+	h = (MEM_HEADER *)p - 1;
+	old = h->len;
+	if ((h = realloc(h, sizeof(*h) + len)) == NULL)
+		return NULL;
+	h->len = len;
+	mem_live += len - old;
+	return h + 1;
+	}
+
+static void count_free(void *p)
+	{
+	MEM_HEADER *h;
+
+	if (p == NULL)
+		return;
+	h = (MEM_HEADER *)p - 1;
+	mem_live -= h->len;
+	free(h);
+	}
+
+static X509 *read_cert(const char *file)
+	{
+	X509 *x = NULL;
+	BIO *in;
+
+	if ((in = BIO_new_file(file, "r")) != NULL)
+		{
+		x = PEM_read_bio_X509(in, NULL, NULL, NULL);
+		BIO_free(in);
+		}
+	if (x == NULL)
+		{
+		fprintf(stderr, "cannot read certificate from %s\n", file);
+		ERR_print_errors_fp(stderr);
+		}
+	return x;
+	}
+
+/* Connections between a client and a server in memory */
+
+/* Server name the client sends, if not NULL */
+static const char *servername;
+
+static int is_retry(SSL *s, int r)
+	{
+	int e = SSL_get_error(s, r);
+
+	return e == SSL_ERROR_WANT_READ || e == SSL_ERROR_WANT_WRITE;
+	}
+
+/* Moves all |from| has written to |to| */
+static int shuttle(BIO *from, BIO *to)
+	{
+	char buf[4096];
+	long len = BIO_ctrl_pending(from), n;
+
+	while (len > 0)
+		{
+		n = BIO_read(from, buf, len < (long)sizeof(buf) ?
+			     (int)len : (int)sizeof(buf));
+		if (n <= 0 || BIO_write(to, buf, n) != n)
+			return 0;
+		len -= n;
+		}
+	return 1;
+	}
+
+/* Makes a server and, unless |c_ctx| is NULL, a client context */
+static int new_ctxs(SSL_CTX **s_ctx, SSL_CTX **c_ctx)
+	{
+	*s_ctx = SSL_CTX_new(SSLv23_server_method());
+	if (c_ctx != NULL)
+		*c_ctx = SSL_CTX_new(SSLv23_client_method());
+	if (*s_ctx == NULL || (c_ctx != NULL && *c_ctx == NULL) ||
+	    !SSL_CTX_use_certificate_file(*s_ctx, cert_file, SSL_FILETYPE_PEM) ||
+	    !SSL_CTX_use_PrivateKey_file(*s_ctx, cert_file, SSL_FILETYPE_PEM))
+		{
+		fprintf(stderr, "cannot set up contexts with %s\n", cert_file);
+		ERR_print_errors_fp(stderr);
+		return 0;
+		}
+	return 1;
+	}
+
+static void free_ctxs(SSL_CTX *s_ctx, SSL_CTX *c_ctx)
+	{
+	if (s_ctx != NULL)
+		SSL_CTX_free(s_ctx);
+	if (c_ctx != NULL)
+		SSL_CTX_free(c_ctx);
+	}
+
+static void free_pair(SSL *s, SSL *c)
+	{
+	if (s != NULL)
+		SSL_free(s);
+	if (c != NULL)
+		SSL_free(c);
+	}
+
+/* The memory BIO |s| writes to, even during a handshake when
+ * SSL_get_wbio() returns a buffering BIO in front of it */
+static BIO *mem_wbio(SSL *s)
+	{
+	return BIO_find_type(SSL_get_wbio(s), BIO_TYPE_MEM);
+	}
+
+/* Makes a client and a server, each with a memory BIO in each direction,
+ * ready to connect */
+static int new_pair(SSL_CTX *s_ctx, SSL_CTX *c_ctx, SSL **s_out,
+		    SSL **c_out)
+	{
+	SSL *s, *c;
+	BIO *s_in, *s_out_bio, *c_in, *c_out_bio;
+
+	*s_out = s = SSL_new(s_ctx);
+	*c_out = c = SSL_new(c_ctx);
+	s_in = BIO_new(BIO_s_mem());
+	s_out_bio = BIO_new(BIO_s_mem());
+	c_in = BIO_new(BIO_s_mem());
+	c_out_bio = BIO_new(BIO_s_mem());
+	if (s == NULL || c == NULL || s_in == NULL || s_out_bio == NULL ||
+	    c_in == NULL || c_out_bio == NULL)
+		{
+		if (s_in != NULL)
+			BIO_free(s_in);
+		if (s_out_bio != NULL)
+			BIO_free(s_out_bio);
+		if (c_in != NULL)
+			BIO_free(c_in);
+		if (c_out_bio != NULL)
+			BIO_free(c_out_bio);
+		return 0;
+		}
+	SSL_set_bio(s, s_in, s_out_bio);
+	SSL_set_bio(c, c_in, c_out_bio);
+#ifndef OPENSSL_NO_TLSEXT
+	if (servername != NULL && !SSL_set_tlsext_host_name(c, servername))
+		return 0;
+#endif
+	SSL_set_accept_state(s);
+	SSL_set_connect_state(c);
+	return 1;
+	}
+
+/* Runs the handshake of a pair made by new_pair(). Alerts are passed on
+ * before a failed end stops the handshake. */
+static int handshake_pair(SSL *s, SSL *c)
+	{
+	int i, rs = 0, rc = 0;
+
+	for (i = 0; i < 100 && (rs <= 0 || rc <= 0); i++)
+		{
+		if (rc <= 0 && (rc = SSL_do_handshake(c)) <= 0 &&
+		    !is_retry(c, rc))
+			{
+			shuttle(mem_wbio(c), SSL_get_rbio(s));
+			SSL_do_handshake(s);
+			break;
+			}
+		if (!shuttle(mem_wbio(c), SSL_get_rbio(s)))
+			break;
+		if (rs <= 0 && (rs = SSL_do_handshake(s)) <= 0 &&
+		    !is_retry(s, rs))
+			{
+			shuttle(mem_wbio(s), SSL_get_rbio(c));
+			SSL_do_handshake(c);
+			break;
+			}
+		if (!shuttle(mem_wbio(s), SSL_get_rbio(c)))
+			break;
+		}
+	return rs > 0 && rc > 0;
+	}
+
+/* Connects a client and a server over memory BIOs. Once connected
+ * SSL_get_wbio() returns the memory BIO rather than the buffering BIO
+ * used during the handshake. */
+static int connect_pair(SSL_CTX *s_ctx, SSL_CTX *c_ctx, SSL **s_out,
+			SSL **c_out)
+	{
+	return new_pair(s_ctx, c_ctx, s_out, c_out) &&
+		handshake_pair(*s_out, *c_out);
+	}
+
+/* Reads |len| bytes on |s| of what |c| has written */
+static int receive(SSL *s, SSL *c, unsigned char *buf, int len)
+	{
+	int n, r;
+
+	if (!shuttle(SSL_get_wbio(c), SSL_get_rbio(s)))
+		return 0;
+	for (n = 0; n < len; n += r)
+		{
+		if ((r = SSL_read(s, buf + n, len - n)) <= 0)
+			return 0;
+		}
+	return 1;
+	}
+
+/* Compact session encoding */
+
+static SSL_SESSION *make_session(X509 *peer)
+	{
+	SSL_SESSION *s = SSL_SESSION_new();
+
+	if (s == NULL)
+		return NULL;
+	s->ssl_version = TLS1_2_VERSION;
+	s->cipher_id = 0x0300C02FL;
+	s->master_key_length = SSL_MAX_MASTER_KEY_LENGTH;
+	RAND_pseudo_bytes(s->master_key, s->master_key_length);
+	s->session_id_length = SSL3_SSL_SESSION_ID_LENGTH;
+	RAND_pseudo_bytes(s->session_id, s->session_id_length);
+	SSL_SESSION_set1_id_context(s, (unsigned char *)"sslapitest", 10);
+	s->time = (long)time(NULL);
+	s->timeout = 300;
+	s->verify_result = X509_V_OK;
+#ifndef OPENSSL_NO_TLSEXT
+	s->tlsext_hostname = BUF_strdup("www.example.com");
+	s->tlsext_tick_lifetime_hint = 300;
+#endif
+	if (peer != NULL)
+		{
+		CRYPTO_add(&peer->references, 1, CRYPTO_LOCK_X509);
+		s->peer = peer;
+		}
+	return s;
+	}
+
+/* Two sessions are taken to be the same if their ASN.1 encodings are */
+static int same_session(SSL_SESSION *a, SSL_SESSION *b)
+	{
+	unsigned char *da, *db, *p;
+	int la, lb, ret;
+
+	la = i2d_SSL_SESSION(a, NULL);
+	lb = i2d_SSL_SESSION(b, NULL);
+	if (la <= 0 || la != lb)
+		return 0;
+	da = OPENSSL_malloc(la);
+	db = OPENSSL_malloc(lb);
+	p = da;
+	i2d_SSL_SESSION(a, &p);
+	p = db;
+	i2d_SSL_SESSION(b, &p);
+	ret = memcmp(da, db, la) == 0;
+	OPENSSL_free(da);
+	OPENSSL_free(db);
+	return ret;
+	}
+
+static int test_session_encoding(const char *name, SSL_SESSION *s)
+	{
+	unsigned char buf[8192];
+	SSL_SESSION *t = NULL;
+	unsigned long allocs;
+	int len, i, errors = 0;
+
+	len = SSL_SESSION_encode_compact(s, NULL, 0);
+	if (len <= 0 || len > (int)sizeof(buf) ||
+	    SSL_SESSION_encode_compact(s, buf, len) != len)
+		{
+		fprintf(stderr, "%s: encoding failed\n", name);
+		return 1;
+		}
+	if (SSL_SESSION_encode_compact(s, buf, len - 1) != 0)
+		{
+		fprintf(stderr, "%s: short buffer accepted\n", name);
+		errors++;
+		}
+	ERR_clear_error();
+
+	if (SSL_SESSION_decode_compact(&t, buf, len) == NULL ||
+	    !same_session(s, t))
+		{
+		fprintf(stderr, "%s: round trip failed\n", name);
+		errors++;
+		}
+
+	/* Decoding into the same session again needs no allocation unless
+	 * there is a certificate to decode */
+	allocs = num_allocs;
+	if (SSL_SESSION_decode_compact(&t, buf, len) == NULL ||
+	    SSL_SESSION_encode_compact(t, buf, len) != len)
+		{
+		fprintf(stderr, "%s: second round trip failed\n", name);
+		errors++;
+		}
+	if (s->peer == NULL && num_allocs != allocs)
+		{
+		fprintf(stderr, "%s: %lu allocations decoding in place\n",
+			name, num_allocs - allocs);
+		errors++;
+		}
+	if (t != NULL)
+		SSL_SESSION_free(t);
+
+	/* Every truncation must be rejected */
+	for (i = 0; i < len; i++)
+		{
+		t = SSL_SESSION_decode_compact(NULL, buf, i);
+		if (t != NULL)
+			{
+			fprintf(stderr, "%s: truncation to %d bytes accepted\n",
+				name, i);
+			SSL_SESSION_free(t);
+			errors++;
+			break;
+			}
+		}
+	buf[0] = 0x30;
+	if ((t = SSL_SESSION_decode_compact(NULL, buf, len)) != NULL)
+		{
+		fprintf(stderr, "%s: bad format version accepted\n", name);
+		SSL_SESSION_free(t);
+		errors++;
+		}
+	ERR_clear_error();
+
+	if (errors == 0)
+		printf("%s: compact encoding of %d bytes (DER %d bytes) ok\n",
+			name, len, i2d_SSL_SESSION(s, NULL));
+	return errors;
+	}
+
+static int test_sessenc(void)
+	{
+	SSL_SESSION *s;
+	X509 *peer;
+	int errors = 0;
+
+	if ((peer = read_cert(cert_file)) == NULL)
+		return 1;
+	if ((s = make_session(NULL)) == NULL)
+		errors++;
+	else
+		{
+		errors += test_session_encoding("session", s);
+		SSL_SESSION_free(s);
+		}
+	if ((s = make_session(peer)) == NULL)
+		errors++;
+	else
+		{
+		errors += test_session_encoding("session with peer", s);
+		SSL_SESSION_free(s);
+		}
+	X509_free(peer);
+	return errors;
+	}
+
+static void bench_report(const char *name, clock_t c, unsigned long allocs,
+			 int n)
+	{
+	printf("%-24s %10.1f ns/op %6.1f allocs/op\n", name,
+		(double)c / CLOCKS_PER_SEC * 1e9 / n, (double)allocs / n);
+	}
+
+/* Time and allocations of encoding and decoding |s| in both encodings */
+static void bench_session_encoding(const char *name, SSL_SESSION *s, int n)
+	{
+	unsigned char buf[8192], der[8192], *p;
+	const unsigned char *cp;
+	SSL_SESSION *t = NULL;
+	unsigned long allocs;
+	int i, len = 0, der_len = 0;
+	clock_t c;
+
+	printf("%s:\n", name);
+
+	allocs = num_allocs;
+	c = clock();
+	for (i = 0; i < n; i++)
+		{
+		p = der;
+		der_len = i2d_SSL_SESSION(s, NULL);
+		i2d_SSL_SESSION(s, &p);
+		}
+	bench_report("  i2d_SSL_SESSION", clock() - c, num_allocs - allocs, n);
+
+	allocs = num_allocs;
+	c = clock();
+	for (i = 0; i < n; i++)
+		{
+		cp = der;
+		t = d2i_SSL_SESSION(NULL, &cp, der_len);
+		SSL_SESSION_free(t);
+		}
+	bench_report("  d2i_SSL_SESSION", clock() - c, num_allocs - allocs, n);
+
+	allocs = num_allocs;
+	c = clock();
+	for (i = 0; i < n; i++)
+		len = SSL_SESSION_encode_compact(s, buf, sizeof(buf));
+	bench_report("  encode_compact", clock() - c, num_allocs - allocs, n);
+
+	allocs = num_allocs;
+	c = clock();
+	for (i = 0; i < n; i++)
+		{
+		t = SSL_SESSION_decode_compact(NULL, buf, len);
+		SSL_SESSION_free(t);
+		}
+	bench_report("  decode_compact", clock() - c, num_allocs - allocs, n);
+
+	t = NULL;
+	allocs = num_allocs;
+	c = clock();
+	for (i = 0; i < n; i++)
+		SSL_SESSION_decode_compact(&t, buf, len);
+	bench_report("  decode_compact reuse", clock() - c, num_allocs - allocs,
+		n);
+	SSL_SESSION_free(t);
+	}
+
+static int bench_sessenc(void)
+	{
+	SSL_SESSION *s;
+	X509 *peer;
+	int n = bench_n > 0 ? bench_n : 100000;
+
+	if ((peer = read_cert(cert_file)) == NULL)
+		return 1;
+	if ((s = make_session(NULL)) != NULL)
+		{
+		bench_session_encoding("session", s, n);
+		SSL_SESSION_free(s);
+		}
+	if ((s = make_session(peer)) != NULL)
+		{
+		bench_session_encoding("session with peer", s, n);
+		SSL_SESSION_free(s);
+		}
+	X509_free(peer);
+	return 0;
+	}
+
+/* SSL_writev() */
+
+/* Records and BIO writes made by the client while counting is on */
+static int counting = 0;
+static long num_records = 0, num_writes = 0;
+
+static void count_records(int write_p, int version, int content_type,
+			  const void *buf, size_t len, SSL *ssl, void *arg)
+	{
+	if (counting && write_p && content_type == SSL3_RT_HEADER)
+		num_records++;
+	}
+
+static long count_writes(BIO *b, int oper, const char *argp, int argi,
+			 long argl, long ret)
+	{
+	if (counting && oper == BIO_CB_WRITE)
+		num_writes++;
+	return ret;
+	}
+
+/* Splits |data| into buffers of awkward sizes, empty ones included */
+static int make_iov(SSL_IOVEC *iov, int max, const unsigned char *data,
+		    int total)
+	{
+	int n, off = 0, len;
+
+	for (n = 0; n < max - 1 && off < total; n++)
+		{
+		if (n == max / 2)
+			len = 40000;
+		else
+			len = (n * 37) % 257;
+		if (len > total - off)
+			len = total - off;
+		iov[n].base = data + off;
+		iov[n].len = len;
+		off += len;
+		}
+	iov[n].base = data + off;
+	iov[n].len = total - off;
+	return n + 1;
+	}
+
+/* Records are filled across buffer boundaries and up to eight of them are
+ * passed to the BIO at once */
+static int test_writev_records(const char *name, unsigned int frag)
+	{
+	static unsigned char data[200000], got[200000];
+	SSL_IOVEC iov[1000];
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	SSL *s = NULL, *c = NULL;
+	int iovcnt, total, errors = 0;
+	long records, writes;
+
+	RAND_pseudo_bytes(data, sizeof(data));
+	if (!new_ctxs(&s_ctx, &c_ctx))
+		return 1;
+	if (!connect_pair(s_ctx, c_ctx, &s, &c))
+		{
+		fprintf(stderr, "%s: handshake failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	SSL_set_msg_callback(c, count_records);
+	BIO_set_callback(SSL_get_wbio(c), count_writes);
+	if (frag != 0)
+		SSL_set_max_send_fragment(c, frag);
+	else
+		frag = SSL3_RT_MAX_PLAIN_LENGTH;
+
+	for (total = 0; total <= (int)sizeof(data); total += 37813)
+		{
+		iovcnt = make_iov(iov, sizeof(iov) / sizeof(iov[0]), data,
+				  total);
+		num_records = num_writes = 0;
+		counting = 1;
+		if (SSL_writev(c, iov, iovcnt) != total)
+			{
+			fprintf(stderr, "%s: %d bytes in %d buffers failed\n",
+				name, total, iovcnt);
+			ERR_print_errors_fp(stderr);
+			errors++;
+			break;
+			}
+		counting = 0;
+		if (!receive(s, c, got, total) || memcmp(got, data, total) != 0)
+			{
+			fprintf(stderr, "%s: %d bytes did not arrive\n", name,
+				total);
+			errors++;
+			break;
+			}
+
+		/* Every record but the last is full, and up to 8 records go
+		 * in one BIO write */
+		records = (total + frag - 1) / frag;
+		writes = (records + 7) / 8;
+		if (num_records != records || num_writes != writes)
+			{
+			fprintf(stderr, "%s: %d bytes took %ld records in %ld "
+				"writes, expected %ld in %ld\n", name, total,
+				num_records, num_writes, records, writes);
+			errors++;
+			}
+		}
+
+	/* Bad arguments */
+	if (SSL_writev(c, iov, -1) != -1 || SSL_writev(c, NULL, 1) != -1)
+		{
+		fprintf(stderr, "%s: bad arguments accepted\n", name);
+		errors++;
+		}
+	ERR_clear_error();
+
+	if (errors == 0)
+		printf("%s: ok\n", name);
+ end:
+	counting = 0;
+	free_pair(s, c);
+	free_ctxs(s_ctx, c_ctx);
+	return errors;
+	}
+
+static int test_writev(void)
+	{
+	return test_writev_records("writev", 0) +
+		test_writev_records("writev with small fragments", 512);
+	}
+
+/* SSL_MODE_READ_BATCH */
+
+/* The server reads ahead into a buffer for all the records the client
+ * sends, so that every record is buffered by the first SSL_read() */
+#define NUM_RECORDS 20
+#define RECORD_LEN 5000
+#define TOTAL (NUM_RECORDS * RECORD_LEN)
+
+static unsigned char rb_data[TOTAL], rb_got[TOTAL + 1];
+
+/* Moves the first |len| bytes |from| has written to |to| */
+static int shuttle_part(BIO *from, BIO *to, long len)
+	{
+	char buf[4096];
+	long n;
+
+	while (len > 0)
+		{
+		n = BIO_read(from, buf, len < (long)sizeof(buf) ?
+			     (int)len : (int)sizeof(buf));
+		if (n <= 0 || BIO_write(to, buf, n) != n)
+			return 0;
+		len -= n;
+		}
+	return 1;
+	}
+
+/* Sends |num| records of RECORD_LEN bytes from |c|, leaving them in the
+ * write BIO of |c| */
+static int send_records(SSL *c, int num)
+	{
+	int i;
+
+	for (i = 0; i < num; i++)
+		{
+		if (SSL_write(c, rb_data + i * RECORD_LEN, RECORD_LEN) !=
+		    RECORD_LEN)
+			return 0;
+		}
+	return 1;
+	}
+
+/* Length of the first |num| records, headers included, queued in |b| */
+static long records_len(BIO *b, int num)
+	{
+	unsigned char *p;
+	long len = BIO_get_mem_data(b, (char **)&p), off = 0;
+
+	while (num-- > 0 && off + 5 <= len)
+		off += 5 + (p[off + 3] << 8 | p[off + 4]);
+	return off;
+	}
+
+static int check_read(const char *name, SSL *s, int len, int expect,
+		      int expect_err, int off)
+	{
+	int r = SSL_read(s, rb_got + off, len), err = SSL_get_error(s, r);
+
+	if (r != expect || (r <= 0 && err != expect_err))
+		{
+		fprintf(stderr, "%s: SSL_read of %d at %d returned %d (error %d), "
+			"expected %d\n", name, len, off, r, err, expect);
+		ERR_print_errors_fp(stderr);
+		return 0;
+		}
+	if (r > 0 && memcmp(rb_got + off, rb_data + off, r) != 0)
+		{
+		fprintf(stderr, "%s: data corrupted\n", name);
+		return 0;
+		}
+	return 1;
+	}
+
+enum { RB_ALL, RB_SHORT_BUFFER, RB_ALERT, RB_INCOMPLETE, RB_BAD_RECORD,
+       RB_NO_BATCH };
+
+static int test_read_batch_case(const char *name, SSL_CTX *s_ctx,
+				SSL_CTX *c_ctx, int how)
+	{
+	SSL *s = NULL, *c = NULL;
+	BIO *c_out, *s_in;
+	long len;
+	unsigned char *p;
+	int i, ok = 0;
+
+	if (!connect_pair(s_ctx, c_ctx, &s, &c) ||
+	    !send_records(c, NUM_RECORDS))
+		{
+		fprintf(stderr, "%s: setup failed\n", name);
+		ERR_print_errors_fp(stderr);
+		goto end;
+		}
+	c_out = SSL_get_wbio(c);
+	s_in = SSL_get_rbio(s);
+
+	switch (how)
+		{
+	case RB_ALL:
+		/* Every record in one read */
+		ok = shuttle(c_out, s_in) &&
+			check_read(name, s, sizeof(rb_got), TOTAL, 0, 0) &&
+			check_read(name, s, sizeof(rb_got), -1,
+				   SSL_ERROR_WANT_READ, 0);
+		break;
+
+	case RB_SHORT_BUFFER:
+		/* Records are split across reads as the buffer allows */
+		ok = shuttle(c_out, s_in);
+		for (i = 0; ok && i < TOTAL; i += 12000)
+			ok = check_read(name, s, 12000,
+					TOTAL - i < 12000 ? TOTAL - i : 12000,
+					0, i);
+		break;
+
+	case RB_ALERT:
+		/* The batch ends at the close_notify alert */
+		SSL_shutdown(c);
+		ok = shuttle(c_out, s_in) &&
+			check_read(name, s, sizeof(rb_got), TOTAL, 0, 0) &&
+			check_read(name, s, sizeof(rb_got), 0,
+				   SSL_ERROR_ZERO_RETURN, 0);
+		break;
+
+	case RB_INCOMPLETE:
+		/* The batch ends at a record that has not fully arrived */
+		len = records_len(c_out, NUM_RECORDS);
+		ok = shuttle_part(c_out, s_in, len - 10) &&
+			check_read(name, s, sizeof(rb_got),
+				   TOTAL - RECORD_LEN, 0, 0) &&
+			check_read(name, s, sizeof(rb_got), -1,
+				   SSL_ERROR_WANT_READ, 0) &&
+			shuttle(c_out, s_in) &&
+			check_read(name, s, sizeof(rb_got), RECORD_LEN, 0,
+				   TOTAL - RECORD_LEN);
+		break;
+
+	case RB_BAD_RECORD:
+		/* The records before a corrupted one are returned, and the
+		 * next read fails */
+		len = records_len(c_out, 2);
+		BIO_get_mem_data(c_out, (char **)&p);
+		p[len + 100] ^= 1;
+		ok = shuttle(c_out, s_in) &&
+			check_read(name, s, sizeof(rb_got), 2 * RECORD_LEN,
+				   0, 0) &&
+			check_read(name, s, sizeof(rb_got), -1,
+				   SSL_ERROR_SSL, 0);
+		if (ok && ERR_GET_REASON(ERR_peek_last_error()) !=
+		    SSL_R_DECRYPTION_FAILED_OR_BAD_RECORD_MAC)
+			{
+			fprintf(stderr, "%s: wrong error\n", name);
+			ok = 0;
+			}
+		/* The failure is reported only once */
+		if (ok && s->s3->read_batch_error != 0)
+			{
+			fprintf(stderr, "%s: error not cleared\n", name);
+			ok = 0;
+			}
+		ERR_clear_error();
+		break;
+
+	case RB_NO_BATCH:
+		/* Without the mode a read returns one record */
+		SSL_clear_mode(s, SSL_MODE_READ_BATCH);
+		ok = shuttle(c_out, s_in) &&
+			check_read(name, s, sizeof(rb_got), RECORD_LEN, 0, 0);
+		break;
+		}
+
+	if (ok)
+		printf("%s: ok\n", name);
+ end:
+	free_pair(s, c);
+	return !ok;
+	}
+
+static int test_read_batch(void)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	int errors = 0;
+
+	RAND_pseudo_bytes(rb_data, sizeof(rb_data));
+	if (!new_ctxs(&s_ctx, &c_ctx))
+		return 1;
+	if (!SSL_CTX_set_default_read_buffer_len(s_ctx,
+				NUM_RECORDS * (RECORD_LEN + 256)))
+		{
+		fprintf(stderr, "read batch: cannot set the read buffer\n");
+		errors++;
+		goto end;
+		}
+	SSL_CTX_set_read_ahead(s_ctx, 1);
+	SSL_CTX_set_mode(s_ctx, SSL_MODE_READ_BATCH);
+
+	errors += test_read_batch_case("read batch of all records", s_ctx,
+				       c_ctx, RB_ALL);
+	errors += test_read_batch_case("read batch, short buffer", s_ctx,
+				       c_ctx, RB_SHORT_BUFFER);
+	errors += test_read_batch_case("read batch ending at an alert", s_ctx,
+				       c_ctx, RB_ALERT);
+	errors += test_read_batch_case("read batch ending at an incomplete "
+				       "record", s_ctx, c_ctx, RB_INCOMPLETE);
+	errors += test_read_batch_case("read batch with a bad record", s_ctx,
+				       c_ctx, RB_BAD_RECORD);
+	errors += test_read_batch_case("read without the batch mode", s_ctx,
+				       c_ctx, RB_NO_BATCH);
+ end:
+	free_ctxs(s_ctx, c_ctx);
+	return errors;
+	}
+
+/* Record buffer pool */
+
+#define MSG_LEN 1000
+
+static unsigned char bp_data[MSG_LEN], bp_got[MSG_LEN];
+
+/* Contexts as new_ctxs() makes them, in SSL_MODE_RELEASE_BUFFERS so that
+ * every round trip takes its buffers from the pool and gives them back */
+static int pool_ctxs(SSL_CTX **s_ctx, SSL_CTX **c_ctx)
+	{
+	if (!new_ctxs(s_ctx, c_ctx))
+		return 0;
+	SSL_CTX_set_mode(*s_ctx, SSL_MODE_RELEASE_BUFFERS);
+	if (c_ctx != NULL)
+		SSL_CTX_set_mode(*c_ctx, SSL_MODE_RELEASE_BUFFERS);
+	return 1;
+	}
+
+/* Sends a message from |c| to |s| and back, after which neither holds a
+ * buffer */
+static int round_trip(SSL *s, SSL *c)
+	{
+	if (SSL_write(c, bp_data, MSG_LEN) != MSG_LEN ||
+	    !shuttle(SSL_get_wbio(c), SSL_get_rbio(s)) ||
+	    SSL_read(s, bp_got, MSG_LEN) != MSG_LEN ||
+	    SSL_write(s, bp_got, MSG_LEN) != MSG_LEN ||
+	    !shuttle(SSL_get_wbio(s), SSL_get_rbio(c)) ||
+	    SSL_read(c, bp_got, MSG_LEN) != MSG_LEN)
+		{
+		ERR_print_errors_fp(stderr);
+		return 0;
+		}
+	return memcmp(bp_got, bp_data, MSG_LEN) == 0;
+	}
+
+/* Runs |n| round trips on each of |num| connections in turn */
+static int run_trips(SSL **s, SSL **c, int num, int n)
+	{
+	int i, j;
+
+	for (i = 0; i < n; i++)
+		{
+		for (j = 0; j < num; j++)
+			{
+			if (!round_trip(s[j], c[j]))
+				return 0;
+			}
+		}
+	return 1;
+	}
+
+static int test_reuse(const char *name, unsigned int frag)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	SSL *s[2] = { NULL, NULL }, *c[2] = { NULL, NULL };
+	SSL_BUF_POOL_STATS st, st2;
+	int i, errors = 0;
+
+	if (!pool_ctxs(&s_ctx, &c_ctx))
+		{
+		errors++;
+		goto end;
+		}
+	for (i = 0; i < 2; i++)
+		{
+		if (!connect_pair(s_ctx, c_ctx, &s[i], &c[i]))
+			{
+			fprintf(stderr, "%s: handshake failed\n", name);
+			ERR_print_errors_fp(stderr);
+			errors++;
+			goto end;
+			}
+		}
+	/* A smaller fragment length makes the write buffer of the second
+	 * connection smaller than that of the first */
+	if (frag != 0)
+		SSL_set_max_send_fragment(c[1], frag);
+
+	/* Once every size has been seen, every buffer comes from the pool */
+	if (!run_trips(s, c, 2, 1))
+		goto failed;
+	SSL_CTX_get_buffer_pool_stats(c_ctx, &st);
+	if (!run_trips(s, c, 2, 100))
+		goto failed;
+	SSL_CTX_get_buffer_pool_stats(c_ctx, &st2);
+	if (st2.misses != st.misses || st2.hits - st.hits != 400 ||
+	    st2.drops != st.drops)
+		{
+		fprintf(stderr, "%s: %lu hits, %lu misses and %lu drops in "
+			"400 buffers\n", name, st2.hits - st.hits,
+			st2.misses - st.misses, st2.drops - st.drops);
+		errors++;
+		}
+	if (st2.bytes_in_use != 0 || st2.buffers == 0 || st2.bytes == 0)
+		{
+		fprintf(stderr, "%s: %lu bytes in use, %lu buffers of %lu "
+			"bytes retained when idle\n", name,
+			(unsigned long)st2.bytes_in_use, st2.buffers,
+			(unsigned long)st2.bytes);
+		errors++;
+		}
+
+	SSL_CTX_flush_buffer_pool(c_ctx);
+	SSL_CTX_get_buffer_pool_stats(c_ctx, &st);
+	if (st.buffers != 0 || st.bytes != 0)
+		{
+		fprintf(stderr, "%s: %lu buffers left after flush\n", name,
+			st.buffers);
+		errors++;
+		}
+	if (!run_trips(s, c, 2, 1))
+		goto failed;
+	SSL_CTX_get_buffer_pool_stats(c_ctx, &st2);
+	if (st2.misses == st.misses)
+		{
+		fprintf(stderr, "%s: no misses after flush\n", name);
+		errors++;
+		}
+	goto end;
+
+ failed:
+	fprintf(stderr, "%s: round trip failed\n", name);
+	errors++;
+ end:
+	for (i = 0; i < 2; i++)
+		free_pair(s[i], c[i]);
+	free_ctxs(s_ctx, c_ctx);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+static int test_limit(const char *name)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	SSL *s = NULL, *c = NULL;
+	SSL_BUF_POOL_STATS st;
+	int errors = 0;
+
+	if (!pool_ctxs(&s_ctx, &c_ctx))
+		{
+		errors++;
+		goto end;
+		}
+	c_ctx->freelist_max_len = 0;
+	if (!connect_pair(s_ctx, c_ctx, &s, &c) || !run_trips(&s, &c, 1, 10))
+		{
+		fprintf(stderr, "%s: connection failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	SSL_CTX_get_buffer_pool_stats(c_ctx, &st);
+	if (st.hits != 0 || st.buffers != 0 || st.drops != st.misses ||
+	    st.bytes_in_use != 0)
+		{
+		fprintf(stderr, "%s: %lu hits, %lu misses, %lu drops, "
+			"%lu buffers retained\n", name, st.hits, st.misses,
+			st.drops, st.buffers);
+		errors++;
+		}
+ end:
+	free_pair(s, c);
+	free_ctxs(s_ctx, c_ctx);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+typedef struct
+	{
+	long gets, releases;
+	size_t in_use;
+	} BUF_COUNTS;
+
+static void *get_buf(SSL_CTX *ctx, size_t len, void *arg)
+	{
+	BUF_COUNTS *counts = arg;
+
+	counts->gets++;
+	counts->in_use += len;
+	return malloc(len);
+	}
+
+static void release_buf(SSL_CTX *ctx, void *buf, size_t len, void *arg)
+	{
+	BUF_COUNTS *counts = arg;
+
+	counts->releases++;
+	counts->in_use -= len;
+	free(buf);
+	}
+
+static int test_callbacks(const char *name)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	SSL *s = NULL, *c = NULL;
+	SSL_BUF_POOL_STATS st;
+	BUF_COUNTS counts = { 0, 0, 0 };
+	int errors = 0;
+
+	if (!pool_ctxs(&s_ctx, &c_ctx))
+		{
+		errors++;
+		goto end;
+		}
+	SSL_CTX_set_buffer_callbacks(c_ctx, get_buf, release_buf, &counts);
+	if (!connect_pair(s_ctx, c_ctx, &s, &c) || !run_trips(&s, &c, 1, 10))
+		{
+		fprintf(stderr, "%s: connection failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	SSL_free(c);
+	c = NULL;
+	SSL_CTX_get_buffer_pool_stats(c_ctx, &st);
+	if (counts.gets < 20 || counts.gets != counts.releases ||
+	    counts.in_use != 0 || st.hits != 0 || st.misses != 0)
+		{
+		fprintf(stderr, "%s: %ld gets, %ld releases, pool used %lu "
+			"times\n", name, counts.gets, counts.releases,
+			st.hits + st.misses);
+		errors++;
+		}
+ end:
+	free_pair(s, c);
+	free_ctxs(s_ctx, c_ctx);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+#ifndef OPENSSL_NO_TLSEXT
+static int switch_ctx(SSL *s, int *ad, void *arg)
+	{
+	SSL_set_SSL_CTX(s, arg);
+	return SSL_TLSEXT_ERR_OK;
+	}
+
+/* A server that moves to another SSL_CTX on SNI keeps using the buffer
+ * callbacks of the one it was created with */
+static int test_sni_switch(const char *name)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL, *sni_ctx = NULL;
+	SSL *s = NULL, *c = NULL;
+	BUF_COUNTS counts = { 0, 0, 0 }, sni_counts = { 0, 0, 0 };
+	int errors = 0;
+
+	if (!pool_ctxs(&s_ctx, &c_ctx) || !pool_ctxs(&sni_ctx, NULL))
+		{
+		errors++;
+		goto end;
+		}
+	SSL_CTX_set_buffer_callbacks(s_ctx, get_buf, release_buf, &counts);
+	SSL_CTX_set_buffer_callbacks(sni_ctx, get_buf, release_buf,
+		&sni_counts);
+	SSL_CTX_set_tlsext_servername_callback(s_ctx, switch_ctx);
+	SSL_CTX_set_tlsext_servername_arg(s_ctx, sni_ctx);
+	servername = "sni.example";
+	if (!connect_pair(s_ctx, c_ctx, &s, &c) || !run_trips(&s, &c, 1, 10))
+		{
+		fprintf(stderr, "%s: connection failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	if (SSL_get_SSL_CTX(s) != sni_ctx)
+		{
+		fprintf(stderr, "%s: server did not switch SSL_CTX\n", name);
+		errors++;
+		goto end;
+		}
+	SSL_free(s);
+	s = NULL;
+	if (counts.gets < 20 || counts.gets != counts.releases ||
+	    counts.in_use != 0 || sni_counts.gets != 0 ||
+	    sni_counts.releases != 0)
+		{
+		fprintf(stderr, "%s: %ld gets and %ld releases on the first "
+			"SSL_CTX, %ld gets and %ld releases on the second\n",
+			name, counts.gets, counts.releases, sni_counts.gets,
+			sni_counts.releases);
+		errors++;
+		}
+ end:
+	servername = NULL;
+	free_pair(s, c);
+	free_ctxs(s_ctx, c_ctx);
+	free_ctxs(sni_ctx, NULL);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+#endif
+
+static int test_bufpool(void)
+	{
+	int errors = 0;
+
+	RAND_pseudo_bytes(bp_data, sizeof(bp_data));
+	errors += test_reuse("buffer reuse", 0);
+	errors += test_reuse("buffers of two sizes", 1024);
+	errors += test_limit("freelist_max_len 0");
+	errors += test_callbacks("buffer callbacks");
+#ifndef OPENSSL_NO_TLSEXT
+	errors += test_sni_switch("buffer callbacks with SNI");
+#endif
+	return errors;
+	}
+
+/* SSL_MODE_RELEASE_HANDSHAKE_STATE */
+
+static unsigned char ic_data[100], ic_got[sizeof(ic_data)];
+
+/* Contexts without a server session cache and in
+ * SSL_MODE_RELEASE_BUFFERS, so that what an idle connection holds is the
+ * state of its SSL objects, plus |mode| */
+static int idle_ctxs(SSL_CTX **s_ctx, SSL_CTX **c_ctx, long mode)
+	{
+	if (!new_ctxs(s_ctx, c_ctx))
+		return 0;
+	SSL_CTX_set_session_cache_mode(*s_ctx, SSL_SESS_CACHE_OFF);
+	SSL_CTX_set_mode(*s_ctx, SSL_MODE_RELEASE_BUFFERS | mode);
+	SSL_CTX_set_mode(*c_ctx, SSL_MODE_RELEASE_BUFFERS | mode);
+	return 1;
+	}
+
+/* Sends a message from |c| to |s| and back */
+static int echo(SSL *s, SSL *c)
+	{
+	if (SSL_write(c, ic_data, sizeof(ic_data)) != sizeof(ic_data) ||
+	    !shuttle(SSL_get_wbio(c), SSL_get_rbio(s)) ||
+	    SSL_read(s, ic_got, sizeof(ic_got)) != sizeof(ic_got) ||
+	    SSL_write(s, ic_got, sizeof(ic_got)) != sizeof(ic_got) ||
+	    !shuttle(SSL_get_wbio(s), SSL_get_rbio(c)) ||
+	    SSL_read(c, ic_got, sizeof(ic_got)) != sizeof(ic_got))
+		{
+		ERR_print_errors_fp(stderr);
+		return 0;
+		}
+	return memcmp(ic_got, ic_data, sizeof(ic_data)) == 0;
+	}
+
+/* Has |c| renegotiate, |s| seeing it as it reads */
+static int renegotiate(SSL *s, SSL *c)
+	{
+	int i, r;
+
+	if (!SSL_renegotiate(c))
+		return 0;
+	for (i = 0; i < 100 && SSL_renegotiate_pending(c); i++)
+		{
+		if ((r = SSL_do_handshake(c)) <= 0 && !is_retry(c, r))
+			return 0;
+		if (!shuttle(mem_wbio(c), SSL_get_rbio(s)))
+			return 0;
+		if ((r = SSL_read(s, ic_got, sizeof(ic_got))) <= 0 &&
+		    !is_retry(s, r))
+			return 0;
+		if (!shuttle(mem_wbio(s), SSL_get_rbio(c)))
+			return 0;
+		}
+	return !SSL_renegotiate_pending(c);
+	}
+
+/* Connections share the CERT of their SSL_CTX once their handshakes are
+ * over, and leave nothing of them in it */
+static int test_share(const char *name)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	SSL *s = NULL, *c = NULL, *fresh;
+	int i, errors = 0;
+
+	if (!idle_ctxs(&s_ctx, &c_ctx, SSL_MODE_RELEASE_HANDSHAKE_STATE))
+		return 1;
+	for (i = 0; i < 3; i++)
+		{
+		if (!connect_pair(s_ctx, c_ctx, &s, &c) || !echo(s, c))
+			{
+			fprintf(stderr, "%s: connection %d failed\n", name, i);
+			ERR_print_errors_fp(stderr);
+			errors++;
+			goto end;
+			}
+		if (s->cert != s_ctx->cert || c->cert != c_ctx->cert)
+			{
+			fprintf(stderr, "%s: connection %d keeps its own "
+				"certificate settings\n", name, i);
+			errors++;
+			}
+		if (!renegotiate(s, c) || !echo(s, c))
+			{
+			fprintf(stderr, "%s: renegotiation %d failed\n", name,
+				i);
+			ERR_print_errors_fp(stderr);
+			errors++;
+			goto end;
+			}
+		if (s->cert != s_ctx->cert)
+			{
+			fprintf(stderr, "%s: certificate settings not shared "
+				"after renegotiation\n", name);
+			errors++;
+			}
+		if (SSL_get_certificate(s) == NULL)
+			{
+			fprintf(stderr, "%s: no certificate\n", name);
+			errors++;
+			}
+		/* What the handshakes learnt of the peer stays with them */
+		if ((fresh = SSL_new(s_ctx)) == NULL ||
+		    SSL_get_sigalgs(fresh, 0, NULL, NULL, NULL, NULL,
+				    NULL) != 0 ||
+		    SSL_get_shared_sigalgs(fresh, 0, NULL, NULL, NULL, NULL,
+					   NULL) != 0)
+			{
+			fprintf(stderr, "%s: handshake state left in the "
+				"shared certificate settings\n", name);
+			errors++;
+			}
+		if (fresh != NULL)
+			SSL_free(fresh);
+		free_pair(s, c);
+		s = c = NULL;
+		}
+ end:
+	free_pair(s, c);
+	free_ctxs(s_ctx, c_ctx);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+/* A certificate set on the connection outlives its handshakes, and is
+ * not seen by other connections */
+static int test_own_cert(const char *name)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	SSL *s = NULL, *c = NULL, *s2 = NULL, *c2 = NULL;
+	X509 *peer = NULL;
+	int errors = 0;
+
+	if (!idle_ctxs(&s_ctx, &c_ctx, SSL_MODE_RELEASE_HANDSHAKE_STATE))
+		return 1;
+	if (!new_pair(s_ctx, c_ctx, &s, &c) ||
+	    !SSL_use_certificate_file(s, cert2_file, SSL_FILETYPE_PEM) ||
+	    !SSL_use_PrivateKey_file(s, cert2_file, SSL_FILETYPE_PEM))
+		{
+		fprintf(stderr, "%s: cannot use %s\n", name, cert2_file);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	if (!handshake_pair(s, c) || !echo(s, c) ||
+	    !connect_pair(s_ctx, c_ctx, &s2, &c2) || !echo(s2, c2))
+		{
+		fprintf(stderr, "%s: connection failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	if (s->cert == s_ctx->cert || s2->cert != s_ctx->cert)
+		{
+		fprintf(stderr, "%s: certificate settings wrongly shared\n",
+			name);
+		errors++;
+		}
+	peer = SSL_get_peer_certificate(c);
+	if (peer == NULL || X509_cmp(peer, SSL_get_certificate(s)) != 0 ||
+	    X509_cmp(peer, SSL_get_certificate(s2)) == 0)
+		{
+		fprintf(stderr, "%s: wrong certificate\n", name);
+		errors++;
+		}
+	if (peer != NULL)
+		X509_free(peer);
+	if (!renegotiate(s, c) || !echo(s, c))
+		{
+		fprintf(stderr, "%s: renegotiation failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	peer = SSL_get_peer_certificate(c);
+	if (peer == NULL || X509_cmp(peer, SSL_get_certificate(s)) != 0)
+		{
+		fprintf(stderr, "%s: wrong certificate after renegotiation\n",
+			name);
+		errors++;
+		}
+	if (peer != NULL)
+		X509_free(peer);
+ end:
+	free_pair(s, c);
+	free_pair(s2, c2);
+	free_ctxs(s_ctx, c_ctx);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+#define IDLE_CONNS 10
+
+/* The bytes |IDLE_CONNS| idle connections hold, or 0 on failure */
+static size_t idle_bytes(long mode)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	SSL *s[IDLE_CONNS], *c[IDLE_CONNS];
+	size_t base, total = 0;
+	int i;
+
+	memset(s, 0, sizeof(s));
+	memset(c, 0, sizeof(c));
+	if (!idle_ctxs(&s_ctx, &c_ctx, mode))
+		return 0;
+	/* A first connection sets up what the library keeps once and for
+	 * all */
+	if (!connect_pair(s_ctx, c_ctx, &s[0], &c[0]) || !echo(s[0], c[0]))
+		goto end;
+	free_pair(s[0], c[0]);
+	s[0] = c[0] = NULL;
+	SSL_CTX_flush_buffer_pool(s_ctx);
+	SSL_CTX_flush_buffer_pool(c_ctx);
+	base = mem_live;
+
+	for (i = 0; i < IDLE_CONNS; i++)
+		{
+		if (!connect_pair(s_ctx, c_ctx, &s[i], &c[i]) ||
+		    !echo(s[i], c[i]))
+			goto end;
+		}
+	SSL_CTX_flush_buffer_pool(s_ctx);
+	SSL_CTX_flush_buffer_pool(c_ctx);
+	total = mem_live - base;
+ end:
+	if (total == 0)
+		ERR_print_errors_fp(stderr);
+	for (i = 0; i < IDLE_CONNS; i++)
+		free_pair(s[i], c[i]);
+	free_ctxs(s_ctx, c_ctx);
+	return total;
+	}
+
+static int test_idle_conn(void)
+	{
+	size_t before, after;
+	int errors = 0;
+
+	RAND_pseudo_bytes(ic_data, sizeof(ic_data));
+	errors += test_share("shared certificate settings");
+	errors += test_own_cert("certificate of the connection");
+
+	/* Idle connections hold less */
+	before = idle_bytes(0);
+	after = idle_bytes(SSL_MODE_RELEASE_HANDSHAKE_STATE);
+	printf("idle connection: %lu bytes per client and server, "
+		"%lu with released state\n",
+		(unsigned long)before / IDLE_CONNS,
+		(unsigned long)after / IDLE_CONNS);
+	if (before == 0 || after == 0 || after >= before)
+		{
+		fprintf(stderr, "released state: no fewer bytes held\n");
+		errors++;
+		}
+	else
+		printf("released state: ok\n");
+	return errors;
+	}
+
+/* Running hashes of the handshake messages */
+
+#define SERVER_SIGALGS "RSA+SHA512:RSA+SHA384:RSA+SHA256:RSA+SHA224:RSA+SHA1"
+
+/* Accepts any client certificate: it is its signature that is tested */
+static int tr_verify_cb(int ok, X509_STORE_CTX *ctx)
+	{
+	return 1;
+	}
+
+/* Runs a handshake and a renegotiation, with client authentication if
+ * |sigalgs| is set, the server allowing the client to sign with those
+ * only. The server keeps signing with any hash. */
+static int test_transcript_case(const char *name, const SSL_METHOD *sm,
+				const SSL_METHOD *cm, const char *cipher,
+				const char *sigalgs)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	SSL *s = NULL, *c = NULL;
+	X509 *peer;
+	int errors = 0;
+
+	s_ctx = SSL_CTX_new(sm);
+	c_ctx = SSL_CTX_new(cm);
+	if (s_ctx == NULL || c_ctx == NULL ||
+	    !SSL_CTX_use_certificate_file(s_ctx, cert_file, SSL_FILETYPE_PEM) ||
+	    !SSL_CTX_use_PrivateKey_file(s_ctx, cert_file, SSL_FILETYPE_PEM) ||
+	    !SSL_CTX_set_cipher_list(c_ctx, cipher))
+		{
+		fprintf(stderr, "%s: cannot set up contexts\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	SSL_CTX_set_session_cache_mode(s_ctx, SSL_SESS_CACHE_OFF);
+	if (sigalgs != NULL)
+		{
+		if (!SSL_CTX_use_certificate_file(c_ctx, cert2_file,
+						  SSL_FILETYPE_PEM) ||
+		    !SSL_CTX_use_PrivateKey_file(c_ctx, cert2_file,
+						 SSL_FILETYPE_PEM) ||
+		    (*sigalgs != '\0' &&
+		     (!SSL_CTX_set1_client_sigalgs_list(s_ctx, sigalgs) ||
+		      !SSL_CTX_set1_sigalgs_list(s_ctx, SERVER_SIGALGS))))
+			{
+			fprintf(stderr, "%s: cannot set up client "
+				"authentication\n", name);
+			ERR_print_errors_fp(stderr);
+			errors++;
+			goto end;
+			}
+		SSL_CTX_set_verify(s_ctx, SSL_VERIFY_PEER |
+				   SSL_VERIFY_FAIL_IF_NO_PEER_CERT,
+				   tr_verify_cb);
+		}
+	if (!new_pair(s_ctx, c_ctx, &s, &c))
+		{
+		errors++;
+		goto end;
+		}
+	if (SSL_version(s) == DTLS1_2_VERSION)
+		{
+		SSL_set_options(s, SSL_OP_NO_QUERY_MTU);
+		SSL_set_options(c, SSL_OP_NO_QUERY_MTU);
+		SSL_set_mtu(s, 1400);
+		SSL_set_mtu(c, 1400);
+		}
+	if (!handshake_pair(s, c) || !echo(s, c))
+		{
+		fprintf(stderr, "%s: handshake failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	if (!renegotiate(s, c) || !echo(s, c))
+		{
+		fprintf(stderr, "%s: renegotiation failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	if (sigalgs != NULL)
+		{
+		if ((peer = SSL_get_peer_certificate(s)) == NULL)
+			{
+			fprintf(stderr, "%s: no client certificate\n", name);
+			errors++;
+			}
+		else
+			X509_free(peer);
+		}
+ end:
+	free_pair(s, c);
+	free_ctxs(s_ctx, c_ctx);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+/* The digests of the PRF of every protocol version and the hashes a TLS
+ * 1.2 client may sign its CertificateVerify with, each of which the
+ * server restricts the client to in turn */
+static int test_transcript(void)
+	{
+	const SSL_METHOD *s23 = SSLv23_server_method();
+	const SSL_METHOD *c23 = SSLv23_client_method();
+	int errors = 0;
+
+	RAND_pseudo_bytes(ic_data, sizeof(ic_data));
+#ifndef OPENSSL_NO_SSL3
+	errors += test_transcript_case("SSLv3", SSLv3_server_method(),
+				       SSLv3_client_method(), "AES128-SHA",
+				       NULL);
+	errors += test_transcript_case("SSLv3 client auth",
+				       SSLv3_server_method(),
+				       SSLv3_client_method(), "AES128-SHA",
+				       "");
+#endif
+	errors += test_transcript_case("TLSv1 client auth",
+				       TLSv1_server_method(),
+				       TLSv1_client_method(), "AES128-SHA",
+				       "");
+	errors += test_transcript_case("TLSv1.1 client auth",
+				       TLSv1_1_server_method(),
+				       TLSv1_1_client_method(), "AES128-SHA",
+				       "");
+	errors += test_transcript_case("DTLSv1.2 client auth SHA384",
+				       DTLSv1_2_server_method(),
+				       DTLSv1_2_client_method(),
+				       "AES128-SHA256", "RSA+SHA384");
+	errors += test_transcript_case("TLSv1.2 SHA256 PRF", s23, c23,
+				       "AES128-SHA256", NULL);
+	errors += test_transcript_case("TLSv1.2 SHA384 PRF", s23, c23,
+				       "AES256-GCM-SHA384", NULL);
+	errors += test_transcript_case("TLSv1.2 client auth", s23, c23,
+				       "AES128-SHA256", "");
+	errors += test_transcript_case("TLSv1.2 client auth SHA1", s23, c23,
+				       "AES128-SHA256", "RSA+SHA1");
+	errors += test_transcript_case("TLSv1.2 client auth SHA224", s23,
+				       c23, "AES128-SHA256", "RSA+SHA224");
+	errors += test_transcript_case("TLSv1.2 client auth SHA256", s23,
+				       c23, "AES256-GCM-SHA384", "RSA+SHA256");
+	errors += test_transcript_case("TLSv1.2 client auth SHA384", s23,
+				       c23, "AES256-GCM-SHA384", "RSA+SHA384");
+	errors += test_transcript_case("TLSv1.2 client auth SHA512", s23,
+				       c23, "AES128-SHA256", "RSA+SHA512");
+	return errors;
+	}
+
+/* Full handshakes per second, each on a new pair with the session cache
+ * off, with client authentication if |client_auth| is set */
+static void bench_handshakes(const char *name, const char *cipher,
+			     int client_auth, int n)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	SSL *s = NULL, *c = NULL;
+	clock_t t;
+	int i = -1;
+
+	if (!new_ctxs(&s_ctx, &c_ctx) ||
+	    !SSL_CTX_set_cipher_list(c_ctx, cipher))
+		goto end;
+	SSL_CTX_set_session_cache_mode(s_ctx, SSL_SESS_CACHE_OFF);
+	SSL_CTX_set_ecdh_auto(s_ctx, 1);
+	SSL_CTX_set1_curves_list(c_ctx, "P-256");
+	if (client_auth)
+		{
+		if (!SSL_CTX_use_certificate_file(c_ctx, cert2_file,
+						  SSL_FILETYPE_PEM) ||
+		    !SSL_CTX_use_PrivateKey_file(c_ctx, cert2_file,
+						 SSL_FILETYPE_PEM))
+			goto end;
+		SSL_CTX_set_verify(s_ctx, SSL_VERIFY_PEER |
+				   SSL_VERIFY_FAIL_IF_NO_PEER_CERT,
+				   tr_verify_cb);
+		}
+	t = clock();
+	for (i = 0; i < n; i++)
+		{
+		if (!connect_pair(s_ctx, c_ctx, &s, &c))
+			goto end;
+		free_pair(s, c);
+		s = c = NULL;
+		}
+	t = clock() - t;
+	printf("%-36s %8.1f handshakes/s\n", name,
+		t > 0 ? n / ((double)t / CLOCKS_PER_SEC) : 0);
+ end:
+	if (i < n)
+		{
+		fprintf(stderr, "%s: handshake failed\n", name);
+		ERR_print_errors_fp(stderr);
+		}
+	free_pair(s, c);
+	free_ctxs(s_ctx, c_ctx);
+	}
+
+static int bench_transcript(void)
+	{
+	int n = bench_n > 0 ? bench_n : 500;
+
+	bench_handshakes("RSA", "AES128-GCM-SHA256", 0, n);
+	bench_handshakes("ECDHE-RSA", "ECDHE-RSA-AES128-GCM-SHA256", 0, n);
+	bench_handshakes("RSA, client auth", "AES128-GCM-SHA256", 1, n);
+	bench_handshakes("ECDHE-RSA, client auth",
+			 "ECDHE-RSA-AES128-GCM-SHA256", 1, n);
+	return 0;
+	}
+
+/* Cache of compiled cipher lists
+ *
+ * Each rule string is compiled once into a fresh cache and once from it,
+ * both must give the same lists, lists compiled for one method must not be
+ * handed to another, the side effects of the rules must be kept and rules
+ * in error must be reported every time. */
+
+static const char *cl_rules[] =
+	{
+	"DEFAULT",
+	"ALL:!aNULL:!eNULL",
+	"HIGH:!aNULL:!MD5:@STRENGTH",
+	"ECDHE+AESGCM:DHE+AESGCM:ECDHE+AES:!SHA1",
+	"AES128-SHA:AES256-SHA:DES-CBC3-SHA",
+	"DEFAULT:-kRSA:+AES256",
+	};
+
+static int same_list(STACK_OF(SSL_CIPHER) *a, STACK_OF(SSL_CIPHER) *b)
+	{
+	int i;
+
+	if (a == NULL || b == NULL ||
+	    sk_SSL_CIPHER_num(a) != sk_SSL_CIPHER_num(b))
+		return 0;
+	for (i = 0; i < sk_SSL_CIPHER_num(a); i++)
+		{
+		if (sk_SSL_CIPHER_value(a, i) != sk_SSL_CIPHER_value(b, i))
+			return 0;
+		}
+	return 1;
+	}
+
+/* Both lists of |a| and |b| are the same, and the lists by id are sorted */
+static int same_lists(SSL_CTX *a, SSL_CTX *b)
+	{
+	return same_list(a->cipher_list, b->cipher_list) &&
+	    same_list(a->cipher_list_by_id, b->cipher_list_by_id) &&
+	    sk_SSL_CIPHER_is_sorted(a->cipher_list_by_id) &&
+	    sk_SSL_CIPHER_is_sorted(b->cipher_list_by_id);
+	}
+
+static int test_same_lists(const char *name, const SSL_METHOD *meth)
+	{
+	SSL_CTX *fresh = NULL, *cached = NULL;
+	SSL *s = NULL;
+	unsigned int i;
+	int errors = 0;
+
+	fresh = SSL_CTX_new(meth);
+	cached = SSL_CTX_new(meth);
+	if (fresh == NULL || cached == NULL)
+		{
+		errors++;
+		goto end;
+		}
+	for (i = 0; i < sizeof(cl_rules) / sizeof(cl_rules[0]); i++)
+		{
+		SSL_flush_cipher_list_cache();
+		if (!SSL_CTX_set_cipher_list(fresh, cl_rules[i]) ||
+		    !SSL_CTX_set_cipher_list(cached, cl_rules[i]))
+			{
+			fprintf(stderr, "%s: cannot set \"%s\"\n", name,
+				cl_rules[i]);
+			errors++;
+			continue;
+			}
+		if (!same_lists(fresh, cached))
+			{
+			fprintf(stderr, "%s: \"%s\" differs from the cache\n",
+				name, cl_rules[i]);
+			errors++;
+			}
+		}
+
+	/* A connection's own list comes from the same cache */
+	if ((s = SSL_new(cached)) == NULL ||
+	    !SSL_set_cipher_list(s, cl_rules[0]) ||
+	    !SSL_CTX_set_cipher_list(fresh, cl_rules[0]) ||
+	    !same_list(SSL_get_ciphers(s), fresh->cipher_list))
+		{
+		fprintf(stderr, "%s: SSL_set_cipher_list differs\n", name);
+		errors++;
+		}
+ end:
+	if (s != NULL)
+		SSL_free(s);
+	if (fresh != NULL)
+		SSL_CTX_free(fresh);
+	if (cached != NULL)
+		SSL_CTX_free(cached);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+#if !defined(OPENSSL_NO_RC4) && !defined(OPENSSL_NO_DTLS1)
+static int count_rc4(STACK_OF(SSL_CIPHER) *sk)
+	{
+	int i, n = 0;
+
+	for (i = 0; i < sk_SSL_CIPHER_num(sk); i++)
+		{
+		if (strstr(SSL_CIPHER_get_name(sk_SSL_CIPHER_value(sk, i)),
+			   "RC4") != NULL)
+			n++;
+		}
+	return n;
+	}
+#endif
+
+/* DTLS does not have RC4: a list with RC4 compiled for TLS must not be
+ * taken for DTLS */
+static int test_list_methods(const char *name)
+	{
+#if !defined(OPENSSL_NO_RC4) && !defined(OPENSSL_NO_DTLS1)
+	SSL_CTX *tls = NULL, *dtls = NULL;
+	const char *rule = "RC4:AES";
+	int tls_rc4, dtls_rc4, errors = 0;
+
+	SSL_flush_cipher_list_cache();
+	tls = SSL_CTX_new(TLSv1_2_method());
+	dtls = SSL_CTX_new(DTLSv1_2_method());
+	if (tls == NULL || dtls == NULL ||
+	    !SSL_CTX_set_cipher_list(tls, rule) ||
+	    !SSL_CTX_set_cipher_list(dtls, rule))
+		{
+		fprintf(stderr, "%s: cannot set \"%s\"\n", name, rule);
+		errors++;
+		goto end;
+		}
+	tls_rc4 = count_rc4(tls->cipher_list);
+	dtls_rc4 = count_rc4(dtls->cipher_list);
+	if (tls_rc4 == 0 || dtls_rc4 != 0 ||
+	    sk_SSL_CIPHER_num(dtls->cipher_list) == 0)
+		{
+		fprintf(stderr, "%s: %d RC4 ciphers for TLS, %d for DTLS\n",
+			name, tls_rc4, dtls_rc4);
+		errors++;
+		}
+ end:
+	if (tls != NULL)
+		SSL_CTX_free(tls);
+	if (dtls != NULL)
+		SSL_CTX_free(dtls);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+#else
+	printf("%s: skipped\n", name);
+	return 0;
+#endif
+	}
+
+/* @SECLEVEL sets the security level of each context the list is set on,
+ * and bad rules fail however often they are set */
+static int test_rule_side_effects(const char *name)
+	{
+	SSL_CTX *a = NULL, *b = NULL;
+	int i, errors = 0;
+
+	SSL_flush_cipher_list_cache();
+	a = SSL_CTX_new(SSLv23_method());
+	b = SSL_CTX_new(SSLv23_method());
+	if (a == NULL || b == NULL)
+		{
+		errors++;
+		goto end;
+		}
+	if (!SSL_CTX_set_cipher_list(a, "DEFAULT:@SECLEVEL=3") ||
+	    !SSL_CTX_set_cipher_list(b, "DEFAULT:@SECLEVEL=3") ||
+	    SSL_CTX_get_security_level(a) != 3 ||
+	    SSL_CTX_get_security_level(b) != 3)
+		{
+		fprintf(stderr, "%s: @SECLEVEL not applied\n", name);
+		errors++;
+		}
+	SSL_CTX_set_security_level(b, 1);
+	if (!SSL_CTX_set_cipher_list(b, "DEFAULT") ||
+	    SSL_CTX_get_security_level(b) != 1)
+		{
+		fprintf(stderr, "%s: security level changed\n", name);
+		errors++;
+		}
+	for (i = 0; i < 2; i++)
+		{
+		ERR_clear_error();
+		if (SSL_CTX_set_cipher_list(a, "DEFAULT:@NOSUCHCOMMAND") ||
+		    ERR_peek_error() == 0)
+			{
+			fprintf(stderr, "%s: bad rule accepted\n", name);
+			errors++;
+			}
+		}
+	ERR_clear_error();
+ end:
+	if (a != NULL)
+		SSL_CTX_free(a);
+	if (b != NULL)
+		SSL_CTX_free(b);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+static int test_cipher_list(void)
+	{
+	int errors = 0;
+
+	errors += test_same_lists("SSLv23 lists", SSLv23_method());
+	errors += test_same_lists("TLSv1.2 lists", TLSv1_2_method());
+#ifndef OPENSSL_NO_DTLS1
+	errors += test_same_lists("DTLS lists", DTLS_method());
+#endif
+	errors += test_list_methods("lists kept per method");
+	errors += test_rule_side_effects("rule side effects");
+	SSL_flush_cipher_list_cache();
+	return errors;
+	}
+
+/* Choice of the cipher by a server
+ *
+ * Each ClientHello is made once by a client and fed to a new server, which
+ * answers it up to its ServerHelloDone. The cipher is read back from the
+ * ServerHello. */
+
+#define FIREFOX_CIPHERS \
+	"ECDHE-ECDSA-AES128-GCM-SHA256:ECDHE-RSA-AES128-GCM-SHA256:" \
+	"ECDHE-ECDSA-AES256-SHA:ECDHE-ECDSA-AES128-SHA:" \
+	"ECDHE-RSA-AES128-SHA:ECDHE-RSA-AES256-SHA:" \
+	"DHE-RSA-AES128-SHA:DHE-RSA-AES256-SHA:" \
+	"AES128-SHA:AES256-SHA:DES-CBC3-SHA"
+#define CHROME_CIPHERS \
+	"ECDHE-RSA-AES128-GCM-SHA256:ECDHE-ECDSA-AES128-GCM-SHA256:" \
+	"ECDHE-RSA-AES256-GCM-SHA384:ECDHE-ECDSA-AES256-GCM-SHA384:" \
+	"DHE-RSA-AES128-GCM-SHA256:ECDHE-RSA-AES128-SHA:" \
+	"ECDHE-ECDSA-AES128-SHA:ECDHE-RSA-AES256-SHA:" \
+	"ECDHE-ECDSA-AES256-SHA:DHE-RSA-AES128-SHA:DHE-RSA-AES256-SHA:" \
+	"AES128-GCM-SHA256:AES128-SHA:AES256-SHA:DES-CBC3-SHA"
+#define ALL_CIPHERS "ALL:COMPLEMENTOFALL"
+
+static EVP_PKEY *cs_ec_key = NULL;
+static X509 *cs_ec_cert = NULL;
+
+/* Makes up a self-signed P-256 certificate for ECDSA ciphers */
+static int cs_make_ec_cert(void)
+	{
+#ifndef OPENSSL_NO_EC
+	EC_KEY *eck = NULL;
+	X509_NAME *name;
+
+	if ((eck = EC_KEY_new_by_curve_name(NID_X9_62_prime256v1)) == NULL ||
+	    !EC_KEY_generate_key(eck) ||
+	    (cs_ec_key = EVP_PKEY_new()) == NULL ||
+	    !EVP_PKEY_assign_EC_KEY(cs_ec_key, eck))
+		{
+		if (eck != NULL)
+			EC_KEY_free(eck);
+		return 0;
+		}
+	if ((cs_ec_cert = X509_new()) == NULL ||
+	    !X509_set_version(cs_ec_cert, 2) ||
+	    !ASN1_INTEGER_set(X509_get_serialNumber(cs_ec_cert), 1) ||
+	    !X509_gmtime_adj(X509_get_notBefore(cs_ec_cert), 0) ||
+	    !X509_gmtime_adj(X509_get_notAfter(cs_ec_cert), 86400L) ||
+	    !X509_set_pubkey(cs_ec_cert, cs_ec_key) ||
+	    (name = X509_get_subject_name(cs_ec_cert)) == NULL ||
+	    !X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+		(const unsigned char *)"sslapitest", -1, -1, 0) ||
+	    !X509_set_issuer_name(cs_ec_cert, name) ||
+	    !X509_sign(cs_ec_cert, cs_ec_key, EVP_sha256()))
+		return 0;
+#endif
+	return 1;
+	}
+
+static void cs_free_ec_cert(void)
+	{
+	if (cs_ec_cert != NULL)
+		X509_free(cs_ec_cert);
+	if (cs_ec_key != NULL)
+		EVP_PKEY_free(cs_ec_key);
+	cs_ec_cert = NULL;
+	cs_ec_key = NULL;
+	}
+
+/* A server with an RSA certificate, an ECDSA one too if |with_ec|, and
+ * ECDH keys */
+static SSL_CTX *cs_server_ctx(const char *ciphers, int server_pref,
+			      int with_ec)
+	{
+	SSL_CTX *ctx = SSL_CTX_new(SSLv23_server_method());
+
+	if (ctx == NULL ||
+	    !SSL_CTX_use_certificate_file(ctx, cert_file, SSL_FILETYPE_PEM) ||
+	    !SSL_CTX_use_PrivateKey_file(ctx, cert_file, SSL_FILETYPE_PEM) ||
+	    (ciphers != NULL && !SSL_CTX_set_cipher_list(ctx, ciphers)))
+		goto err;
+#ifndef OPENSSL_NO_EC
+	if (with_ec && (!SSL_CTX_use_certificate(ctx, cs_ec_cert) ||
+			!SSL_CTX_use_PrivateKey(ctx, cs_ec_key)))
+		goto err;
+	SSL_CTX_set_ecdh_auto(ctx, 1);
+#endif
+	if (server_pref)
+		SSL_CTX_set_options(ctx, SSL_OP_CIPHER_SERVER_PREFERENCE);
+	return ctx;
+ err:
+	fprintf(stderr, "cannot set up a server with %s\n", cert_file);
+	ERR_print_errors_fp(stderr);
+	if (ctx != NULL)
+		SSL_CTX_free(ctx);
+	return NULL;
+	}
+
+/* Makes the ClientHello of a client offering |ciphers| in that order, and
+ * asking for |servername| if not NULL. Returns its length, or 0 on
+ * error. */
+static long make_client_hello(const char *ciphers, unsigned char *buf,
+			      long len)
+	{
+	SSL_CTX *ctx;
+	SSL *c = NULL;
+	BIO *in = NULL, *out = NULL;
+	long ret = 0;
+	int r;
+
+	if ((ctx = SSL_CTX_new(SSLv23_client_method())) == NULL)
+		return 0;
+	if (!SSL_CTX_set_cipher_list(ctx, ciphers) ||
+	    (c = SSL_new(ctx)) == NULL ||
+	    (in = BIO_new(BIO_s_mem())) == NULL ||
+	    (out = BIO_new(BIO_s_mem())) == NULL)
+		goto end;
+	SSL_set_bio(c, in, out);
+#ifndef OPENSSL_NO_TLSEXT
+	if (servername != NULL && !SSL_set_tlsext_host_name(c, servername))
+		goto end;
+#endif
+	SSL_set_connect_state(c);
+	r = SSL_do_handshake(c);
+	if (r > 0 || !is_retry(c, r))
+		goto end;
+	if (BIO_ctrl_pending(out) <= (size_t)len)
+		ret = BIO_read(out, buf, (int)len);
+ end:
+	if (c != NULL)
+		SSL_free(c);
+	else
+		{
+		if (in != NULL)
+			BIO_free(in);
+		if (out != NULL)
+			BIO_free(out);
+		}
+	SSL_CTX_free(ctx);
+	return ret > 0 ? ret : 0;
+	}
+
+/* Feeds |hello| to a new server of |ctx| and returns the cipher of its
+ * ServerHello, or NULL if it did not send one. */
+static const SSL_CIPHER *answer_hello(SSL_CTX *ctx,
+				      const unsigned char *hello,
+				      long hello_len)
+	{
+	const SSL_CIPHER *ret = NULL;
+	unsigned char buf[64];
+	SSL *s;
+	BIO *in, *out;
+	long n;
+
+	if ((s = SSL_new(ctx)) == NULL)
+		return NULL;
+	in = BIO_new(BIO_s_mem());
+	out = BIO_new(BIO_s_mem());
+	if (in == NULL || out == NULL)
+		{
+		if (in != NULL)
+			BIO_free(in);
+		if (out != NULL)
+			BIO_free(out);
+		SSL_free(s);
+		return NULL;
+		}
+	SSL_set_bio(s, in, out);
+	SSL_set_accept_state(s);
+	BIO_write(in, hello, (int)hello_len);
+	if (SSL_do_handshake(s) <= 0 && SSL_want_read(s))
+		{
+		/* Record header, handshake header, version and random, then
+		 * the session ID and the cipher */
+		n = BIO_read(out, buf, sizeof(buf));
+		if (n >= 44 && buf[0] == 22 && buf[5] == 2 &&
+		    n >= 44 + buf[43] + 2)
+			ret = SSL_CIPHER_find(s, buf + 44 + buf[43]);
+		}
+	SSL_free(s);
+	return ret;
+	}
+
+/* The server of |server_ciphers| picks |expect| (NULL: fails with no
+ * shared cipher) from a client offering |client_ciphers| */
+static int test_choice(const char *name, const char *server_ciphers,
+		       int server_pref, int with_ec, const char *client_ciphers,
+		       const char *expect)
+	{
+	unsigned char hello[4096];
+	long hello_len;
+	const SSL_CIPHER *c = NULL;
+	SSL_CTX *ctx;
+	int errors = 0;
+
+	if ((ctx = cs_server_ctx(server_ciphers, server_pref, with_ec)) == NULL)
+		return 1;
+	hello_len = make_client_hello(client_ciphers, hello, sizeof(hello));
+	if (hello_len == 0)
+		{
+		fprintf(stderr, "%s: cannot make a ClientHello\n", name);
+		errors++;
+		goto end;
+		}
+	ERR_clear_error();
+	c = answer_hello(ctx, hello, hello_len);
+	if (expect == NULL)
+		{
+		if (c != NULL || ERR_GET_REASON(ERR_peek_error()) !=
+		    SSL_R_NO_SHARED_CIPHER)
+			{
+			fprintf(stderr, "%s: got %s, expected no shared "
+				"cipher\n", name,
+				c != NULL ? SSL_CIPHER_get_name(c) : "error");
+			errors++;
+			}
+		}
+	else if (c == NULL || strcmp(SSL_CIPHER_get_name(c), expect) != 0)
+		{
+		fprintf(stderr, "%s: got %s, expected %s\n", name,
+			c != NULL ? SSL_CIPHER_get_name(c) : "nothing", expect);
+		errors++;
+		}
+	ERR_clear_error();
+ end:
+	SSL_CTX_free(ctx);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+static int test_cipher_sel(void)
+	{
+	int errors = 0;
+
+	if (!cs_make_ec_cert())
+		{
+		fprintf(stderr, "cannot make an ECDSA certificate\n");
+		ERR_print_errors_fp(stderr);
+		return 1;
+		}
+	errors += test_choice("client preference, RSA",
+		NULL, 0, 0, FIREFOX_CIPHERS, "ECDHE-RSA-AES128-GCM-SHA256");
+	errors += test_choice("server preference, RSA",
+		"DHE-RSA-AES128-GCM-SHA256:ECDHE-ECDSA-AES128-SHA:"
+		"AES256-SHA:AES128-SHA",
+		1, 0, CHROME_CIPHERS, "AES256-SHA");
+	errors += test_choice("no shared cipher",
+		NULL, 0, 0, "DHE-RSA-AES128-SHA:ECDHE-ECDSA-AES128-SHA", NULL);
+	errors += test_choice("server list not shared",
+		"AES256-GCM-SHA384:CAMELLIA128-SHA",
+		1, 0, FIREFOX_CIPHERS, NULL);
+#ifndef OPENSSL_NO_EC
+	errors += test_choice("client preference, RSA and ECDSA",
+		NULL, 0, 1, FIREFOX_CIPHERS, "ECDHE-ECDSA-AES128-GCM-SHA256");
+	errors += test_choice("server preference, RSA and ECDSA",
+		"AES128-SHA:ECDHE-ECDSA-AES256-GCM-SHA384:"
+		"ECDHE-RSA-AES256-GCM-SHA384",
+		1, 1, CHROME_CIPHERS, "AES128-SHA");
+	errors += test_choice("server preference, all ciphers offered",
+		"ECDHE-RSA-AES256-SHA384:ECDHE-ECDSA-AES128-SHA:AES128-SHA",
+		1, 1, ALL_CIPHERS, "ECDHE-RSA-AES256-SHA384");
+	errors += test_choice("client preference, all ciphers offered",
+		"AES128-SHA:ECDHE-RSA-AES256-SHA384:ECDHE-ECDSA-AES128-SHA",
+		0, 1, ALL_CIPHERS, "ECDHE-RSA-AES256-SHA384");
+#endif
+	cs_free_ec_cert();
+	return errors;
+	}
+
+/* Servers with certificates but no ephemeral keys answer ClientHellos:
+ * the ECDHE and DHE ciphers browsers put first are all passed over */
+static void bench_choice(const char *name, const char *client_ciphers,
+			 int server_pref, int n)
+	{
+	unsigned char hello[4096];
+	long hello_len;
+	SSL_CTX *ctx;
+	clock_t t;
+	int i;
+
+	if ((ctx = cs_server_ctx(NULL, server_pref, 1)) == NULL)
+		return;
+#ifndef OPENSSL_NO_EC
+	SSL_CTX_set_ecdh_auto(ctx, 0);
+#endif
+	if ((hello_len = make_client_hello(client_ciphers, hello,
+					   sizeof(hello))) == 0 ||
+	    answer_hello(ctx, hello, hello_len) == NULL)
+		{
+		fprintf(stderr, "%s: no cipher chosen\n", name);
+		ERR_print_errors_fp(stderr);
+		SSL_CTX_free(ctx);
+		return;
+		}
+	t = clock();
+	for (i = 0; i < n; i++)
+		answer_hello(ctx, hello, hello_len);
+	t = clock() - t;
+	printf("%-32s %8.2f us/ClientHello\n", name,
+		(double)t / CLOCKS_PER_SEC * 1e6 / n);
+	SSL_CTX_free(ctx);
+	}
+
+static int bench_cipher_sel(void)
+	{
+	int n = bench_n > 0 ? bench_n : 5000;
+
+	if (!cs_make_ec_cert())
+		{
+		fprintf(stderr, "cannot make an ECDSA certificate\n");
+		ERR_print_errors_fp(stderr);
+		return 0;
+		}
+	bench_choice("Firefox hello", FIREFOX_CIPHERS, 0, n);
+	bench_choice("Chrome hello", CHROME_CIPHERS, 0, n);
+	bench_choice("all ciphers hello", ALL_CIPHERS, 0, n);
+	bench_choice("all ciphers hello, server pref", ALL_CIPHERS, 1, n);
+	cs_free_ec_cert();
+	return 0;
+	}
+
+/* ClientHello callback
+ *
+ * The callback reads the extensions of each ClientHello, and can reject
+ * it, suspend the handshake or switch to another SSL_CTX by server
+ * name. */
+
+#ifndef OPENSSL_NO_TLSEXT
+
+#define CH_NAME "www.example.com"
+#define CH_OTHER_NAME "other.example.com"
+
+/* What the ClientHello callback saw and does */
+typedef struct
+	{
+	int calls;
+	int had_session;
+	char name[256];
+	int has_ticket_ext;
+	int has_bogus_ext;
+	int reject;
+	int retries;
+	SSL_CTX *other_ctx;
+	} CH_INFO;
+
+/* Reads the host name of a server_name extension into |name| */
+static int ch_host_name(const unsigned char *p, size_t len, char *name,
+			size_t name_len)
+	{
+	size_t list_len, n;
+
+	if (len < 5)
+		return 0;
+	list_len = (p[0] << 8) | p[1];
+	n = (p[3] << 8) | p[4];
+	if (list_len != len - 2 || p[2] != TLSEXT_NAMETYPE_host_name ||
+	    n + 3 > list_len || n >= name_len)
+		return 0;
+	memcpy(name, p + 5, n);
+	name[n] = '\0';
+	return 1;
+	}
+
+static int ch_cb(SSL *s, int *al, void *arg)
+	{
+	CH_INFO *info = arg;
+	const unsigned char *p;
+	size_t len;
+
+	info->calls++;
+	info->had_session = SSL_get_session(s) != NULL;
+	info->name[0] = '\0';
+	if (SSL_client_hello_get0_ext(s, TLSEXT_TYPE_server_name, &p, &len) &&
+	    !ch_host_name(p, len, info->name, sizeof(info->name)))
+		{
+		*al = SSL_AD_DECODE_ERROR;
+		return SSL_CLIENT_HELLO_ERROR;
+		}
+	info->has_ticket_ext = SSL_client_hello_get0_ext(s,
+		TLSEXT_TYPE_session_ticket, &p, &len);
+	info->has_bogus_ext = SSL_client_hello_get0_ext(s, 0xfafa, &p, &len);
+	if (info->retries > 0)
+		{
+		info->retries--;
+		return SSL_CLIENT_HELLO_RETRY;
+		}
+	if (info->reject)
+		{
+		*al = SSL_AD_ACCESS_DENIED;
+		return SSL_CLIENT_HELLO_ERROR;
+		}
+	if (info->other_ctx != NULL && strcmp(info->name, CH_OTHER_NAME) == 0)
+		SSL_set_SSL_CTX(s, info->other_ctx);
+	return SSL_CLIENT_HELLO_SUCCESS;
+	}
+
+/* The callback sees the server name and session ticket extensions, and no
+ * session yet; the ticket resumes the session and the extensions can no
+ * longer be looked up once the handshake is done */
+static int test_ch_extensions(const char *name)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	SSL *s = NULL, *c = NULL;
+	SSL_SESSION *sess = NULL;
+	CH_INFO info;
+	const unsigned char *p;
+	size_t len;
+	int errors = 0;
+
+	memset(&info, 0, sizeof(info));
+	if (!new_ctxs(&s_ctx, &c_ctx))
+		{
+		errors++;
+		goto end;
+		}
+	SSL_CTX_set_client_hello_cb(s_ctx, ch_cb, &info);
+	if (!connect_pair(s_ctx, c_ctx, &s, &c))
+		{
+		fprintf(stderr, "%s: handshake failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	if (info.calls != 1 || info.had_session ||
+	    strcmp(info.name, CH_NAME) != 0 ||
+	    !info.has_ticket_ext || info.has_bogus_ext)
+		{
+		fprintf(stderr, "%s: callback saw %d calls, session %d, "
+			"name \"%s\", ticket %d, bogus %d\n", name, info.calls,
+			info.had_session, info.name, info.has_ticket_ext,
+			info.has_bogus_ext);
+		errors++;
+		}
+	if (SSL_client_hello_get0_ext(s, TLSEXT_TYPE_server_name, &p, &len))
+		{
+		fprintf(stderr, "%s: extension found after the handshake\n",
+			name);
+		errors++;
+		}
+	sess = SSL_get1_session(c);
+	free_pair(s, c);
+	s = c = NULL;
+
+	if (!new_pair(s_ctx, c_ctx, &s, &c) || !SSL_set_session(c, sess) ||
+	    !handshake_pair(s, c) || !SSL_session_reused(c) ||
+	    info.calls != 2)
+		{
+		fprintf(stderr, "%s: session not resumed from its ticket\n",
+			name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		}
+ end:
+	free_pair(s, c);
+	if (sess != NULL)
+		SSL_SESSION_free(sess);
+	free_ctxs(s_ctx, c_ctx);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+/* A ClientHello the callback rejects fails with SSL_R_CLIENT_HELLO_CB_ERROR
+ * and the client gets its alert */
+static int test_ch_reject(const char *name)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	SSL *s = NULL, *c = NULL;
+	unsigned char hello[4096];
+	long hello_len;
+	CH_INFO info;
+	int errors = 0;
+
+	memset(&info, 0, sizeof(info));
+	info.reject = 1;
+	if (!new_ctxs(&s_ctx, &c_ctx) ||
+	    (hello_len = make_client_hello("DEFAULT", hello,
+					   sizeof(hello))) == 0)
+		{
+		errors++;
+		goto end;
+		}
+	SSL_CTX_set_client_hello_cb(s_ctx, ch_cb, &info);
+	ERR_clear_error();
+	if (answer_hello(s_ctx, hello, hello_len) != NULL || info.calls != 1 ||
+	    ERR_GET_REASON(ERR_peek_error()) != SSL_R_CLIENT_HELLO_CB_ERROR)
+		{
+		fprintf(stderr, "%s: ClientHello not rejected\n", name);
+		errors++;
+		}
+	ERR_clear_error();
+	/* The client's error, the alert, is the last in the queue */
+	if (connect_pair(s_ctx, c_ctx, &s, &c) || SSL_get_session(s) != NULL ||
+	    ERR_GET_REASON(ERR_peek_last_error()) !=
+	    SSL_R_TLSV1_ALERT_ACCESS_DENIED)
+		{
+		fprintf(stderr, "%s: client did not get the alert\n", name);
+		errors++;
+		}
+	ERR_clear_error();
+ end:
+	free_pair(s, c);
+	free_ctxs(s_ctx, c_ctx);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+/* A callback that asks to be called again suspends the handshake, which
+ * goes on with the same ClientHello */
+static int test_ch_retry(const char *name)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	SSL *s = NULL, *c = NULL;
+	CH_INFO info;
+	int r, errors = 0;
+
+	memset(&info, 0, sizeof(info));
+	info.retries = 2;
+	if (!new_ctxs(&s_ctx, &c_ctx) || !new_pair(s_ctx, c_ctx, &s, &c))
+		{
+		errors++;
+		goto end;
+		}
+	SSL_CTX_set_client_hello_cb(s_ctx, ch_cb, &info);
+	if ((r = SSL_do_handshake(c)) > 0 || !is_retry(c, r) ||
+	    !shuttle(mem_wbio(c), SSL_get_rbio(s)))
+		{
+		errors++;
+		goto end;
+		}
+	for (r = 0; r < 2; r++)
+		{
+		if (SSL_get_error(s, SSL_do_handshake(s)) !=
+		    SSL_ERROR_WANT_CLIENT_HELLO_CB ||
+		    !SSL_want_client_hello_cb(s) || info.calls != r + 1 ||
+		    BIO_ctrl_pending(mem_wbio(s)) != 0)
+			{
+			fprintf(stderr, "%s: handshake not suspended\n", name);
+			errors++;
+			goto end;
+			}
+		}
+	if (!handshake_pair(s, c) || info.calls != 3 ||
+	    strcmp(info.name, CH_NAME) != 0)
+		{
+		fprintf(stderr, "%s: handshake not resumed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		}
+ end:
+	free_pair(s, c);
+	free_ctxs(s_ctx, c_ctx);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+/* The callback switches to the SSL_CTX, and certificate, of a name */
+static int test_ch_switch(const char *name)
+	{
+	SSL_CTX *s_ctx = NULL, *s_ctx2 = NULL, *c_ctx = NULL;
+	SSL *s = NULL, *c = NULL;
+	X509 *peer = NULL, *want;
+	CH_INFO info;
+	int errors = 0;
+
+	memset(&info, 0, sizeof(info));
+	if (!new_ctxs(&s_ctx, &c_ctx) ||
+	    (s_ctx2 = SSL_CTX_new(SSLv23_server_method())) == NULL ||
+	    !SSL_CTX_use_certificate_file(s_ctx2, cert2_file,
+					  SSL_FILETYPE_PEM) ||
+	    !SSL_CTX_use_PrivateKey_file(s_ctx2, cert2_file, SSL_FILETYPE_PEM))
+		{
+		fprintf(stderr, "%s: cannot set up the servers\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	SSL_CTX_set_client_hello_cb(s_ctx, ch_cb, &info);
+	info.other_ctx = s_ctx2;
+	servername = CH_OTHER_NAME;
+	if (!connect_pair(s_ctx, c_ctx, &s, &c))
+		{
+		fprintf(stderr, "%s: handshake failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	peer = SSL_get_peer_certificate(c);
+	want = SSL_get_certificate(s);
+	if (SSL_get_SSL_CTX(s) != s_ctx2 || peer == NULL || want == NULL ||
+	    X509_cmp(peer, want) != 0 ||
+	    X509_cmp(peer, SSL_CTX_get0_certificate(s_ctx)) == 0)
+		{
+		fprintf(stderr, "%s: certificate of %s not used\n", name,
+			CH_OTHER_NAME);
+		errors++;
+		}
+ end:
+	servername = CH_NAME;
+	if (peer != NULL)
+		X509_free(peer);
+	free_pair(s, c);
+	if (s_ctx2 != NULL)
+		SSL_CTX_free(s_ctx2);
+	free_ctxs(s_ctx, c_ctx);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+/* Returns the offset in |hello| of the length of its extensions, or 0 */
+static long ch_find_extensions(const unsigned char *hello, long len)
+	{
+	long off = 5 + 4 + 2 + 32;
+
+	if (off >= len)
+		return 0;
+	off += 1 + hello[off];
+	if (off + 2 > len)
+		return 0;
+	off += 2 + ((hello[off] << 8) | hello[off + 1]);
+	if (off >= len)
+		return 0;
+	off += 1 + hello[off];
+	return off + 2 <= len ? off : 0;
+	}
+
+/* Extensions whose length overruns the ClientHello are all ignored, and
+ * the ClientHello is still answered */
+static int test_ch_overrun(const char *name)
+	{
+	unsigned char hello[4096];
+	long hello_len, off;
+	unsigned int len;
+	SSL_CTX *s_ctx = NULL;
+	CH_INFO info;
+	int errors = 0;
+
+	memset(&info, 0, sizeof(info));
+	if (!new_ctxs(&s_ctx, NULL))
+		{
+		errors++;
+		goto end;
+		}
+	SSL_CTX_set_client_hello_cb(s_ctx, ch_cb, &info);
+	if ((hello_len = make_client_hello("DEFAULT", hello,
+					   sizeof(hello))) == 0 ||
+	    (off = ch_find_extensions(hello, hello_len)) == 0)
+		{
+		fprintf(stderr, "%s: cannot make a ClientHello\n", name);
+		errors++;
+		goto end;
+		}
+	if (answer_hello(s_ctx, hello, hello_len) == NULL ||
+	    strcmp(info.name, CH_NAME) != 0)
+		{
+		fprintf(stderr, "%s: ClientHello not answered\n", name);
+		errors++;
+		goto end;
+		}
+	len = ((hello[off] << 8) | hello[off + 1]) + 1;
+	hello[off] = (unsigned char)(len >> 8);
+	hello[off + 1] = (unsigned char)len;
+	if (answer_hello(s_ctx, hello, hello_len) == NULL ||
+	    info.name[0] != '\0' || info.has_ticket_ext || info.calls != 2)
+		{
+		fprintf(stderr, "%s: overrunning extensions not ignored\n",
+			name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		}
+ end:
+	free_ctxs(s_ctx, NULL);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+
+#ifndef OPENSSL_NO_DTLS1
+static const unsigned char ch_cookie[] = "sslapitest cookie";
+static int ch_cookies;
+
+static int ch_gen_cookie(SSL *s, unsigned char *cookie,
+			 unsigned int *cookie_len)
+	{
+	ch_cookies++;
+	memcpy(cookie, ch_cookie, sizeof(ch_cookie));
+	*cookie_len = sizeof(ch_cookie);
+	return 1;
+	}
+
+static int ch_verify_cookie(SSL *s, unsigned char *cookie,
+			    unsigned int cookie_len)
+	{
+	return cookie_len == sizeof(ch_cookie) &&
+		memcmp(cookie, ch_cookie, cookie_len) == 0;
+	}
+
+/* A DTLS server exchanging cookies calls the callback once, for the
+ * ClientHello with the cookie */
+static int test_ch_dtls_cookie(const char *name)
+	{
+	SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+	SSL *s = NULL, *c = NULL;
+	CH_INFO info;
+	int errors = 0;
+
+	memset(&info, 0, sizeof(info));
+	ch_cookies = 0;
+	if ((s_ctx = SSL_CTX_new(DTLS_server_method())) == NULL ||
+	    (c_ctx = SSL_CTX_new(DTLS_client_method())) == NULL ||
+	    !SSL_CTX_use_certificate_file(s_ctx, cert_file, SSL_FILETYPE_PEM) ||
+	    !SSL_CTX_use_PrivateKey_file(s_ctx, cert_file, SSL_FILETYPE_PEM))
+		{
+		fprintf(stderr, "%s: cannot set up contexts\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	SSL_CTX_set_options(s_ctx, SSL_OP_COOKIE_EXCHANGE);
+	SSL_CTX_set_cookie_generate_cb(s_ctx, ch_gen_cookie);
+	SSL_CTX_set_cookie_verify_cb(s_ctx, ch_verify_cookie);
+	SSL_CTX_set_client_hello_cb(s_ctx, ch_cb, &info);
+	if (!new_pair(s_ctx, c_ctx, &s, &c))
+		{
+		errors++;
+		goto end;
+		}
+	/* Memory BIOs have no MTU to query */
+	SSL_set_options(s, SSL_OP_NO_QUERY_MTU);
+	SSL_set_options(c, SSL_OP_NO_QUERY_MTU);
+	SSL_set_mtu(s, 1400);
+	SSL_set_mtu(c, 1400);
+	if (!handshake_pair(s, c) || ch_cookies != 1 || info.calls != 1 ||
+	    strcmp(info.name, CH_NAME) != 0)
+		{
+		fprintf(stderr, "%s: %d cookies, %d callbacks\n", name,
+			ch_cookies, info.calls);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		}
+ end:
+	free_pair(s, c);
+	free_ctxs(s_ctx, c_ctx);
+	if (errors == 0)
+		printf("%s: ok\n", name);
+	return errors;
+	}
+#endif
+
+static int test_client_hello(void)
+	{
+	int errors = 0;
+
+	servername = CH_NAME;
+	errors += test_ch_extensions("extensions and tickets");
+	errors += test_ch_reject("ClientHello rejected");
+	errors += test_ch_retry("callback retried");
+	errors += test_ch_switch("SSL_CTX switched by name");
+	errors += test_ch_overrun("overrunning extensions");
+#ifndef OPENSSL_NO_DTLS1
+	errors += test_ch_dtls_cookie("DTLS cookie exchange");
+#endif
+	servername = NULL;
+	return errors;
+	}
+
+#endif
+
+/* Multi-record AES-GCM */
+
+#ifndef OPENSSL_NO_MULTIBLOCK
+#define MULTIBLOCK_CIPHER "AES128-GCM-SHA256"
+
+/* Read buffer for eight full records */
+#define BIG_READ_BUF (8 * SSL3_RT_MAX_PACKET_SIZE)
+
+/* Any message callback makes SSL_write() seal one record at a time */
+static void no_multiblock(int write_p, int version, int content_type,
+			  const void *buf, size_t len, SSL *ssl, void *arg)
+	{
+	}
+
+/* Seals |len| bytes of |data| on |c|, leaving the records in the write BIO
+ * of |c| and counting the BIO writes */
+static int seal(SSL *c, const unsigned char *data, int len, int multi)
+	{
+	int r;
+
+	(void)BIO_reset(SSL_get_wbio(c));
+	SSL_set_msg_callback(c, multi ? NULL : no_multiblock);
+	num_writes = 0;
+	counting = 1;
+	r = SSL_write(c, data, len);
+	counting = 0;
+	return r == len;
+	}
+
+/* Reads up to |len| bytes into |got| from the records queued for |s|.
+ * Returns the number of bytes read before an error or the end of the
+ * records. */
+static int open_all(SSL *s, unsigned char *got, int len)
+	{
+	int r, nread = 0;
+
+	while (nread < len)
+		{
+		if ((r = SSL_read(s, got + nread, len - nread)) <= 0)
+			break;
+		nread += r;
+		}
+	return nread;
+	}
+
+/* Sends nine records, the last one short, all of which fit in the larger
+ * read buffer. At most eight are sealed or opened together. */
+static int test_transfer(const char *name, SSL_CTX *s_ctx, SSL_CTX *c_ctx,
+			 int multi_write, unsigned int expect_ready)
+	{
+	static unsigned char data[8 * SSL3_RT_MAX_PLAIN_LENGTH + 1000];
+	static unsigned char got[sizeof(data)];
+	SSL *s = NULL, *c = NULL;
+	unsigned int ready;
+	int len = sizeof(data), errors = 0;
+
+	RAND_pseudo_bytes(data, sizeof(data));
+	if (!connect_pair(s_ctx, c_ctx, &s, &c))
+		{
+		fprintf(stderr, "%s: handshake failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	BIO_set_callback(SSL_get_wbio(c), count_writes);
+	if (!seal(c, data, len, multi_write) ||
+	    !shuttle(SSL_get_wbio(c), SSL_get_rbio(s)))
+		{
+		fprintf(stderr, "%s: write failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	/* Eight records are sealed together, the short last one alone */
+	if (multi_write && num_writes != 2)
+		{
+		fprintf(stderr, "%s: records sealed in %ld writes\n", name,
+			num_writes);
+		errors++;
+		}
+
+	/* The first read opens the rest of the buffered records too */
+	if (SSL_read(s, got, SSL3_RT_MAX_PLAIN_LENGTH) !=
+	    SSL3_RT_MAX_PLAIN_LENGTH)
+		{
+		fprintf(stderr, "%s: first read failed\n", name);
+		errors++;
+		goto end;
+		}
+	ready = s->s3->rrec_ready;
+	if (ready != expect_ready)
+		{
+		fprintf(stderr, "%s: %u records opened ahead, expected %u\n",
+			name, ready, expect_ready);
+		errors++;
+		}
+	if (open_all(s, got + SSL3_RT_MAX_PLAIN_LENGTH,
+		     len - SSL3_RT_MAX_PLAIN_LENGTH) !=
+	    len - SSL3_RT_MAX_PLAIN_LENGTH || memcmp(got, data, len) != 0)
+		{
+		fprintf(stderr, "%s: data corrupted\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		}
+
+	if (errors == 0)
+		printf("%s: ok\n", name);
+ end:
+	free_pair(s, c);
+	return errors;
+	}
+
+/* Flips a bit in the third of a batch of records */
+static int test_bad_record(SSL_CTX *s_ctx, SSL_CTX *c_ctx)
+	{
+	static unsigned char data[8 * SSL3_RT_MAX_PLAIN_LENGTH];
+	static unsigned char got[sizeof(data)];
+	const char *name = "multiblock bad record in a batch";
+	SSL *s = NULL, *c = NULL;
+	char *p;
+	long plen;
+	int errors = 0, nread, rec_len;
+
+	RAND_pseudo_bytes(data, sizeof(data));
+	if (!connect_pair(s_ctx, c_ctx, &s, &c) ||
+	    !seal(c, data, sizeof(data), 1))
+		{
+		fprintf(stderr, "%s: setup failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	plen = BIO_get_mem_data(SSL_get_wbio(c), &p);
+	rec_len = SSL3_RT_HEADER_LENGTH + ((unsigned char)p[3] << 8 |
+					   (unsigned char)p[4]);
+	if (plen < 3 * rec_len)
+		{
+		fprintf(stderr, "%s: too few records\n", name);
+		errors++;
+		goto end;
+		}
+	p[2 * rec_len + 100] ^= 1;
+	shuttle(SSL_get_wbio(c), SSL_get_rbio(s));
+
+	nread = open_all(s, got, sizeof(data));
+	if (nread != 2 * SSL3_RT_MAX_PLAIN_LENGTH ||
+	    memcmp(got, data, nread) != 0 ||
+	    ERR_GET_REASON(ERR_peek_error()) !=
+	    SSL_R_DECRYPTION_FAILED_OR_BAD_RECORD_MAC)
+		{
+		fprintf(stderr, "%s: read %d bytes before the error\n", name,
+			nread);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		}
+	ERR_clear_error();
+
+	if (errors == 0)
+		printf("%s: ok\n", name);
+ end:
+	free_pair(s, c);
+	return errors;
+	}
+
+/* The stitched AES-CBC-HMAC-SHA1 cipher seals eight full records in one
+ * write with SSL_MODE_AEAD_MULTI_RECORD, and one record per write without */
+static int test_cbc_multi(SSL_CTX *s_ctx, int multi)
+	{
+	static unsigned char data[8 * SSL3_RT_MAX_PLAIN_LENGTH];
+	const char *name = multi ? "multiblock CBC with the mode"
+				 : "multiblock CBC without the mode";
+	SSL_CTX *c_ctx;
+	SSL *s = NULL, *c = NULL;
+	long expect = multi ? 1 : 8;
+	int errors = 0;
+
+	if ((c_ctx = SSL_CTX_new(TLSv1_2_client_method())) == NULL ||
+	    !SSL_CTX_set_cipher_list(c_ctx, "AES128-SHA"))
+		{
+		fprintf(stderr, "%s: cannot set up the client\n", name);
+		if (c_ctx != NULL)
+			SSL_CTX_free(c_ctx);
+		return 1;
+		}
+	if (multi)
+		SSL_CTX_set_mode(c_ctx, SSL_MODE_AEAD_MULTI_RECORD);
+	RAND_pseudo_bytes(data, sizeof(data));
+	if (!connect_pair(s_ctx, c_ctx, &s, &c))
+		{
+		fprintf(stderr, "%s: handshake failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	BIO_set_callback(SSL_get_wbio(c), count_writes);
+	if (!seal(c, data, sizeof(data), 1))
+		{
+		fprintf(stderr, "%s: write failed\n", name);
+		ERR_print_errors_fp(stderr);
+		errors++;
+		}
+	else if (num_writes != expect)
+		{
+		fprintf(stderr, "%s: records sealed in %ld writes, "
+			"expected %ld\n", name, num_writes, expect);
+		errors++;
+		}
+	if (errors == 0)
+		printf("%s: ok\n", name);
+ end:
+	free_pair(s, c);
+	SSL_CTX_free(c_ctx);
+	return errors;
+	}
+
+/* A server context with read ahead, a read buffer of |read_buf_len| and
+ * SSL_MODE_AEAD_MULTI_RECORD if |multi| */
+static SSL_CTX *multiblock_server(long read_buf_len, int multi)
+	{
+	SSL_CTX *ctx;
+
+	if (!new_ctxs(&ctx, NULL))
+		return NULL;
+	if (!SSL_CTX_set_default_read_buffer_len(ctx, read_buf_len))
+		{
+		SSL_CTX_free(ctx);
+		return NULL;
+		}
+	SSL_CTX_set_read_ahead(ctx, 1);
+	if (multi)
+		SSL_CTX_set_mode(ctx, SSL_MODE_AEAD_MULTI_RECORD);
+	return ctx;
+	}
+
+static int test_multiblock(void)
+	{
+	SSL_CTX *s_ctx = NULL, *s_ctx_big = NULL, *s_ctx_off = NULL;
+	SSL_CTX *c_ctx = NULL;
+	int errors = 0;
+
+	/* Only the cipher knows whether it can handle several records, which
+	 * takes AES-NI */
+	if (!(EVP_CIPHER_flags(EVP_aes_128_gcm()) &
+	      EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK))
+		{
+		printf("No multi-record AES-GCM, multiblock skipped\n");
+		return 0;
+		}
+	if ((s_ctx = multiblock_server(0, 1)) == NULL ||
+	    (s_ctx_big = multiblock_server(BIG_READ_BUF, 1)) == NULL ||
+	    (s_ctx_off = multiblock_server(BIG_READ_BUF, 0)) == NULL ||
+	    (c_ctx = SSL_CTX_new(TLSv1_2_client_method())) == NULL ||
+	    !SSL_CTX_set_cipher_list(c_ctx, MULTIBLOCK_CIPHER))
+		{
+		fprintf(stderr, "multiblock: cannot set up contexts\n");
+		ERR_print_errors_fp(stderr);
+		errors++;
+		goto end;
+		}
+	SSL_CTX_set_mode(c_ctx, SSL_MODE_AEAD_MULTI_RECORD);
+
+	errors += test_transfer("multiblock seal and open", s_ctx_big, c_ctx,
+				1, 7);
+	errors += test_transfer("multiblock seal, single open", s_ctx, c_ctx,
+				1, 0);
+	errors += test_transfer("single seal, multiblock open", s_ctx_big,
+				c_ctx, 0, 7);
+	errors += test_bad_record(s_ctx_big, c_ctx);
+	/* The mode is off on the server, which opens a record at a time */
+	errors += test_transfer("multiblock without the mode", s_ctx_off,
+				c_ctx, 1, 0);
+	if (EVP_CIPHER_flags(EVP_aes_128_cbc_hmac_sha1()) &
+	    EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK)
+		{
+		errors += test_cbc_multi(s_ctx_off, 1);
+		errors += test_cbc_multi(s_ctx_off, 0);
+		}
+ end:
+	if (s_ctx_big != NULL)
+		SSL_CTX_free(s_ctx_big);
+	if (s_ctx_off != NULL)
+		SSL_CTX_free(s_ctx_off);
+	free_ctxs(s_ctx, c_ctx);
+	return errors;
+	}
+#endif
+
+static struct
+	{
+	const char *name;
+	int (*test)(void);
+	int bench;		/* run only when named */
+	} tests[] =
+	{
+	{ "sessenc", test_sessenc, 0 },
+	{ "sessencbench", bench_sessenc, 1 },
+	{ "writev", test_writev, 0 },
+	{ "readbatch", test_read_batch, 0 },
+	{ "bufpool", test_bufpool, 0 },
+	{ "idleconn", test_idle_conn, 0 },
+	{ "transcript", test_transcript, 0 },
+	{ "transcriptbench", bench_transcript, 1 },
+	{ "cipherlist", test_cipher_list, 0 },
+	{ "ciphersel", test_cipher_sel, 0 },
+	{ "cipherselbench", bench_cipher_sel, 1 },
+#ifndef OPENSSL_NO_TLSEXT
+	{ "clienthello", test_client_hello, 0 },
+#endif
+#ifndef OPENSSL_NO_MULTIBLOCK
+	{ "multiblock", test_multiblock, 0 },
+#endif
+	};
+
+#define NUM_TESTS (int)(sizeof(tests) / sizeof(tests[0]))
+
+int main(int argc, char *argv[])
+	{
+	int i, j, errors = 0, run[NUM_TESTS];
+
+	/* Must be set before anything is allocated */
+	CRYPTO_set_mem_functions(count_malloc, count_realloc, count_free);
+
+	memset(run, 0, sizeof(run));
+	for (argc--, argv++; argc > 0; argc--, argv++)
+		{
+		if (strcmp(*argv, "-cert") == 0 && argc > 1)
+			{
+			cert_file = *(++argv);
+			argc--;
+			continue;
+			}
+		if (strcmp(*argv, "-cert2") == 0 && argc > 1)
+			{
+			cert2_file = *(++argv);
+			argc--;
+			continue;
+			}
+		if (strcmp(*argv, "-n") == 0 && argc > 1)
+			{
+			bench_n = atoi(*(++argv));
+			argc--;
+			continue;
+			}
+		for (i = 0; i < NUM_TESTS; i++)
+			{
+			if (strcmp(*argv, tests[i].name) == 0)
+				break;
+			}
+		if (i == NUM_TESTS)
+			{
+			fprintf(stderr, "usage: sslapitest [-cert file] "
+				"[-cert2 file] [-n iterations] [test ...]\n"
+				"tests:");
+			for (j = 0; j < NUM_TESTS; j++)
+				if (!tests[j].bench)
+					fprintf(stderr, " %s", tests[j].name);
+			fprintf(stderr, "\nbenchmarks:");
+			for (j = 0; j < NUM_TESTS; j++)
+				if (tests[j].bench)
+					fprintf(stderr, " %s", tests[j].name);
+			fprintf(stderr, "\n");
+			return 1;
+			}
+		run[i] = 1;
+		}
+	/* No test named: run them all but the benchmarks */
+	for (i = 0; i < NUM_TESTS && !run[i]; i++)
+		;
+	if (i == NUM_TESTS)
+		for (i = 0; i < NUM_TESTS; i++)
+			run[i] = !tests[i].bench;
+
+	SSL_library_init();
+	SSL_load_error_strings();
+
+	for (i = 0; i < NUM_TESTS; i++)
+		{
+		if (run[i])
+			errors += tests[i].test();
+		}
+
+	ERR_free_strings();
+	EVP_cleanup();
+	CRYPTO_cleanup_all_ex_data();
+	ERR_remove_thread_state(NULL);
+
+	if (errors)
+		ERR_print_errors_fp(stderr);
+	return errors > 0 ? 1 : 0;
+	}
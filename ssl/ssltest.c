@@ -840,6 +840,7 @@ static int supp_data_2_cli_first_cb(SSL *s, unsigned short supp_data_type,
 static char *cipher=NULL;
 static int verbose=0;
 static int debug=0;
+static int use_writev=0;
 #if 0
 /* Not used yet. */
 #ifdef FIONBIO
@@ -861,12 +862,21 @@ static void sv_usage(void)
 #endif
 	fprintf(stderr," -server_auth  - check server certificate\n");
 	fprintf(stderr," -client_auth  - do client authentication\n");
+	fprintf(stderr," -client_sigalgs arg - signature algorithms the client may use to authenticate\n");
 	fprintf(stderr," -proxy        - allow proxy certificates\n");
 	fprintf(stderr," -proxy_auth <val> - set proxy policy rights\n");
 	fprintf(stderr," -proxy_cond <val> - experssion to test proxy policy rights\n");
 	fprintf(stderr," -v            - more output\n");
 	fprintf(stderr," -d            - debug output\n");
 	fprintf(stderr," -reuse        - use session-id reuse\n");
+	fprintf(stderr," -sess_shards  - use a sharded server session cache and no tickets\n");
+	fprintf(stderr," -shm_sess_cache - use only a shared memory server session cache and no tickets\n");
+	fprintf(stderr," -compact_tickets - issue session tickets with the compact session encoding\n");
+	fprintf(stderr," -ticket_key_ring - rotate ticket keys of a key ring between connections\n");
+	fprintf(stderr," -multi_record - read ahead and seal and open several AEAD records at once\n");
+	fprintf(stderr," -read_batch   - read ahead and return several records per read\n");
+	fprintf(stderr," -release_buffers - release the record buffers to the pool when idle\n");
+	fprintf(stderr," -release_handshake_state - share the certificate settings and free the handshake state when idle\n");
 	fprintf(stderr," -num <val>    - number of connections to perform\n");
 	fprintf(stderr," -bytes <val>  - number of bytes to swap between client/server\n");
 #ifndef OPENSSL_NO_DH
@@ -901,6 +911,7 @@ static void sv_usage(void)
 	fprintf(stderr," -c_key arg    - Client key file (default: same as -c_cert)\n");
 	fprintf(stderr," -cipher arg   - The cipher list\n");
 	fprintf(stderr," -bio_pair     - Use BIO pairs\n");
+	fprintf(stderr," -writev       - write the client's data with SSL_writev() over BIO pairs\n");
 	fprintf(stderr," -f            - Test even cases that can't work\n");
 	fprintf(stderr," -time         - measure processor time used by client and server\n");
 	fprintf(stderr," -zlib         - use zlib compression\n");
@@ -1061,6 +1072,7 @@ int main(int argc, char *argv[])
 	int force=0;
 	int tls1=0,ssl2=0,ssl3=0,ret=1;
 	int client_auth=0;
+	char *client_sigalgs=NULL;
 	int server_auth=0,i;
 	struct app_verify_arg app_verify_arg =
 		{ APP_CALLBACK_STRING, 0, 0, NULL, NULL };
@@ -1075,7 +1087,12 @@ int main(int argc, char *argv[])
 	SSL_CTX *c_ctx=NULL;
 	const SSL_METHOD *meth=NULL;
 	SSL *c_ssl,*s_ssl;
-	int number=1,reuse=0;
+	int number=1,reuse=0,sess_shards=0,shm_sess_cache=0,compact_tickets=0;
+	int multi_record=0,read_batch=0,release_buffers=0;
+	int release_handshake_state=0;
+	int ticket_key_ring=0;
+	unsigned char ticket_keys[2][48];
+	SSL_SHM_SESS_CACHE *shm_cache=NULL;
 	long bytes=256L;
 #ifndef OPENSSL_NO_DH
 	DH *dh;
@@ -1148,6 +1165,11 @@ int main(int argc, char *argv[])
 			server_auth=1;
 		else if	(strcmp(*argv,"-client_auth") == 0)
 			client_auth=1;
+		else if	(strcmp(*argv,"-client_sigalgs") == 0)
+			{
+			if (--argc < 1) goto bad;
+			client_sigalgs= *(++argv);
+			}
 		else if (strcmp(*argv,"-proxy_auth") == 0)
 			{
 			if (--argc < 1) goto bad;
@@ -1164,6 +1186,22 @@ int main(int argc, char *argv[])
 			debug=1;
 		else if	(strcmp(*argv,"-reuse") == 0)
 			reuse=1;
+		else if	(strcmp(*argv,"-sess_shards") == 0)
+			sess_shards=1;
+		else if	(strcmp(*argv,"-shm_sess_cache") == 0)
+			shm_sess_cache=1;
+		else if	(strcmp(*argv,"-compact_tickets") == 0)
+			compact_tickets=1;
+		else if	(strcmp(*argv,"-multi_record") == 0)
+			multi_record=1;
+		else if	(strcmp(*argv,"-read_batch") == 0)
+			read_batch=1;
+		else if	(strcmp(*argv,"-release_buffers") == 0)
+			release_buffers=1;
+		else if	(strcmp(*argv,"-release_handshake_state") == 0)
+			release_handshake_state=1;
+		else if	(strcmp(*argv,"-ticket_key_ring") == 0)
+			ticket_key_ring=1;
 		else if	(strcmp(*argv,"-dhe1024") == 0)
 			{
 #ifndef OPENSSL_NO_DH
@@ -1282,6 +1320,8 @@ int main(int argc, char *argv[])
 			{
 			bio_pair = 1;
 			}
+		else if	(strcmp(*argv,"-writev") == 0)
+			use_writev = 1;
 		else if	(strcmp(*argv,"-f") == 0)
 			{
 			force = 1;
@@ -1430,6 +1470,11 @@ bad:
 		if (number < 50 && !force)
 			fprintf(stderr, "Warning: For accurate timings, use more connections (e.g. -num 1000)\n");
 		}
+	if (use_writev && !bio_pair)
+		{
+		fprintf(stderr, "Using BIO pair (-bio_pair)\n");
+		bio_pair = 1;
+		}
 
 /*	if (cipher == NULL) cipher=getenv("SSL_CIPHER"); */
 
@@ -1513,6 +1558,72 @@ bad:
 	SSL_CTX_set_security_level(c_ctx, 0);
 	SSL_CTX_set_security_level(s_ctx, 0);
 
+	if (sess_shards)
+		{
+		/* Resume via the session ID so the internal cache is used */
+		SSL_CTX_set_session_cache_mode(s_ctx,
+			SSL_SESS_CACHE_SERVER|SSL_SESS_CACHE_SHARDED);
+		SSL_CTX_set_options(s_ctx, SSL_OP_NO_TICKET);
+		}
+
+	if (compact_tickets)
+		SSL_CTX_set_mode(s_ctx, SSL_MODE_COMPACT_SESSION_TICKET);
+
+	if (multi_record)
+		{
+		SSL_CTX_set_mode(s_ctx, SSL_MODE_AEAD_MULTI_RECORD);
+		SSL_CTX_set_mode(c_ctx, SSL_MODE_AEAD_MULTI_RECORD);
+		SSL_CTX_set_read_ahead(s_ctx, 1);
+		SSL_CTX_set_read_ahead(c_ctx, 1);
+		}
+
+	if (release_buffers)
+		{
+		SSL_CTX_set_mode(s_ctx, SSL_MODE_RELEASE_BUFFERS);
+		SSL_CTX_set_mode(c_ctx, SSL_MODE_RELEASE_BUFFERS);
+		}
+
+	if (release_handshake_state)
+		{
+		SSL_CTX_set_mode(s_ctx, SSL_MODE_RELEASE_HANDSHAKE_STATE);
+		SSL_CTX_set_mode(c_ctx, SSL_MODE_RELEASE_HANDSHAKE_STATE);
+		}
+
+	if (read_batch)
+		{
+		SSL_CTX_set_mode(s_ctx, SSL_MODE_READ_BATCH);
+		SSL_CTX_set_mode(c_ctx, SSL_MODE_READ_BATCH);
+		SSL_CTX_set_read_ahead(s_ctx, 1);
+		SSL_CTX_set_read_ahead(c_ctx, 1);
+		}
+
+	if (ticket_key_ring)
+		{
+		/* Only tickets may resume, see the rotation below */
+		SSL_CTX_set_session_cache_mode(s_ctx, SSL_SESS_CACHE_OFF);
+		RAND_pseudo_bytes(&ticket_keys[0][0], sizeof(ticket_keys));
+		if (!SSL_CTX_add_ticket_key(s_ctx, ticket_keys[0], 1))
+			{
+			ERR_print_errors(bio_err);
+			goto end;
+			}
+		}
+
+	if (shm_sess_cache)
+		{
+		/* Every resumption has to come from the shared memory cache */
+		shm_cache = SSL_SHM_SESS_CACHE_new(NULL, 64, 0);
+		if (shm_cache == NULL ||
+		    !SSL_CTX_set_shm_session_cache(s_ctx, shm_cache))
+			{
+			ERR_print_errors(bio_err);
+			goto end;
+			}
+		SSL_CTX_set_session_cache_mode(s_ctx,
+			SSL_SESS_CACHE_SERVER|SSL_SESS_CACHE_NO_INTERNAL);
+		SSL_CTX_set_options(s_ctx, SSL_OP_NO_TICKET);
+		}
+
 	if (cipher != NULL)
 		{
 		SSL_CTX_set_cipher_list(c_ctx,cipher);
@@ -1623,6 +1734,12 @@ bad:
 			SSL_VERIFY_PEER|SSL_VERIFY_FAIL_IF_NO_PEER_CERT,
 			verify_callback);
 		SSL_CTX_set_cert_verify_callback(s_ctx, app_verify_callback, &app_verify_arg);
+		if (client_sigalgs != NULL &&
+			!SSL_CTX_set1_client_sigalgs_list(s_ctx, client_sigalgs))
+			{
+			ERR_print_errors(bio_err);
+			goto end;
+			}
 		}
 	if (server_auth)
 		{
@@ -1821,6 +1938,17 @@ bad:
 
 	for (i=0; i<number; i++)
 		{
+		/* Rotate to a new key, which renews the ticket issued under the
+		 * old one, then retire the old key */
+		if ((ticket_key_ring && i == 1 &&
+		     !SSL_CTX_add_ticket_key(s_ctx, ticket_keys[1], 1)) ||
+		    (ticket_key_ring && i == 2 &&
+		     !SSL_CTX_remove_ticket_key(s_ctx, ticket_keys[0])))
+			{
+			ERR_print_errors(bio_err);
+			ret = 1;
+			break;
+			}
 		if (!reuse) SSL_set_session(c_ssl,NULL);
 		if (bio_pair)
 			ret=doit_biopair(s_ssl,c_ssl,bytes,&s_time,&c_time);
@@ -1828,6 +1956,36 @@ bad:
 			ret=doit(s_ssl,c_ssl,bytes);
 		}
 
+	if ((sess_shards || compact_tickets || ticket_key_ring) && reuse &&
+	    ret == 0 &&
+	    SSL_CTX_sess_hits(s_ctx) != number - 1)
+		{
+		BIO_printf(bio_err, "expected %d session cache hits, got %ld\n",
+			number - 1, SSL_CTX_sess_hits(s_ctx));
+		ret = 1;
+		}
+
+	/* The table of SSL_CTX_sessions() has all sessions of the shards */
+	if (sess_shards && ret == 0 &&
+	    (SSL_CTX_sess_number(s_ctx) == 0 ||
+	     (long)lh_SSL_SESSION_num_items(SSL_CTX_sessions(s_ctx)) !=
+	     SSL_CTX_sess_number(s_ctx)))
+		{
+		BIO_printf(bio_err, "SSL_CTX_sessions() has %lu of %ld "
+			"sessions\n",
+			lh_SSL_SESSION_num_items(SSL_CTX_sessions(s_ctx)),
+			SSL_CTX_sess_number(s_ctx));
+		ret = 1;
+		}
+
+	if (shm_sess_cache && reuse && ret == 0 &&
+	    SSL_CTX_sess_cb_hits(s_ctx) != number - 1)
+		{
+		BIO_printf(bio_err, "expected %d shared cache hits, got %ld\n",
+			number - 1, SSL_CTX_sess_cb_hits(s_ctx));
+		ret = 1;
+		}
+
 	if (!verbose)
 		{
 		print_details(c_ssl, "");
@@ -1861,7 +2019,9 @@ bad:
 
 end:
 	if (s_ctx != NULL) SSL_CTX_free(s_ctx);
+	if (shm_cache != NULL) SSL_SHM_SESS_CACHE_free(shm_cache);
 	if (c_ctx != NULL) SSL_CTX_free(c_ctx);
+	SSL_flush_cipher_list_cache();
 
 	if (bio_stdout != NULL) BIO_free(bio_stdout);
 
@@ -1972,14 +2132,41 @@ int doit_biopair(SSL *s_ssl, SSL *c_ssl, long count,
 				{
 				/* Write to server. */
 				
-				if (cw_num > (long)sizeof cbuf)
-					i = sizeof cbuf;
+				if (use_writev)
+					{
+					/* The buffer in pieces of uneven sizes. A
+					 * retry passes the same array again. */
+					static SSL_IOVEC iov[4];
+					static const size_t piece[4] =
+						{ 100, 1000, 3000, sizeof cbuf - 4100 };
+					long left = cw_num;
+					size_t off = 0;
+
+					for (i = 0; i < 4; i++)
+						{
+						iov[i].base = (unsigned char *)cbuf + off;
+						iov[i].len = piece[i];
+						if ((long)iov[i].len > left)
+							iov[i].len = left;
+						left -= iov[i].len;
+						off += iov[i].len;
+						}
+					r = SSL_writev(c_ssl, iov, 4);
+					}
 				else
-					i = (int)cw_num;
-				r = BIO_write(c_ssl_bio, cbuf, i);
+					{
+					if (cw_num > (long)sizeof cbuf)
+						i = sizeof cbuf;
+					else
+						i = (int)cw_num;
+					r = BIO_write(c_ssl_bio, cbuf, i);
+					}
 				if (r < 0)
 					{
-					if (!BIO_should_retry(c_ssl_bio))
+					if (use_writev ?
+					    SSL_get_error(c_ssl, r) != SSL_ERROR_WANT_WRITE &&
+					    SSL_get_error(c_ssl, r) != SSL_ERROR_WANT_READ :
+					    !BIO_should_retry(c_ssl_bio))
 						{
 						fprintf(stderr,"ERROR in CLIENT\n");
 						goto err;
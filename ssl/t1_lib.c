@@ -1341,7 +1341,7 @@ unsigned char *ssl_add_clienthello_tlsext(SSL *s, unsigned char *p, unsigned cha
 		etmp = ret;
 		/* Skip over lengths for now */
 		ret += 4;
-		salglen = tls12_copy_sigalgs(s, etmp, salg, salglen);
+		salglen = tls12_copy_sigalgs(s, ret, salg, salglen);
 		/* Fill in lengths */
 		s2n(salglen + 2, etmp);
 		s2n(salglen, etmp);
@@ -1866,6 +1866,100 @@ parse_error:
 	return -1;
 	}
 
+/* tls1_index_clienthello_tlsext records the type, offset and length of
+ * each extension of the ClientHello |d|, of length |n|, in s->s3, for
+ * SSL_client_hello_get0_ext() to find them. The rest of the ClientHello is
+ * checked when it is parsed: here one that is too short just has no
+ * extensions. As in the parser, extensions whose total length overruns
+ * the message are all ignored, and so are those from the first that
+ * overruns it. Returns 1 on success and 0 on allocation failure. */
+int tls1_index_clienthello_tlsext(SSL *s, const unsigned char *d, long n)
+	{
+	TLS1_EXT_INDEX *ext;
+	unsigned int type, size;
+	long off, len;
+
+	s->s3->client_exts_num = 0;
+
+	/* Skip the version, random, session ID, DTLS cookie, cipher list
+	 * and compression methods */
+	off = 2 + SSL3_RANDOM_SIZE;
+	if (off >= n)
+		return 1;
+	off += 1 + d[off];
+	if (SSL_IS_DTLS(s))
+		{
+		if (off >= n)
+			return 1;
+		off += 1 + d[off];
+		}
+	if (off + 2 > n)
+		return 1;
+	off += 2 + ((d[off] << 8) | d[off + 1]);
+	if (off >= n)
+		return 1;
+	off += 1 + d[off];
+
+	if (off >= n - 2)
+		return 1;
+	len = (d[off] << 8) | d[off + 1];
+	off += 2;
+	if (off > n - len)
+		return 1;
+
+	while (off <= n - 4)
+		{
+		type = (d[off] << 8) | d[off + 1];
+		size = (d[off + 2] << 8) | d[off + 3];
+		off += 4;
+		if (off + size > n)
+			return 1;
+		if (s->s3->client_exts_num == s->s3->client_exts_max)
+			{
+			size_t max = s->s3->client_exts_max ?
+				2 * s->s3->client_exts_max : 16;
+
+			ext = OPENSSL_realloc(s->s3->client_exts,
+					max * sizeof(*ext));
+			if (ext == NULL)
+				{
+				s->s3->client_exts_num = 0;
+				return 0;
+				}
+			s->s3->client_exts = ext;
+			s->s3->client_exts_max = max;
+			}
+		ext = &s->s3->client_exts[s->s3->client_exts_num++];
+		ext->type = type;
+		ext->off = (unsigned int)off;
+		ext->len = size;
+		off += size;
+		}
+	return 1;
+	}
+
+int SSL_client_hello_get0_ext(SSL *s, unsigned int type,
+			      const unsigned char **out, size_t *outlen)
+	{
+	const TLS1_EXT_INDEX *ext;
+	size_t i;
+
+	/* The index only holds while the ClientHello is being processed */
+	if (!s->server || s->s3 == NULL || s->state != SSL3_ST_SR_CLNT_HELLO_C)
+		return 0;
+	for (i = 0; i < s->s3->client_exts_num; i++)
+		{
+		ext = &s->s3->client_exts[i];
+		if (ext->type == type)
+			{
+			*out = (const unsigned char *)s->init_msg + ext->off;
+			*outlen = ext->len;
+			return 1;
+			}
+		}
+	return 0;
+	}
+
 #ifndef OPENSSL_NO_EC
 /* ssl_check_for_safari attempts to fingerprint Safari using OS X
  * SecureTransport using the TLS extension block in |d|, of length |n|.
@@ -1988,6 +2082,14 @@ static int ssl_scan_clienthello_tlsext(SSL *s, unsigned char **p, unsigned char
 		ssl_check_for_safari(s, data, d, n);
 #endif /* !OPENSSL_NO_EC */
 
+	/* What is learnt of the peer goes in s->cert, which must not be the
+	 * CERT of the SSL_CTX */
+	if (!ssl_cert_unshare(s, 1))
+		{
+		*al = SSL_AD_INTERNAL_ERROR;
+		return 0;
+		}
+
 	/* Clear any signature algorithms extension received */
 	if (s->cert->peer_sigalgs)
 		{
@@ -3075,6 +3177,12 @@ int ssl_check_clienthello_tlsext_late(SSL *s)
 		/* Set current certificate to one we will use so
 		 * SSL_get_certificate et al can pick it up.
 		 */
+		if (!ssl_cert_unshare(s, 1))
+			{
+			al = SSL_AD_INTERNAL_ERROR;
+			ret = SSL_TLSEXT_ERR_ALERT_FATAL;
+			goto err;
+			}
 		s->cert->key = certpkey;
 		r = s->ctx->tlsext_status_cb(s, s->ctx->tlsext_status_arg);
 		switch (r)
@@ -3414,13 +3522,23 @@ static int tls_decrypt_ticket(SSL *s, const unsigned char *etick, int eticklen,
 		}
 	else
 		{
+		unsigned char *nctick = (unsigned char *)etick;
+		int rv = tls1_ticket_key_ring_cb(tctx, nctick, nctick + 16,
+							&ctx, &hctx, 0);
+		if (rv < 0)
+			return -1;
+		if (rv == 2)
+			renew_ticket = 1;
 		/* Check key name matches */
-		if (memcmp(etick, tctx->tlsext_tick_key_name, 16))
+		if (rv == 0 && memcmp(etick, tctx->tlsext_tick_key_name, 16))
 			return 2;
-		HMAC_Init_ex(&hctx, tctx->tlsext_tick_hmac_key, 16,
-					tlsext_tick_md(), NULL);
-		EVP_DecryptInit_ex(&ctx, EVP_aes_128_cbc(), NULL,
-				tctx->tlsext_tick_aes_key, etick + 16);
+		if (rv == 0)
+			{
+			HMAC_Init_ex(&hctx, tctx->tlsext_tick_hmac_key, 16,
+						tlsext_tick_md(), NULL);
+			EVP_DecryptInit_ex(&ctx, EVP_aes_128_cbc(), NULL,
+					tctx->tlsext_tick_aes_key, etick + 16);
+			}
 		}
 	/* Attempt to process session ticket, first conduct sanity and
 	 * integrity checks on ticket.
@@ -3455,7 +3573,11 @@ static int tls_decrypt_ticket(SSL *s, const unsigned char *etick, int eticklen,
 	EVP_CIPHER_CTX_cleanup(&ctx);
 	p = sdec;
 
-	sess = d2i_SSL_SESSION(NULL, &p, slen);
+	/* Either encoding may have been used when the ticket was issued */
+	if (slen > 0 && sdec[0] == SSL_SESSION_COMPACT_VERSION)
+		sess = SSL_SESSION_decode_compact(NULL, sdec, slen);
+	else
+		sess = d2i_SSL_SESSION(NULL, &p, slen);
 	OPENSSL_free(sdec);
 	if (sess)
 		{
@@ -3479,6 +3601,207 @@ static int tls_decrypt_ticket(SSL *s, const unsigned char *etick, int eticklen,
 	return 2;
 	}
 
+static unsigned long tls_ticket_key_hash(const TLS_TICKET_KEY *a)
+	{
+	unsigned long h = 0;
+	int i;
+
+	for (i = 0; i < 16; i++)
+		h = h * 31 + a->name[i];
+	return h;
+	}
+
+static int tls_ticket_key_cmp(const TLS_TICKET_KEY *a,
+			      const TLS_TICKET_KEY *b)
+	{
+	return memcmp(a->name, b->name, 16);
+	}
+
+static IMPLEMENT_LHASH_HASH_FN(tls_ticket_key, TLS_TICKET_KEY)
+static IMPLEMENT_LHASH_COMP_FN(tls_ticket_key, TLS_TICKET_KEY)
+
+static void tls_ticket_key_free(TLS_TICKET_KEY *k)
+	{
+	EVP_CIPHER_CTX_cleanup(&k->enc_ctx);
+	EVP_CIPHER_CTX_cleanup(&k->dec_ctx);
+	HMAC_CTX_cleanup(&k->hmac_ctx);
+	OPENSSL_free(k);
+	}
+
+static void tls_ticket_key_free_doall(TLS_TICKET_KEY *k)
+	{
+	tls_ticket_key_free(k);
+	}
+static IMPLEMENT_LHASH_DOALL_FN(tls_ticket_key_free, TLS_TICKET_KEY)
+
+void tls1_ticket_key_ring_free(TLS_TICKET_KEY_RING *ring)
+	{
+	LHM_lh_doall(TLS_TICKET_KEY, ring->keys,
+		     LHASH_DOALL_FN(tls_ticket_key_free));
+	LHM_lh_free(TLS_TICKET_KEY, ring->keys);
+	OPENSSL_free(ring);
+	}
+
+/* Sets up the contexts for a ticket from the key ring of ctx, in the way of
+ * a tlsext_ticket_key_cb callback: returns 0 if the ring has no suitable
+ * key, 1 on success, 2 if a ticket was decrypted with a key other than the
+ * encryption key and should be renewed and -1 on error. */
+int tls1_ticket_key_ring_cb(SSL_CTX *ctx, unsigned char *name,
+			    unsigned char *iv, EVP_CIPHER_CTX *ectx,
+			    HMAC_CTX *hctx, int enc)
+	{
+	TLS_TICKET_KEY_RING *ring;
+	TLS_TICKET_KEY tmp, *k;
+	int ret = 0;
+
+	/* The ring may be created by another thread, so it is read under the
+	 * lock as well */
+	CRYPTO_r_lock(CRYPTO_LOCK_SSL_TICKET_KEYS);
+	ring = ctx->tlsext_ticket_key_ring;
+	if (ring == NULL)
+		k = NULL;
+	else if (enc)
+		k = ring->encrypt_key;
+	else
+		{
+		memcpy(tmp.name, name, 16);
+		k = LHM_lh_retrieve(TLS_TICKET_KEY, ring->keys, &tmp);
+		}
+	if (k != NULL)
+		{
+		if (!EVP_CIPHER_CTX_copy(ectx, enc ? &k->enc_ctx : &k->dec_ctx)
+		    || !HMAC_CTX_copy(hctx, &k->hmac_ctx))
+			ret = -1;
+		else if (enc)
+			{
+			memcpy(name, k->name, 16);
+			ret = 1;
+			}
+		else
+			ret = k == ring->encrypt_key ? 1 : 2;
+		}
+	CRYPTO_r_unlock(CRYPTO_LOCK_SSL_TICKET_KEYS);
+
+	/* Only the IV is set, the key schedule came with the copy */
+	if (ret > 0 && ((enc && RAND_pseudo_bytes(iv, 16) < 0) ||
+			!EVP_CipherInit_ex(ectx, NULL, NULL, NULL, iv, enc)))
+		return -1;
+	return ret;
+	}
+
+int SSL_CTX_add_ticket_key(SSL_CTX *ctx, const unsigned char *keys,
+			   int encrypt)
+	{
+	TLS_TICKET_KEY_RING *ring;
+	TLS_TICKET_KEY *k, *old;
+
+	k = OPENSSL_malloc(sizeof(*k));
+	if (k == NULL)
+		{
+		SSLerr(SSL_F_SSL_CTX_ADD_TICKET_KEY, ERR_R_MALLOC_FAILURE);
+		return 0;
+		}
+	memcpy(k->name, keys, 16);
+	EVP_CIPHER_CTX_init(&k->enc_ctx);
+	EVP_CIPHER_CTX_init(&k->dec_ctx);
+	HMAC_CTX_init(&k->hmac_ctx);
+	if (!EVP_EncryptInit_ex(&k->enc_ctx, EVP_aes_128_cbc(), NULL,
+				keys + 32, NULL) ||
+	    !EVP_DecryptInit_ex(&k->dec_ctx, EVP_aes_128_cbc(), NULL,
+				keys + 32, NULL) ||
+	    !HMAC_Init_ex(&k->hmac_ctx, keys + 16, 16, tlsext_tick_md(), NULL))
+		{
+		SSLerr(SSL_F_SSL_CTX_ADD_TICKET_KEY, ERR_R_EVP_LIB);
+		tls_ticket_key_free(k);
+		return 0;
+		}
+
+	CRYPTO_w_lock(CRYPTO_LOCK_SSL_TICKET_KEYS);
+	ring = ctx->tlsext_ticket_key_ring;
+	if (ring == NULL)
+		{
+		ring = OPENSSL_malloc(sizeof(*ring));
+		if (ring == NULL)
+			goto err;
+		ring->encrypt_key = NULL;
+		ring->keys = LHM_lh_new(TLS_TICKET_KEY, tls_ticket_key);
+		if (ring->keys == NULL)
+			{
+			OPENSSL_free(ring);
+			goto err;
+			}
+		ctx->tlsext_ticket_key_ring = ring;
+		}
+	old = LHM_lh_insert(TLS_TICKET_KEY, ring->keys, k);
+	if (old == NULL && LHM_lh_error(TLS_TICKET_KEY, ring->keys) > 0)
+		goto err;
+	if (old != NULL)
+		{
+		/* Replaced a key of the same name */
+		if (ring->encrypt_key == old)
+			ring->encrypt_key = k;
+		tls_ticket_key_free(old);
+		}
+	if (encrypt)
+		ring->encrypt_key = k;
+	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_TICKET_KEYS);
+	return 1;
+ err:
+	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_TICKET_KEYS);
+	SSLerr(SSL_F_SSL_CTX_ADD_TICKET_KEY, ERR_R_MALLOC_FAILURE);
+	tls_ticket_key_free(k);
+	return 0;
+	}
+
+int SSL_CTX_remove_ticket_key(SSL_CTX *ctx, const unsigned char *name)
+	{
+	TLS_TICKET_KEY_RING *ring;
+	TLS_TICKET_KEY tmp, *k = NULL;
+
+	memcpy(tmp.name, name, 16);
+	CRYPTO_w_lock(CRYPTO_LOCK_SSL_TICKET_KEYS);
+	ring = ctx->tlsext_ticket_key_ring;
+	if (ring != NULL)
+		{
+		k = LHM_lh_delete(TLS_TICKET_KEY, ring->keys, &tmp);
+		if (k != NULL && ring->encrypt_key == k)
+			ring->encrypt_key = NULL;
+		}
+	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_TICKET_KEYS);
+	if (k == NULL)
+		{
+		SSLerr(SSL_F_SSL_CTX_REMOVE_TICKET_KEY,
+		       SSL_R_TICKET_KEY_NOT_FOUND);
+		return 0;
+		}
+	tls_ticket_key_free(k);
+	return 1;
+	}
+
+int SSL_CTX_set_ticket_encrypt_key(SSL_CTX *ctx, const unsigned char *name)
+	{
+	TLS_TICKET_KEY_RING *ring;
+	TLS_TICKET_KEY tmp, *k = NULL;
+
+	CRYPTO_w_lock(CRYPTO_LOCK_SSL_TICKET_KEYS);
+	ring = ctx->tlsext_ticket_key_ring;
+	if (ring != NULL && name != NULL)
+		{
+		memcpy(tmp.name, name, 16);
+		k = LHM_lh_retrieve(TLS_TICKET_KEY, ring->keys, &tmp);
+		}
+	if (ring != NULL && (k != NULL || name == NULL))
+		ring->encrypt_key = k;
+	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_TICKET_KEYS);
+	if (k == NULL && name != NULL)
+		{
+		SSLerr(SSL_F_SSL_CTX_SET_TICKET_ENCRYPT_KEY,
+		       SSL_R_TICKET_KEY_NOT_FOUND);
+		return 0;
+		}
+	return 1;
+	}
+
 /* Tables to translate from NIDs to TLS v1.2 ids */
 
 typedef struct 
@@ -3603,6 +3926,95 @@ const EVP_MD *tls12_get_hash(unsigned char hash_alg)
 	return inf->mfunc();
 	}
 
+int tls12_get_hash_id(const EVP_MD *md)
+	{
+	return tls12_find_id(EVP_MD_type(md), tls12_md,
+				sizeof(tls12_md)/sizeof(tls12_lookup));
+	}
+
+/* Returns the hashes, as a mask of 1 << TLSEXT_hash_*, that a TLS 1.2
+ * CertificateVerify of this handshake may be signed with, or 0 if there
+ * will be none. On a client |cert_req| is set once the signature
+ * algorithms of the CertificateRequest have been processed.
+ */
+unsigned int tls12_cert_verify_hashes(SSL *s, int cert_req)
+	{
+	const unsigned char *sigs;
+	size_t sigslen, i;
+	unsigned int mask = 0;
+	CERT *c = s->cert;
+
+	if (!SSL_USE_SIGALGS(s) || s->hit)
+		return 0;
+	if (s->server)
+		{
+		if (!(s->verify_mode & SSL_VERIFY_PEER))
+			return 0;
+		/* What tls12_check_peer_sigalg() accepts */
+		sigslen = tls12_get_psigalgs(s, &sigs);
+		if (!(c->cert_flags & SSL_CERT_FLAGS_CHECK_TLS_STRICT))
+			mask |= 1U << TLSEXT_hash_sha1;
+		}
+	else if (cert_req)
+		{
+		/* The client key is signed with its digest, or with one
+		 * shared with the server for Suite B */
+		for (i = 0; i < SSL_PKEY_NUM; i++)
+			{
+			int id;
+			if (c->pkeys[i].digest == NULL)
+				continue;
+			id = tls12_get_hash_id(c->pkeys[i].digest);
+			if (id > 0)
+				mask |= 1U << id;
+			}
+		for (i = 0; i < c->shared_sigalgslen; i++)
+			{
+			if (c->shared_sigalgs[i].rhash <= TLSEXT_hash_sha512)
+				mask |= 1U << c->shared_sigalgs[i].rhash;
+			}
+		return mask;
+		}
+	else
+		{
+		/* No certificate to send */
+		for (i = 0; i < SSL_PKEY_NUM; i++)
+			{
+			if (c->pkeys[i].x509 != NULL &&
+			    c->pkeys[i].privatekey != NULL)
+				break;
+			}
+		if (i == SSL_PKEY_NUM && c->cert_cb == NULL &&
+		    s->ctx->client_cert_cb == NULL
+#ifndef OPENSSL_NO_ENGINE
+		    && s->ctx->client_cert_engine == NULL
+#endif
+			)
+			return 0;
+		/* As tls1_set_shared_sigalgs(), which may fall back to
+		 * SHA1 */
+		if (c->client_sigalgs && !tls1_suiteb(s))
+			{
+			sigs = c->client_sigalgs;
+			sigslen = c->client_sigalgslen;
+			}
+		else if (c->conf_sigalgs && !tls1_suiteb(s))
+			{
+			sigs = c->conf_sigalgs;
+			sigslen = c->conf_sigalgslen;
+			}
+		else
+			sigslen = tls12_get_psigalgs(s, &sigs);
+		mask |= 1U << TLSEXT_hash_sha1;
+		}
+	for (i = 0; i + 1 < sigslen; i += 2)
+		{
+		if (sigs[i] <= TLSEXT_hash_sha512)
+			mask |= 1U << sigs[i];
+		}
+	return mask;
+	}
+
 static int tls12_get_pkey_idx(unsigned char sig_alg)
 	{
 	switch(sig_alg)
@@ -3826,14 +4238,15 @@ int tls1_process_sigalgs(SSL *s, const unsigned char *data, int dsize)
 	int idx;
 	size_t i;
 	const EVP_MD *md;
-	CERT *c = s->cert;
+	CERT *c;
 	TLS_SIGALGS *sigptr;
 	/* Extension ignored for inappropriate versions */
 	if (!SSL_USE_SIGALGS(s))
 		return 1;
 	/* Should never happen */
-	if (!c)
+	if (!s->cert || !ssl_cert_unshare(s, 1))
 		return 0;
+	c = s->cert;
 
 	if (c->peer_sigalgs)
 		OPENSSL_free(c->peer_sigalgs);
@@ -4270,8 +4683,13 @@ int tls1_check_chain(SSL *s, X509 *x, EVP_PKEY *pk, STACK_OF(X509) *chain,
 	int rv = 0;
 	int check_flags = 0, strict_mode;
 	CERT_PKEY *cpk = NULL;
-	CERT *c = s->cert;
+	CERT *c;
 	unsigned int suiteb_flags = tls1_suiteb(s);
+	/* Checking the chains of s->cert records their validity there, so it
+	 * must not be the CERT of the SSL_CTX */
+	if (idx != -1 && !ssl_cert_unshare(s, 1))
+		return 0;
+	c = s->cert;
 	/* idx == -1 means checking server chains */
 	if (idx != -1)
 		{
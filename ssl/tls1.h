@@ -388,6 +388,14 @@ SSL_CTX_ctrl(ctx,SSL_CTRL_SET_TLSEXT_SERVERNAME_ARG,0, (void *)arg)
 #define SSL_CTX_set_tlsext_ticket_keys(ctx, keys, keylen) \
 	SSL_CTX_ctrl((ctx),SSL_CTRL_SET_TLSEXT_TICKET_KEYS,(keylen),(keys))
 
+/* Ring of ticket keys used instead of the single one above once a key has
+ * been added. |keys| is 48 bytes as for SSL_CTX_set_tlsext_ticket_keys(),
+ * |name| the first 16 of them. */
+int SSL_CTX_add_ticket_key(SSL_CTX *ctx, const unsigned char *keys,
+			   int encrypt);
+int SSL_CTX_remove_ticket_key(SSL_CTX *ctx, const unsigned char *name);
+int SSL_CTX_set_ticket_encrypt_key(SSL_CTX *ctx, const unsigned char *name);
+
 #define SSL_CTX_set_tlsext_status_cb(ssl, cb) \
 SSL_CTX_callback_ctrl(ssl,SSL_CTRL_SET_TLSEXT_STATUS_REQ_CB,(void (*)(void))cb)
 